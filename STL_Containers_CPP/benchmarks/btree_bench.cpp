@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_btree_map.h"
+#include "../containers/s21_btree_set.h"
+
+/*
+ * s21::btree_set/btree_map against the red-black s21::set/map, same keys
+ * and operations side by side, for each size:
+ *   insert:  random keys into an empty container
+ *   find:    random present keys
+ *   miss:    random absent keys
+ *   iterate: one in-order walk, per element
+ *   erase:   every key by value, in random order
+ * and the same for a map<std::string, int> with 16-character keys, where
+ * comparisons rather than cache misses dominate.
+ *
+ * Usage: btree_bench [max elements] [lookups]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+struct Result {
+  double insert, find, miss, iterate, erase;
+};
+
+template <typename Container, typename Key, typename MakeValue>
+Result run(const std::vector<Key>& keys, const std::vector<Key>& absent,
+           const std::vector<Key>& probes, MakeValue make_value) {
+  Result r{};
+  Container c;
+  auto start = Clock::now();
+  for (const Key& key : keys) c.insert(make_value(key));
+  r.insert = ns_since(start, keys.size());
+
+  long hits = 0;
+  start = Clock::now();
+  for (const Key& key : probes) hits += c.contains(key);
+  r.find = ns_since(start, probes.size());
+
+  start = Clock::now();
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    hits += c.contains(absent[i % absent.size()]);
+  }
+  r.miss = ns_since(start, probes.size());
+
+  start = Clock::now();
+  hits += std::distance(c.begin(), c.end());
+  r.iterate = ns_since(start, c.size());
+
+  start = Clock::now();
+  for (const Key& key : keys) c.erase(c.find(key));
+  r.erase = ns_since(start, keys.size());
+  g_sink = hits + static_cast<long>(c.size());
+  return r;
+}
+
+void print(const char* name, const Result& r) {
+  std::printf("  %-27s %8.1f %8.1f %8.1f %8.1f %8.1f\n", name, r.insert,
+              r.find, r.miss, r.iterate, r.erase);
+}
+
+std::string make_string_key(long value) {
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "key-%012ld", value);
+  return buffer;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t lookups =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  std::printf("ns/op%-24s %8s %8s %8s %8s %8s\n", "", "insert", "find",
+              "miss", "iterate", "erase");
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    // even keys are inserted, odd ones are only looked up
+    std::vector<long> keys(n);
+    std::vector<long> absent(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      keys[i] = static_cast<long>(i) * 2;
+      absent[i] = static_cast<long>(i) * 2 + 1;
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::shuffle(absent.begin(), absent.end(), rng);
+    std::vector<long> probes(lookups);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    for (long& probe : probes) probe = keys[pick(rng)];
+
+    auto as_key = [](long key) { return key; };
+    auto as_pair = [](long key) {
+      return std::pair<const long, long>(key, key);
+    };
+    std::printf("%zu elements\n", n);
+    print("s21::set<long>",
+          run<s21::set<long>>(keys, absent, probes, as_key));
+    print("s21::btree_set<long>",
+          run<s21::btree_set<long>>(keys, absent, probes, as_key));
+    print("s21::map<long, long>",
+          run<s21::map<long, long>>(keys, absent, probes, as_pair));
+    print("s21::btree_map<long,long>",
+          run<s21::btree_map<long, long>>(keys, absent, probes, as_pair));
+
+    std::vector<std::string> skeys(n);
+    std::vector<std::string> sabsent(n);
+    std::vector<std::string> sprobes(lookups);
+    for (std::size_t i = 0; i < n; ++i) {
+      skeys[i] = make_string_key(keys[i]);
+      sabsent[i] = make_string_key(absent[i]);
+    }
+    for (std::size_t i = 0; i < lookups; ++i) {
+      sprobes[i] = make_string_key(probes[i]);
+    }
+    auto as_spair = [](const std::string& key) {
+      return std::pair<const std::string, int>(key, 1);
+    };
+    print("s21::map<string, int>",
+          run<s21::map<std::string, int>>(skeys, sabsent, sprobes,
+                                          as_spair));
+    print("s21::btree_map<string,int>",
+          run<s21::btree_map<std::string, int>>(skeys, sabsent, sprobes,
+                                                as_spair));
+  }
+  return 0;
+}
@@ -0,0 +1,113 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../containers/list/s21_concurrent_ordered_list.h"
+#include "../containers/list/s21_list.h"
+
+/*
+ * Throughput of s21::concurrent_ordered_list against a sorted s21::list
+ * behind one mutex, for 1..max_threads threads and two read/write mixes.
+ *
+ * Usage: concurrent_list_bench [max_threads] [key_range] [millis_per_run]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+class locked_list {
+ public:
+  bool insert(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = list_.begin();
+    while (it != list_.end() && *it < value) ++it;
+    if (it != list_.end() && *it == value) return false;
+    list_.insert(it, value);
+    return true;
+  }
+
+  bool erase(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = list_.begin();
+    while (it != list_.end() && *it < value) ++it;
+    if (it == list_.end() || *it != value) return false;
+    list_.erase(it);
+    return true;
+  }
+
+  bool contains(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = list_.begin();
+    while (it != list_.end() && *it < value) ++it;
+    return it != list_.end() && *it == value;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::list<int> list_;
+};
+
+template <typename Set>
+double run(Set& set, int threads, int key_range, int read_percent,
+           int millis) {
+  for (int k = 0; k < key_range; k += 2) set.insert(k);
+  std::atomic<bool> stop{false};
+  std::atomic<long> total{0};
+  std::atomic<long> hits{0};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      std::mt19937 rng(1234 + t);
+      std::uniform_int_distribution<int> key(0, key_range - 1);
+      std::uniform_int_distribution<int> op(0, 99);
+      long ops = 0;
+      long found = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        int k = key(rng);
+        int o = op(rng);
+        if (o < read_percent) {
+          found += set.contains(k);
+        } else if (o % 2 == 0) {
+          set.insert(k);
+        } else {
+          set.erase(k);
+        }
+        ++ops;
+      }
+      total.fetch_add(ops);
+      hits.fetch_add(found);
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+  stop = true;
+  for (auto& w : workers) w.join();
+  g_sink = hits.load();
+  return total.load() / (millis / 1000.0) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int max_threads = argc > 1 ? std::atoi(argv[1]) : 64;
+  int key_range = argc > 2 ? std::atoi(argv[2]) : 1024;
+  int millis = argc > 3 ? std::atoi(argv[3]) : 200;
+
+  std::printf("ordered set throughput, %d keys (Mops/s)\n", key_range);
+  std::printf("%8s %6s %14s %14s\n", "threads", "reads", "lock-free", "mutex+list");
+  for (int read_percent : {90, 50}) {
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+      s21::concurrent_ordered_list<int> lock_free;
+      locked_list locked;
+      double a = run(lock_free, threads, key_range, read_percent, millis);
+      double b = run(locked, threads, key_range, read_percent, millis);
+      std::printf("%8d %5d%% %14.2f %14.2f\n", threads, read_percent, a, b);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../containers/s21_concurrent_map.h"
+#include "../containers/s21_map.h"
+
+/*
+ * Throughput of s21::concurrent_map (16 and 64 shards) against one s21::map
+ * behind a single mutex, for 1..max_threads threads at 90/10 and 50/50
+ * read/write mixes. Writes are half inserts, half erases, so the map stays
+ * around half full.
+ *
+ * Usage: concurrent_map_bench [max_threads] [key_range] [millis_per_run]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+class locked_map {
+ public:
+  bool insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.insert(key, value).second;
+  }
+
+  std::size_t erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return 0;
+    map_.erase(it);
+    return 1;
+  }
+
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+template <typename Map>
+double run(Map& m, int threads, int key_range, int read_percent, int millis) {
+  for (int k = 0; k < key_range; k += 2) m.insert(k, k);
+  std::atomic<bool> stop{false};
+  std::atomic<long> total{0};
+  std::atomic<long> hits{0};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      std::mt19937 rng(1234 + t);
+      std::uniform_int_distribution<int> key(0, key_range - 1);
+      std::uniform_int_distribution<int> op(0, 99);
+      long ops = 0;
+      long found = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        int k = key(rng);
+        int o = op(rng);
+        if (o < read_percent) {
+          found += m.contains(k);
+        } else if (o % 2 == 0) {
+          m.insert(k, o);
+        } else {
+          m.erase(k);
+        }
+        ++ops;
+      }
+      total.fetch_add(ops);
+      hits.fetch_add(found);
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+  stop = true;
+  for (auto& w : workers) w.join();
+  g_sink = hits.load();
+  return total.load() / (millis / 1000.0) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int max_threads = argc > 1 ? std::atoi(argv[1]) : 64;
+  int key_range = argc > 2 ? std::atoi(argv[2]) : 1 << 20;
+  int millis = argc > 3 ? std::atoi(argv[3]) : 200;
+
+  std::printf("map throughput, %d keys (Mops/s)\n", key_range);
+  std::printf("%8s %6s %12s %12s %12s\n", "threads", "reads", "16 shards",
+              "64 shards", "mutex+map");
+  for (int read_percent : {90, 50}) {
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+      s21::concurrent_map<int, int, 16> sharded16;
+      s21::concurrent_map<int, int, 64> sharded64;
+      locked_map locked;
+      double a = run(sharded16, threads, key_range, read_percent, millis);
+      double b = run(sharded64, threads, key_range, read_percent, millis);
+      double c = run(locked, threads, key_range, read_percent, millis);
+      std::printf("%8d %5d%% %12.2f %12.2f %12.2f\n", threads, read_percent, a,
+                  b, c);
+    }
+  }
+  return 0;
+}
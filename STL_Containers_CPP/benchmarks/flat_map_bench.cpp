@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_btree_map.h"
+#include "../containers/s21_flat_map.h"
+
+/*
+ * s21::flat_map against s21::map and s21::btree_map, for each size:
+ *   build:  from n unsorted pairs (with duplicates) through the range
+ *           constructor: one sort and dedupe for flat_map, n inserts for
+ *           the trees
+ *   find:   random present keys
+ *   miss:   random absent keys
+ *   walk:   one in-order walk, per element
+ * and, for flat_map only, adding a batch of n/10 new pairs:
+ *   insert_range: sorted once and merged in one pass
+ *   insert:       one shifting insert per pair (skipped above 100000
+ *                 elements, where it is quadratic)
+ *
+ * Usage: flat_map_bench [max elements] [lookups]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+using Pairs = std::vector<std::pair<long, long>>;
+
+template <typename Map>
+void run(const char* name, const Pairs& source, const std::vector<long>& probes,
+         const std::vector<long>& absent) {
+  auto start = Clock::now();
+  Map m(source.begin(), source.end());
+  double build = ns_since(start, source.size());
+
+  long hits = 0;
+  start = Clock::now();
+  for (long key : probes) hits += m.contains(key);
+  double find = ns_since(start, probes.size());
+
+  start = Clock::now();
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    hits += m.contains(absent[i % absent.size()]);
+  }
+  double miss = ns_since(start, probes.size());
+
+  start = Clock::now();
+  for (auto it = m.begin(); it != m.end(); ++it) hits += (*it).second;
+  double walk = ns_since(start, m.size());
+  g_sink = hits;
+  std::printf("  %-26s %8.1f %8.1f %8.1f %8.1f\n", name, build, find, miss,
+              walk);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t lookups =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    // even keys are inserted (about one in eight twice), odd ones are only
+    // looked up
+    Pairs source;
+    std::vector<long> absent(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      long key = static_cast<long>(i) * 2;
+      source.emplace_back(key, key);
+      if (i % 8 == 0) source.emplace_back(key, -key);
+      absent[i] = key + 1;
+    }
+    std::shuffle(source.begin(), source.end(), rng);
+    std::shuffle(absent.begin(), absent.end(), rng);
+    std::vector<long> probes(lookups);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    for (long& probe : probes) probe = static_cast<long>(pick(rng)) * 2;
+
+    std::printf("%zu elements, ns/op%-7s %8s %8s %8s %8s\n", n, "", "build",
+                "find", "miss", "walk");
+    run<s21::map<long, long>>("s21::map<long, long>", source, probes, absent);
+    run<s21::btree_map<long, long>>("s21::btree_map<long, long>", source,
+                                    probes, absent);
+    run<s21::flat_map<long, long>>("s21::flat_map<long, long>", source,
+                                   probes, absent);
+
+    // a batch of new odd keys spread over the whole range
+    Pairs batch;
+    for (std::size_t i = 0; i < n / 10; ++i) {
+      batch.emplace_back(absent[i], 1);
+    }
+    s21::flat_map<long, long> base(source.begin(), source.end());
+    s21::flat_map<long, long> merged(base);
+    auto start = Clock::now();
+    merged.insert_range(batch);
+    double range_ns = ns_since(start, batch.size());
+    std::printf("  flat_map + %zu: insert_range %8.1f ns/element", batch.size(),
+                range_ns);
+    if (n <= 100000) {
+      s21::flat_map<long, long> one_by_one(base);
+      start = Clock::now();
+      for (const auto& value : batch) one_by_one.insert(value);
+      std::printf(", insert %8.1f ns/element",
+                  ns_since(start, batch.size()));
+      g_sink = static_cast<long>(one_by_one.size());
+    }
+    std::printf("\n");
+    g_sink = static_cast<long>(merged.size());
+  }
+  return 0;
+}
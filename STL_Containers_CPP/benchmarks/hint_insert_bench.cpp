@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../containers/s21_set.h"
+
+/*
+ * s21::set<long> filled by insert(value) against insert(hint, value) for
+ * ascending, descending and random key streams. The hint is end() for
+ * ascending keys, begin() for descending keys and the iterator returned by
+ * the previous insert for random keys (a mostly wrong hint).
+ *
+ * Usage: hint_insert_bench [elements...]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Set = s21::set<long>;
+
+double ns_per_insert(const std::vector<long>& keys, int mode) {
+  Set s;
+  auto start = Clock::now();
+  switch (mode) {
+    case 0:
+      for (long key : keys) s.insert(key);
+      break;
+    case 1:
+      for (long key : keys) s.insert(s.end(), key);
+      break;
+    case 2:
+      for (long key : keys) s.insert(s.begin(), key);
+      break;
+    default: {
+      auto hint = s.end();
+      for (long key : keys) hint = s.insert(hint, key);
+    }
+  }
+  double ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  g_sink = static_cast<long>(s.size());
+  return ns / static_cast<double>(keys.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+  if (sizes.empty()) sizes = {1000000};
+
+  for (std::size_t n : sizes) {
+    std::vector<long> ascending(n);
+    std::iota(ascending.begin(), ascending.end(), 0L);
+    std::vector<long> descending(ascending.rbegin(), ascending.rend());
+    std::vector<long> random = ascending;
+    std::shuffle(random.begin(), random.end(), std::mt19937(42));
+
+    std::printf("s21::set<long>, %zu inserts (ns/insert)\n", n);
+    std::printf("  %-12s %10s %10s\n", "stream", "insert", "hinted");
+    std::printf("  %-12s %10.1f %10.1f\n", "ascending",
+                ns_per_insert(ascending, 0), ns_per_insert(ascending, 1));
+    std::printf("  %-12s %10.1f %10.1f\n", "descending",
+                ns_per_insert(descending, 0), ns_per_insert(descending, 2));
+    std::printf("  %-12s %10.1f %10.1f\n", "random", ns_per_insert(random, 0),
+                ns_per_insert(random, 3));
+  }
+  return 0;
+}
@@ -0,0 +1,106 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_interval_map.h"
+
+/*
+ * s21::interval_map against the linear scan over a vector of ranges it
+ * replaces, with n ranges [start, start + length) of mostly short and a few
+ * long lengths spread over [0, 100 n), for each size:
+ *   build: n inserts, per range
+ *   stab:  random points, per query
+ *   range: random windows of 50 units, per query
+ * The hit columns give the average number of overlaps reported per query.
+ *
+ * Usage: interval_map_bench [max ranges] [queries]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+struct Range {
+  long lo;
+  long hi;
+  long id;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+  std::mt19937_64 rng(48);
+
+  std::printf("%10s %-13s %9s %12s %12s %8s %8s\n", "ranges", "", "build",
+              "stab", "range", "stab k", "range k");
+  for (std::size_t n = 10000; n <= max_n; n *= 10) {
+    long span = static_cast<long>(n) * 100;
+    std::vector<Range> ranges(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      long lo = static_cast<long>(rng() % static_cast<unsigned long>(span));
+      long length = rng() % 100 == 0 ? 5000 : static_cast<long>(rng() % 200);
+      ranges[i] = {lo, lo + length + 1, static_cast<long>(i)};
+    }
+    std::vector<long> points(queries);
+    for (long& p : points) {
+      p = static_cast<long>(rng() % static_cast<unsigned long>(span));
+    }
+
+    auto start = Clock::now();
+    s21::interval_map<long, long> m;
+    for (const Range& r : ranges) m.insert(r.lo, r.hi, r.id);
+    double build = ns_since(start, n);
+
+    long sum = 0;
+    std::size_t stab_hits = 0, range_hits = 0;
+    start = Clock::now();
+    for (long p : points) {
+      for (const auto& item : m.stab(p)) sum += item.second, ++stab_hits;
+    }
+    double stab = ns_since(start, queries);
+    start = Clock::now();
+    for (long p : points) {
+      for (const auto& item : m.find_overlapping(p, p + 50)) {
+        sum += item.second, ++range_hits;
+      }
+    }
+    double range = ns_since(start, queries);
+    std::printf("%10zu %-13s %9.1f %12.1f %12.1f %8.1f %8.1f\n", n,
+                "interval_map", build, stab, range,
+                static_cast<double>(stab_hits) / queries,
+                static_cast<double>(range_hits) / queries);
+
+    start = Clock::now();
+    for (long p : points) {
+      for (const Range& r : ranges) {
+        if (r.lo <= p && p < r.hi) sum += r.id;
+      }
+    }
+    stab = ns_since(start, queries);
+    start = Clock::now();
+    for (long p : points) {
+      for (const Range& r : ranges) {
+        if (r.lo < p + 50 && p < r.hi) sum += r.id;
+      }
+    }
+    range = ns_since(start, queries);
+    std::printf("%10s %-13s %9s %12.1f %12.1f\n", "", "linear scan", "", stab,
+                range);
+    g_sink = sum;
+  }
+  return 0;
+}
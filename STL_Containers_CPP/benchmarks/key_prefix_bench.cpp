@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_map.h"
+
+/*
+ * s21::map<std::string, int> without and with a key prefix cached in its
+ * nodes (StringKeyPrefix<8> and <16>), on n keys of each set:
+ *   uuid: random version-4 UUIDs, 36 characters
+ *   url:  URLs under a few hosts and sections, about 60 characters
+ * with, per operation:
+ *   insert: n inserts in random order
+ *   find:   lookups of present keys in random order
+ *   miss:   lookups of absent keys
+ *
+ * Usage: key_prefix_bench [max keys]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+std::vector<std::string> make_uuids(std::size_t n, std::mt19937_64& rng) {
+  static const char kHex[] = "0123456789abcdef";
+  std::vector<std::string> uuids(n);
+  for (std::string& uuid : uuids) {
+    uuid = "xxxxxxxx-xxxx-4xxx-yxxx-xxxxxxxxxxxx";
+    for (char& c : uuid) {
+      if (c == 'x') c = kHex[rng() % 16];
+      if (c == 'y') c = kHex[8 + rng() % 4];
+    }
+  }
+  return uuids;
+}
+
+std::vector<std::string> make_urls(std::size_t n, std::mt19937_64& rng) {
+  static const char* const kHosts[] = {"https://www.example.com",
+                                       "https://static.example.org",
+                                       "https://api.example.net",
+                                       "http://mirror.example.edu"};
+  static const char* const kSections[] = {
+      "/products/catalog/items/", "/blog/posts/archive/",
+      "/docs/reference/api/v2/", "/users/profiles/public/",
+      "/assets/images/thumbnails/", "/search/results/page/",
+      "/downloads/releases/stable/", "/support/questions/open/"};
+  std::vector<std::string> urls(n);
+  for (std::string& url : urls) {
+    url = kHosts[rng() % 4];
+    url += kSections[rng() % 8];
+    url += std::to_string(rng() % 1000000000);
+    url += "/index.html";
+  }
+  return urls;
+}
+
+template <typename KeyPrefix>
+void run(const char* name, const std::vector<std::string>& keys,
+         const std::vector<std::string>& lookups,
+         const std::vector<std::string>& absent) {
+  using Map = s21::map<
+      std::string, int, std::less<std::string>,
+      s21::node_pool_allocator<std::pair<const std::string, int>>,
+      s21::PointerLinks, KeyPrefix>;
+  auto start = Clock::now();
+  Map m;
+  for (const std::string& key : keys) m.insert(key, 1);
+  double insert = ns_since(start, keys.size());
+
+  long sum = 0;
+  start = Clock::now();
+  for (const std::string& key : lookups) sum += m.find(key)->second;
+  double find = ns_since(start, lookups.size());
+  start = Clock::now();
+  for (const std::string& key : absent) sum += m.contains(key);
+  double miss = ns_since(start, absent.size());
+  g_sink = sum;
+  std::printf("%-16s %9.1f %9.1f %9.1f\n", name, insert, find, miss);
+}
+
+template <typename Make>
+void run_set(const char* set_name, std::size_t n, std::mt19937_64& rng,
+             Make make) {
+  std::vector<std::string> keys = make(n, rng);
+  std::vector<std::string> lookups = keys;
+  std::shuffle(lookups.begin(), lookups.end(), rng);
+  std::vector<std::string> absent = make(n, rng);
+  for (std::string& key : absent) key.back() ^= 0x40;
+  std::printf("%s\n", set_name);
+  run<s21::NoKeyPrefix>("  no prefix", keys, lookups, absent);
+  run<s21::StringKeyPrefix<8>>("  8-byte prefix", keys, lookups, absent);
+  run<s21::StringKeyPrefix<16>>("  16-byte prefix", keys, lookups, absent);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(50);
+
+  for (std::size_t n = 10000; n <= max_n; n *= 10) {
+    std::printf("%zu keys\n%-16s %9s %9s %9s\n", n, "", "insert", "find",
+                "miss");
+    run_set("uuid", n, rng, make_uuids);
+    run_set("url", n, rng, make_urls);
+  }
+  return 0;
+}
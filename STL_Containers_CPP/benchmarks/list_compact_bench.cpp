@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../containers/list/s21_list.h"
+
+/*
+ * Traversal throughput of s21::list before and after compact().
+ *
+ * A fresh list is walked, then a churn phase erases random nodes and
+ * appends replacements so that allocation order no longer follows list
+ * order. The walk is repeated plain, with prefetching, and after compact().
+ *
+ * Usage: list_compact_bench [elements] [churn_rounds]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+double walk_ns_per_element(s21::list<long>& l, bool prefetch, long& sink) {
+  const int repeats = 5;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; ++r) {
+    l.for_each([&sink](long value) { sink += value; }, prefetch);
+  }
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  return ns / (static_cast<double>(l.size()) * repeats);
+}
+
+void churn(s21::list<long>& l, int rounds, std::mt19937& rng) {
+  std::bernoulli_distribution drop(0.5);
+  for (int r = 0; r < rounds; ++r) {
+    std::size_t n = l.size();
+    auto it = l.begin();
+    for (std::size_t i = 0; i < n; ++i) {
+      auto current = it++;
+      if (drop(rng)) {
+        long value = *current;
+        l.erase(current);
+        l.push_back(value);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 8;
+  std::mt19937 rng(42);
+  long sink = 0;
+
+  s21::list<long> l;
+  for (std::size_t i = 0; i < elements; ++i) l.push_back(static_cast<long>(i));
+
+  std::printf("s21::list traversal, %zu elements (ns/element)\n", elements);
+  std::printf("  fresh                 %8.2f\n", walk_ns_per_element(l, false, sink));
+  churn(l, rounds, rng);
+  std::printf("  after churn           %8.2f\n", walk_ns_per_element(l, false, sink));
+  std::printf("  after churn, prefetch %8.2f\n", walk_ns_per_element(l, true, sink));
+
+  auto start = std::chrono::steady_clock::now();
+  l.compact();
+  auto stop = std::chrono::steady_clock::now();
+  std::printf("  compact() took        %8.2f ms\n",
+              std::chrono::duration<double, std::milli>(stop - start).count());
+  std::printf("  after compact         %8.2f\n", walk_ns_per_element(l, false, sink));
+  std::printf("  after compact, prefetch %6.2f\n", walk_ns_per_element(l, true, sink));
+  g_sink = sink;
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+#include "../containers/list/s21_list.h"
+#include "../containers/list/s21_list_parallel.h"
+
+/*
+ * Scaling of s21::parallel::sort against list::sort on random integers.
+ *
+ * Usage: list_parallel_sort_bench [elements] [max_threads]
+ */
+
+namespace {
+
+void fill(s21::list<long>& l, std::size_t elements) {
+  std::mt19937_64 rng(42);
+  l.clear();
+  for (std::size_t i = 0; i < elements; ++i) {
+    l.push_back(static_cast<long>(rng() >> 1));
+  }
+  l.compact();  // same node layout for every run, whatever the heap state
+}
+
+template <typename Sort>
+double time_ms(std::size_t elements, Sort sort) {
+  s21::list<long> l;
+  fill(l, elements);
+  auto start = std::chrono::steady_clock::now();
+  sort(l);
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000;
+  unsigned max_threads = argc > 2 ? std::atoi(argv[2])
+                                  : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+
+  std::printf("sorting s21::list<long> of %zu elements\n", elements);
+  double base = time_ms(elements, [](s21::list<long>& l) { l.sort(); });
+  std::printf("  list::sort                 %9.1f ms\n", base);
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    double ms = time_ms(elements, [threads](s21::list<long>& l) {
+      s21::parallel::sort(l, threads);
+    });
+    std::printf("  parallel::sort, %2u threads %9.1f ms  (x%.2f)\n", threads,
+                ms, base / ms);
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../containers/s21_map.h"
+
+/*
+ * Counter-map workload where most updates hit an existing key:
+ * operator[] increments, duplicate insert() and insert_or_assign() on a
+ * s21::map<std::string, long> with keys too long for the small string
+ * buffer, so building a value that is thrown away costs an allocation.
+ *
+ * Usage: map_counter_bench [keys] [operations] [hit_percent]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Map = s21::map<std::string, long>;
+
+template <typename Op>
+double ns_per_op(const std::vector<std::string>& stream, Op op) {
+  Map m;
+  for (std::size_t i = 0; i < stream.size() / 20; ++i) m[stream[i]] = 0;
+  auto start = Clock::now();
+  for (const std::string& key : stream) op(m, key);
+  double ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  g_sink = static_cast<long>(m.size());
+  return ns / static_cast<double>(stream.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t keys = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000;
+  std::size_t ops = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000000;
+  int hit_percent = argc > 3 ? std::atoi(argv[3]) : 95;
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> pick(0, keys - 1);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::vector<std::string> stream;
+  stream.reserve(ops);
+  std::size_t fresh = keys;
+  for (std::size_t i = 0; i < ops; ++i) {
+    std::size_t id = percent(rng) < hit_percent ? pick(rng) : fresh++;
+    stream.push_back("counter/service/endpoint/" + std::to_string(id));
+  }
+  // warm the key set so hits really hit
+  std::vector<std::string> warm;
+  for (std::size_t i = 0; i < keys; ++i) {
+    warm.push_back("counter/service/endpoint/" + std::to_string(i));
+  }
+  stream.insert(stream.begin(), warm.begin(), warm.end());
+
+  std::printf("s21::map<std::string, long>, %zu keys, %zu ops, %d%% hits (ns/op)\n",
+              keys, ops, hit_percent);
+  std::printf("  operator[]++           %8.1f\n",
+              ns_per_op(stream, [](Map& m, const std::string& k) { ++m[k]; }));
+  std::printf("  insert(key, 1)         %8.1f\n",
+              ns_per_op(stream, [](Map& m, const std::string& k) {
+                m.insert(k, 1);
+              }));
+  std::printf("  insert_or_assign       %8.1f\n",
+              ns_per_op(stream, [](Map& m, const std::string& k) {
+                m.insert_or_assign(k, 7);
+              }));
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../containers/list/s21_list.h"
+#include "../containers/s21_map.h"
+#include "../containers/s21_multimap.h"
+
+/*
+ * s21::multimap against the s21::map<K, s21::list<V>> it replaces, with n
+ * events spread over n / dup distinct timestamps, for each size:
+ *   insert: all events in random timestamp order
+ *   range:  equal_range of a random present timestamp, per event visited
+ *   walk:   one walk over all events in key order, per event
+ *   erase:  erase(key) of every timestamp, per event
+ *
+ * Usage: multimap_bench [max events] [events per key]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+struct Times {
+  double insert, range, walk, erase;
+};
+
+Times run_multimap(const std::vector<long>& keys,
+                   const std::vector<long>& probes) {
+  Times t{};
+  s21::multimap<long, long> m;
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    m.insert(keys[i], static_cast<long>(i));
+  }
+  t.insert = ns_since(start, keys.size());
+
+  long sum = 0;
+  std::size_t visited = 0;
+  start = Clock::now();
+  for (long key : probes) {
+    auto [first, last] = m.equal_range(key);
+    for (; first != last; ++first, ++visited) sum += first->second;
+  }
+  t.range = ns_since(start, visited);
+
+  start = Clock::now();
+  for (const auto& item : m) sum += item.second;
+  t.walk = ns_since(start, m.size());
+
+  start = Clock::now();
+  std::size_t erased = 0;
+  for (long key : probes) erased += m.erase(key);
+  while (!m.empty()) erased += m.erase(m.begin()->first);
+  t.erase = ns_since(start, erased);
+  g_sink = sum;
+  return t;
+}
+
+Times run_map_of_lists(const std::vector<long>& keys,
+                       const std::vector<long>& probes) {
+  Times t{};
+  s21::map<long, s21::list<long>> m;
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    m[keys[i]].push_back(static_cast<long>(i));
+  }
+  t.insert = ns_since(start, keys.size());
+
+  long sum = 0;
+  std::size_t visited = 0;
+  start = Clock::now();
+  for (long key : probes) {
+    auto it = m.find(key);
+    if (it == m.end()) continue;
+    for (long value : it->second) sum += value, ++visited;
+  }
+  t.range = ns_since(start, visited);
+
+  std::size_t total = 0;
+  start = Clock::now();
+  for (const auto& item : m) {
+    for (long value : item.second) sum += value, ++total;
+  }
+  t.walk = ns_since(start, total);
+
+  start = Clock::now();
+  std::size_t erased = 0;
+  for (long key : probes) {
+    auto it = m.find(key);
+    if (it == m.end()) continue;
+    erased += it->second.size();
+    m.erase(it);
+  }
+  while (!m.empty()) {
+    erased += m.begin()->second.size();
+    m.erase(m.begin());
+  }
+  t.erase = ns_since(start, erased);
+  g_sink = sum;
+  return t;
+}
+
+void print(const char* name, const Times& t) {
+  std::printf("  %-24s %8.1f %8.1f %8.1f %8.1f\n", name, t.insert, t.range,
+              t.walk, t.erase);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t dup = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+  std::mt19937_64 rng(47);
+
+  for (std::size_t n = 10000; n <= max_n; n *= 10) {
+    std::size_t distinct = n / dup;
+    std::vector<long> keys(n);
+    for (long& key : keys) key = static_cast<long>(rng() % distinct);
+    std::vector<long> probes(distinct / 2);
+    for (long& key : probes) key = static_cast<long>(rng() % distinct);
+
+    std::printf("%zu events, %zu per key (ns)\n", n, dup);
+    std::printf("  %-24s %8s %8s %8s %8s\n", "", "insert", "range", "walk",
+                "erase");
+    print("multimap", run_multimap(keys, probes));
+    print("map<K, list<V>>", run_map_of_lists(keys, probes));
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../containers/s21_set.h"
+
+/*
+ * s21::set<long> with node_pool_allocator against the default
+ * std::allocator: random inserts, erasing every other key, and destroying
+ * the remaining tree. The pool frees the whole tree by releasing its slabs.
+ *
+ * Usage: node_pool_bench [elements...]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Set>
+void run(const char* name, const std::vector<long>& keys) {
+  auto storage = std::make_unique<Set>();
+  Set& s = *storage;
+
+  auto start = Clock::now();
+  for (long key : keys) s.insert(key);
+  double insert_ms = ms_since(start);
+
+  start = Clock::now();
+  long erased = 0;
+  for (auto it = s.begin(); it != s.end();) {
+    if (*it % 2 == 0) {
+      it = s.erase(it);
+      ++erased;
+    } else {
+      ++it;
+    }
+  }
+  double erase_ms = ms_since(start);
+
+  // refill the freed slots so destruction sees a churned heap
+  start = Clock::now();
+  for (long key : keys) {
+    if (key % 2 == 0) s.insert(key);
+  }
+  double reinsert_ms = ms_since(start);
+
+  start = Clock::now();
+  storage.reset();
+  double destroy_ms = ms_since(start);
+
+  g_sink = erased;
+  std::printf("  %-16s %10.1f %10.1f %10.1f %10.1f\n", name, insert_ms,
+              erase_ms, reinsert_ms, destroy_ms);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+  if (sizes.empty()) sizes = {100000, 1000000};
+
+  for (std::size_t n : sizes) {
+    std::vector<long> keys(n);
+    std::iota(keys.begin(), keys.end(), 0L);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    std::printf("s21::set<long>, %zu elements (ms)\n", n);
+    std::printf("  %-16s %10s %10s %10s %10s\n", "allocator", "insert",
+                "erase 1/2", "reinsert", "destroy");
+    run<s21::set<long>>("std::allocator", keys);
+    run<s21::set<long, std::less<long>, s21::node_pool_allocator<long>>>(
+        "node_pool", keys);
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../containers/s21_map.h"
+#include "../containers/s21_persistent_map.h"
+
+/*
+ * Cost of publishing a new version of a config map after each update:
+ *   s21::map:            update in place, then copy the whole tree for the
+ *                        readers (what copy_tree does on every publish)
+ *   s21::persistent_map: set() returns the new version, sharing the rest
+ * plus the cost of a plain lookup in each, for 1K..max elements.
+ *
+ * Usage: persistent_map_bench [max elements] [updates]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t updates =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+  std::mt19937_64 rng(42);
+
+  std::printf("%10s %16s %16s %12s %12s\n", "elements", "map copy ns/pub",
+              "persistent ns", "map find", "pers. find");
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    std::vector<long> keys(n);
+    for (long& key : keys) key = static_cast<long>(rng());
+    std::vector<long> changed(updates);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    for (long& key : changed) key = keys[pick(rng)];
+
+    s21::map<long, long> live;
+    s21::persistent_map<long, long> version;
+    for (long key : keys) {
+      live.insert(key, 0);
+      version = version.insert(key, 0);
+    }
+
+    // copying is O(n), so fewer publishes for the big maps
+    std::size_t copies = std::max<std::size_t>(1, updates * 1000 / n);
+    auto start = Clock::now();
+    long sink = 0;
+    for (std::size_t i = 0; i < copies; ++i) {
+      live[changed[i % updates]] = static_cast<long>(i);
+      s21::map<long, long> published(live);
+      sink += static_cast<long>(published.size());
+    }
+    double copy_ns = ns_since(start, copies);
+
+    start = Clock::now();
+    for (std::size_t i = 0; i < updates; ++i) {
+      version = version.set(changed[i], static_cast<long>(i));
+      s21::persistent_map<long, long> published(version);
+      sink += static_cast<long>(published.size());
+    }
+    double persistent_ns = ns_since(start, updates);
+
+    start = Clock::now();
+    for (long key : changed) sink += live.find(key)->second;
+    double map_find = ns_since(start, updates);
+    start = Clock::now();
+    for (long key : changed) sink += version.find(key)->second;
+    double persistent_find = ns_since(start, updates);
+    g_sink = sink;
+
+    std::printf("%10zu %16.0f %16.0f %12.1f %12.1f\n", n, copy_ns,
+                persistent_ns, map_find, persistent_find);
+  }
+  return 0;
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../containers/s21_map.h"
+#include "../containers/s21_radix_map.h"
+
+/*
+ * s21::radix_map against s21::map on two key sets of n keys each:
+ *   u64: random 64-bit integers
+ *   url: URLs under a few hosts and long shared path prefixes
+ * with, per operation:
+ *   insert: n inserts in random order
+ *   find:   lookups of present keys in random order
+ *   miss:   lookups of absent keys
+ *   walk:   a full in-order iteration, per element
+ *   prefix: for URLs, the scan of one host and section (about 1/32 of the
+ *           keys), per reported element, against lower_bound plus a walk
+ *
+ * Usage: radix_map_bench [max keys]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+std::vector<std::string> make_urls(std::size_t n, std::mt19937_64& rng) {
+  static const char* const kHosts[] = {"https://www.example.com",
+                                       "https://static.example.org",
+                                       "https://api.example.net",
+                                       "http://mirror.example.edu"};
+  static const char* const kSections[] = {
+      "/products/catalog/items/", "/blog/posts/archive/",
+      "/docs/reference/api/v2/", "/users/profiles/public/",
+      "/assets/images/thumbnails/", "/search/results/page/",
+      "/downloads/releases/stable/", "/support/questions/open/"};
+  std::vector<std::string> urls(n);
+  for (std::string& url : urls) {
+    url = kHosts[rng() % 4];
+    url += kSections[rng() % 8];
+    url += std::to_string(rng() % 1000000000);
+    url += "/index.html";
+  }
+  return urls;
+}
+
+template <typename Map, typename Key>
+void run(const char* name, const std::vector<Key>& keys,
+         const std::vector<Key>& absent) {
+  auto start = Clock::now();
+  Map m;
+  for (const Key& key : keys) m.insert(key, 1);
+  double insert = ns_since(start, keys.size());
+
+  long sum = 0;
+  start = Clock::now();
+  for (const Key& key : keys) sum += m.find(key)->second;
+  double find = ns_since(start, keys.size());
+  start = Clock::now();
+  for (const Key& key : absent) sum += m.contains(key);
+  double miss = ns_since(start, absent.size());
+  start = Clock::now();
+  for (const auto& item : m) sum += item.second;
+  double walk = ns_since(start, m.size());
+  g_sink = sum;
+  std::printf("%-12s %9.1f %9.1f %9.1f %9.1f", name, insert, find, miss,
+              walk);
+
+  if constexpr (std::is_same_v<Key, std::string>) {
+    const std::string prefix =
+        "https://api.example.net/docs/reference/api/v2/";
+    std::size_t hits = 0;
+    start = Clock::now();
+    for (int round = 0; round < 20; ++round) {
+      if constexpr (requires { m.prefix(prefix); }) {
+        for (const auto& item : m.prefix(prefix)) sum += item.second, ++hits;
+      } else {
+        for (auto it = m.lower_bound(prefix);
+             it != m.end() && it->first.starts_with(prefix); ++it) {
+          sum += it->second, ++hits;
+        }
+      }
+    }
+    std::printf(" %9.1f", ns_since(start, std::max<std::size_t>(hits, 1)));
+    g_sink = sum;
+  }
+  std::printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(49);
+
+  for (std::size_t n = 10000; n <= max_n; n *= 10) {
+    std::printf("%zu keys\n%-12s %9s %9s %9s %9s %9s\n", n, "", "insert",
+                "find", "miss", "walk", "prefix");
+
+    std::vector<std::uint64_t> ints(n), absent_ints(n);
+    for (auto& key : ints) key = rng();
+    for (auto& key : absent_ints) key = rng();
+    std::printf("u64\n");
+    run<s21::radix_map<std::uint64_t, int>>("  radix_map", ints, absent_ints);
+    run<s21::map<std::uint64_t, int>>("  map", ints, absent_ints);
+
+    std::vector<std::string> urls = make_urls(n, rng);
+    std::vector<std::string> absent_urls = make_urls(n, rng);
+    for (std::string& url : absent_urls) url += "?";
+    std::printf("url\n");
+    run<s21::radix_map<std::string, int>>("  radix_map", urls, absent_urls);
+    run<s21::map<std::string, int>>("  map", urls, absent_urls);
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../containers/s21_set.h"
+
+/*
+ * Merging two default s21::set<long>: the element-wise approach
+ * (contains, copy into a new node, erase from the source) against merge(),
+ * which relinks the source's nodes without allocating, and against the
+ * copying set_union().
+ *   equal:  n and n keys, interleaved, a quarter of them shared
+ *   skewed: n keys and n / 1000 keys spread over the same range
+ *
+ * Usage: set_merge_bench [elements]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Set = s21::set<long>;
+
+double ms_since(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+Set make_set(std::size_t count, long step, long offset) {
+  std::vector<long> keys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    keys[i] = static_cast<long>(i) * step + offset;
+  }
+  return Set(s21::sorted_unique, keys.begin(), keys.end());
+}
+
+void elementwise_merge(Set& target, Set& source) {
+  for (auto it = source.begin(); it != source.end();) {
+    if (!target.contains(*it)) {
+      target.insert(*it);
+      it = source.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void run(const char* name, std::size_t n, std::size_t m, long step_a,
+         long step_b, long offset_b) {
+  double elementwise;
+  double relink;
+  double copy_union;
+  {
+    Set a = make_set(n, step_a, 0);
+    Set b = make_set(m, step_b, offset_b);
+    auto start = Clock::now();
+    elementwise_merge(a, b);
+    elementwise = ms_since(start);
+    g_sink = static_cast<long>(a.size() + b.size());
+  }
+  {
+    Set a = make_set(n, step_a, 0);
+    Set b = make_set(m, step_b, offset_b);
+    auto start = Clock::now();
+    a.merge(b);
+    relink = ms_since(start);
+    g_sink = static_cast<long>(a.size() + b.size());
+  }
+  {
+    Set a = make_set(n, step_a, 0);
+    Set b = make_set(m, step_b, offset_b);
+    auto start = Clock::now();
+    Set u = s21::set_union(a, b);
+    copy_union = ms_since(start);
+    g_sink = static_cast<long>(u.size());
+  }
+  std::printf("  %-8s %9zu %9zu %12.1f %10.1f %10.1f\n", name, n, m,
+              elementwise, relink, copy_union);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+  std::printf("s21::set<long> merge (ms)\n");
+  std::printf("  %-8s %9s %9s %12s %10s %10s\n", "shape", "n", "m",
+              "elementwise", "relink", "set_union");
+  run("equal", n, n, 4, 3, 1);
+  run("skewed", n, n / 1000, 4, 4000, 2);
+  return 0;
+}
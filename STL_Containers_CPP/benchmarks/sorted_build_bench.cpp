@@ -0,0 +1,58 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../containers/s21_map.h"
+
+/*
+ * Building s21::map<long, long> from n sorted, unique pairs:
+ * emplace per element, the iterator-pair constructor (which detects sorted
+ * input itself) and the sorted_unique constructor that trusts the caller.
+ *
+ * Usage: sorted_build_bench [elements...]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Map = s21::map<long, long>;
+
+template <typename Build>
+void measure(const char* name, Build build) {
+  auto start = Clock::now();
+  Map m = build();
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  g_sink = static_cast<long>(m.size());
+  std::printf("  %-24s %10.1f\n", name, ms);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+  if (sizes.empty()) sizes = {1000000, 5000000};
+
+  for (std::size_t n : sizes) {
+    std::vector<std::pair<long, long>> source(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      source[i] = {static_cast<long>(i) * 2, static_cast<long>(i)};
+    }
+
+    std::printf("s21::map<long, long> from %zu sorted pairs (ms)\n", n);
+    measure("emplace per element", [&] {
+      Map m;
+      for (const auto& kv : source) m.emplace(kv);
+      return m;
+    });
+    measure("iterator pair", [&] { return Map(source.begin(), source.end()); });
+    measure("sorted_unique", [&] {
+      return Map(s21::sorted_unique, source.begin(), source.end());
+    });
+  }
+  return 0;
+}
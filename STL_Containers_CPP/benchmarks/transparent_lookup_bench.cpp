@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../containers/s21_map.h"
+
+/*
+ * Lookups of long string keys given as std::string_view: building a
+ * temporary std::string per lookup (std::less<std::string>) against
+ * heterogeneous lookup with std::less<>.
+ *
+ * Usage: transparent_lookup_bench [keys] [lookups]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+std::string make_key(std::size_t i) {
+  return "/api/v2/resources/items/" + std::to_string(i * 7919 % 1000003);
+}
+
+template <typename Map, typename Lookup>
+double ns_per_lookup(const Map& m, const std::vector<std::string_view>& queries,
+                     Lookup lookup) {
+  long hits = 0;
+  auto start = Clock::now();
+  for (std::string_view query : queries) hits += lookup(m, query);
+  double ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  g_sink = hits;
+  return ns / static_cast<double>(queries.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t keys = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  std::size_t lookups = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000000;
+
+  std::vector<std::string> storage;
+  s21::map<std::string, int> plain;
+  s21::map<std::string, int, std::less<>> transparent;
+  for (std::size_t i = 0; i < keys; ++i) {
+    storage.push_back(make_key(i));
+    plain.insert(storage.back(), static_cast<int>(i));
+    transparent.insert(storage.back(), static_cast<int>(i));
+  }
+  std::vector<std::string_view> queries;
+  for (std::size_t i = 0; i < lookups; ++i) {
+    queries.push_back(storage[(i * 2654435761u) % keys]);
+  }
+
+  std::printf("s21::map<std::string, int>, %zu keys, %zu lookups (ns/lookup)\n",
+              keys, lookups);
+  std::printf("  std::string temporary  %8.1f\n",
+              ns_per_lookup(plain, queries, [](const auto& m, std::string_view q) {
+                return m.contains(std::string(q));
+              }));
+  std::printf("  transparent            %8.1f\n",
+              ns_per_lookup(transparent, queries,
+                            [](const auto& m, std::string_view q) {
+                              return m.contains(q);
+                            }));
+  return 0;
+}
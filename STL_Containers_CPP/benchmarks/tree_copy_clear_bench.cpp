@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers/s21_map.h"
+
+/*
+ * s21::map<long, std::string> with values too long for the small-string
+ * buffer: the copy constructor against the parallel copy, and how long the
+ * caller waits for clear() against clear_deferred(). The last column is
+ * the time until the background reclaimer has finished the deferred work.
+ *
+ * Usage: tree_copy_clear_bench [elements...]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Map = s21::map<long, std::string>;
+
+double ms_since(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+Map make_map(std::size_t n) {
+  Map m;
+  for (std::size_t i = 0; i < n; ++i) {
+    long key = static_cast<long>((i * 2654435761u) % n);
+    m.emplace(key, std::string(40, static_cast<char>('a' + key % 26)));
+  }
+  return m;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) {
+    sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+  }
+  if (sizes.empty()) sizes = {1000000};
+  unsigned threads = std::thread::hardware_concurrency();
+
+  for (std::size_t n : sizes) {
+    Map source = make_map(n);
+    std::printf("s21::map<long, std::string>, %zu elements, %u threads (ms)\n",
+                n, threads);
+
+    auto start = Clock::now();
+    Map serial(source);
+    double serial_ms = ms_since(start);
+    start = Clock::now();
+    Map parallel(source, threads);
+    double parallel_ms = ms_since(start);
+    g_sink = static_cast<long>(serial.size() + parallel.size());
+    std::printf("  %-16s %10s %10s\n", "copy", "serial", "parallel");
+    std::printf("  %-16s %10.1f %10.1f\n", "", serial_ms, parallel_ms);
+
+    start = Clock::now();
+    serial.clear();
+    double clear_ms = ms_since(start);
+    start = Clock::now();
+    parallel.clear_deferred();
+    double deferred_ms = ms_since(start);
+    s21::background_reclaimer::instance().drain();
+    double drained_ms = ms_since(start);
+    std::printf("  %-16s %10s %10s %10s\n", "clear", "clear", "deferred",
+                "reclaimed");
+    std::printf("  %-16s %10.1f %10.3f %10.1f\n", "", clear_ms, deferred_ms,
+                drained_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,106 @@
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../containers/s21_set.h"
+#include "../containers/tree/s21_tree_node_arena_links.h"
+
+/*
+ * Memory per element and lookup throughput of s21::set<int> with the
+ * three node layouts (its Links parameter): PointerLinks (the default),
+ * TaggedPointerLinks and ArenaIndexLinks. Memory is the growth of the
+ * resident set while the set is built from shuffled keys, so it includes
+ * allocator overhead. Every layout runs in its own child process so none
+ * inherits another's heap.
+ *
+ * Usage: tree_layout_bench [elements...]   (e.g. 10000000 100000000)
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Alloc, typename Links>
+using IntSet = s21::set<int, std::less<int>, Alloc, Links>;
+
+long resident_bytes() {
+  long pages = 0;
+  long resident = 0;
+  std::FILE* statm = std::fopen("/proc/self/statm", "r");
+  if (statm) {
+    if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) resident = 0;
+    std::fclose(statm);
+  }
+  return resident * sysconf(_SC_PAGESIZE);
+}
+
+template <typename Alloc, typename Links>
+void run(const char* name, std::size_t n) {
+  std::vector<int> keys(n);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  std::vector<int> probes(keys.begin(),
+                          keys.begin() + std::min<std::size_t>(n, 2000000));
+
+  long before = resident_bytes();
+  IntSet<Alloc, Links> tree;
+  for (int key : keys) tree.insert(key);
+  double bytes = static_cast<double>(resident_bytes() - before);
+
+  auto start = Clock::now();
+  long found = 0;
+  for (int key : probes) found += tree.find(key) != tree.end();
+  double ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  g_sink = found;
+  std::printf("  %-20s %10zu %12.1f %12.1f %12.2f\n", name,
+              sizeof(s21::TreeNode<int, s21::NoAugmentation, Links>),
+              bytes / static_cast<double>(n),
+              ns / static_cast<double>(probes.size()),
+              static_cast<double>(probes.size()) / ns * 1e3);
+  std::fflush(stdout);
+}
+
+template <typename Alloc, typename Links>
+void run_isolated(const char* name, std::size_t n) {
+  std::fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    run<Alloc, Links>(name, n);
+    std::_Exit(0);
+  }
+  int status = 0;
+  if (pid > 0) waitpid(pid, &status, 0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) {
+    sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+  }
+  if (sizes.empty()) sizes = {10000000};
+
+  for (std::size_t n : sizes) {
+    std::printf("set<int>, %zu random keys\n", n);
+    std::printf("  %-20s %10s %12s %12s %12s\n", "layout", "node B",
+                "RSS B/elem", "ns/find", "Mfind/s");
+    run_isolated<s21::node_pool_allocator<int>, s21::PointerLinks>("pointer",
+                                                                   n);
+    run_isolated<s21::node_pool_allocator<int>, s21::TaggedPointerLinks>(
+        "tagged pointer", n);
+    run_isolated<s21::node_arena_allocator<int>, s21::ArenaIndexLinks>(
+        "arena index", n);
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../containers/s21_set.h"
+
+/*
+ * Insert/erase throughput of s21::set<long> on a large tree, where every
+ * mutation also keeps the cached minimum and maximum (header_->left/right)
+ * current.
+ *   random:  erase a random present key, insert a random absent one
+ *   window:  erase the minimum, append a new maximum (sliding time window)
+ *
+ * Usage: tree_minmax_bench [elements] [operations]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+using Set = s21::set<long>;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t ops = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  // even keys are present, odd keys are free
+  std::vector<long> sorted(n);
+  for (std::size_t i = 0; i < n; ++i) sorted[i] = static_cast<long>(i) * 2;
+  Set s(s21::sorted_unique, sorted.begin(), sorted.end());
+
+  std::printf("s21::set<long>, %zu elements, %zu operations (ns/op)\n", n, ops);
+
+  std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < ops; ++i) {
+    long victim = static_cast<long>(pick(rng)) * 2;
+    auto it = s.find(victim);
+    if (it != s.end()) {
+      s.erase(it);
+      s.insert(victim + 1);
+    } else {
+      s.erase(s.find(victim + 1));
+      s.insert(victim);
+    }
+  }
+  std::printf("  random erase + insert  %8.1f\n", ns_since(start, ops));
+
+  long next = 2 * static_cast<long>(n) + 1;
+  start = Clock::now();
+  for (std::size_t i = 0; i < ops; ++i) {
+    s.erase(s.begin());
+    s.insert(next++);
+  }
+  std::printf("  window pop + push      %8.1f\n", ns_since(start, ops));
+
+  g_sink = static_cast<long>(s.size()) + *s.begin();
+  return 0;
+}
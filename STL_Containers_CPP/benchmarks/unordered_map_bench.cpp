@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_map.h"
+#include "../containers/s21_unordered_map.h"
+
+/*
+ * s21::unordered_map against std::unordered_map and the red-black s21::map,
+ * same keys and operations side by side, for each size (1K, 10K, ... up to
+ * the first argument; 100000000 covers 1K-100M given the memory):
+ *   insert:  random keys into an empty container, no reserve
+ *   find:    random present keys
+ *   miss:    random absent keys
+ *   erase:   every key, found and erased, in random order
+ * for long keys and for 16-character std::string keys.
+ *
+ * Usage: unordered_map_bench [max elements] [lookups]
+ */
+
+namespace {
+
+volatile long g_sink;
+
+using Clock = std::chrono::steady_clock;
+
+double ns_since(Clock::time_point start, std::size_t ops) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(ops);
+}
+
+template <typename Map, typename Key>
+void run(const char* name, const std::vector<Key>& keys,
+         const std::vector<Key>& absent, const std::vector<Key>& probes) {
+  Map m;
+  auto start = Clock::now();
+  for (const Key& key : keys) m.insert({key, 1});
+  double insert = ns_since(start, keys.size());
+
+  long hits = 0;
+  start = Clock::now();
+  for (const Key& key : probes) hits += m.find(key) != m.end();
+  double find = ns_since(start, probes.size());
+
+  start = Clock::now();
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    hits += m.find(absent[i % absent.size()]) != m.end();
+  }
+  double miss = ns_since(start, probes.size());
+
+  start = Clock::now();
+  for (const Key& key : keys) {
+    auto it = m.find(key);
+    if (it != m.end()) m.erase(it);
+  }
+  double erase = ns_since(start, keys.size());
+  g_sink = hits + static_cast<long>(m.size());
+  std::printf("  %-34s %8.1f %8.1f %8.1f %8.1f\n", name, insert, find, miss,
+              erase);
+}
+
+std::string make_string_key(long value) {
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016lx",
+                static_cast<unsigned long>(value));
+  return buffer;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t max_n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::size_t lookups =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  std::printf("ns/op%-32s %8s %8s %8s %8s\n", "", "insert", "find", "miss",
+              "erase");
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    // random 64-bit keys; the absent ones are drawn apart from them
+    std::vector<long> keys(n);
+    std::vector<long> absent(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      keys[i] = static_cast<long>(rng() | 1);
+      absent[i] = static_cast<long>(rng() & ~1UL);
+    }
+    std::vector<long> probes(lookups);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    for (long& probe : probes) probe = keys[pick(rng)];
+
+    std::printf("%zu elements\n", n);
+    run<s21::map<long, long>>("s21::map<long, long>", keys, absent, probes);
+    run<std::unordered_map<long, long>>("std::unordered_map<long, long>",
+                                        keys, absent, probes);
+    run<s21::unordered_map<long, long>>("s21::unordered_map<long, long>",
+                                        keys, absent, probes);
+
+    std::vector<std::string> skeys(n);
+    std::vector<std::string> sabsent(n);
+    std::vector<std::string> sprobes(lookups);
+    for (std::size_t i = 0; i < n; ++i) {
+      skeys[i] = make_string_key(keys[i]);
+      sabsent[i] = make_string_key(absent[i]);
+    }
+    for (std::size_t i = 0; i < lookups; ++i) {
+      sprobes[i] = make_string_key(probes[i]);
+    }
+    run<s21::map<std::string, int>>("s21::map<string, int>", skeys, sabsent,
+                                    sprobes);
+    run<std::unordered_map<std::string, int>>(
+        "std::unordered_map<string, int>", skeys, sabsent, sprobes);
+    run<s21::unordered_map<std::string, int>>(
+        "s21::unordered_map<string, int>", skeys, sabsent, sprobes);
+  }
+  return 0;
+}
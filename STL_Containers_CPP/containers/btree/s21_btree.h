@@ -0,0 +1,203 @@
+#ifndef S21_BTREE_H_
+#define S21_BTREE_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <functional>:
+ *  std::less: The default comparator for ordering keys.
+ *
+ * From <memory>:
+ *  std::allocator, std::allocator_traits: Allocate the leaf and internal
+ *    nodes through rebound copies of 'Allocator'.
+ *
+ * From <type_traits>:
+ *  std::is_same_v: Tells sets, whose stored element is the value_type, from
+ *    maps, whose stored element has a mutable key.
+ *
+ * From <utility>:
+ *  std::pair: Returned by try_emplace() and emplace() to bundle an iterator
+ *    and whether the element was inserted.
+ */
+
+#include "s21_btree_iterator.h"
+#include "s21_btree_node.h"
+
+namespace s21 {
+
+/*
+ * A B-tree of unique keys, the engine behind btree_map and btree_set. Every
+ * node holds up to kNodeSlots sorted elements in about 256 bytes (see
+ * BTreeNode) and is searched with a branchless binary search, so a lookup
+ * costs about log(n) / log(kNodeSlots) node visits instead of the log2(n)
+ * scattered nodes of RedBlackTree.
+ *
+ * Elements live in the nodes themselves and move when nodes split, merge or
+ * shift: insert and erase invalidate every iterator, pointer and reference
+ * into the tree. Moving an element is assumed not to throw; an element is
+ * fully built before the tree is changed, so a throwing constructor or
+ * allocation leaves the tree as it was.
+ *
+ *Key type,
+ *Value type,
+ *Traits functor get key from value: SetTraits, MapTraits.
+ *Compare functor std::less and others
+ *Allocator class for memory handling, rebound to the node types
+ */
+template <typename Key, typename T, typename Traits,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<T>>
+class BTree {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using size_type = std::size_t;
+
+  using Node = BTreeNode<value_type>;
+  using InternalNode = BTreeInternalNode<value_type>;
+  using mutable_value_type = typename BTreeSlot<value_type>::mutable_type;
+  using iterator = BTreeIterator<value_type, false>;
+  using const_iterator = BTreeIterator<value_type, true>;
+
+  static constexpr size_type kNodeSlots = Node::kSlots;
+  // Nodes other than the root are merged or refilled below this count.
+  static constexpr size_type kMinSlots = kNodeSlots / 2;
+
+  explicit BTree(const Compare& comp = Compare(),
+                 const Allocator& alloc = Allocator());
+  BTree(const BTree& other);
+  BTree(BTree&& other) noexcept;
+  ~BTree();
+
+  BTree& operator=(const BTree& other);
+  BTree& operator=(BTree&& other) noexcept;
+
+  iterator begin() noexcept { return iterator(leftmost_, 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(leftmost_, 0);
+  }
+  iterator end() noexcept {
+    return iterator(rightmost_, rightmost_ ? rightmost_->count : 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(rightmost_, rightmost_ ? rightmost_->count : 0);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  // Levels from the root to the leaves, 0 for an empty tree.
+  size_type height() const noexcept;
+
+  void clear() noexcept;
+  // Descends with key first and builds the element from args only when no
+  // equivalent key is present; args must produce an element with that key.
+  template <typename Lookup, typename... Args>
+  std::pair<iterator, bool> try_emplace(const Lookup& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  template <typename Lookup>
+  size_type erase_key(const Lookup& key);
+  void swap(BTree& other) noexcept;
+  // Moves every element of other whose key is not present here.
+  void merge(BTree& other);
+
+  template <typename Lookup>
+  iterator find(const Lookup& key);
+  template <typename Lookup>
+  const_iterator find(const Lookup& key) const;
+  template <typename Lookup>
+  iterator lower_bound(const Lookup& key);
+  template <typename Lookup>
+  const_iterator lower_bound(const Lookup& key) const;
+  template <typename Lookup>
+  iterator upper_bound(const Lookup& key);
+  template <typename Lookup>
+  const_iterator upper_bound(const Lookup& key) const;
+
+ private:
+  using leaf_allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using internal_allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<InternalNode>;
+  using leaf_traits = std::allocator_traits<leaf_allocator_type>;
+  using internal_traits = std::allocator_traits<internal_allocator_type>;
+
+  Node* root_ = nullptr;
+  Node* leftmost_ = nullptr;   // first leaf, begin()
+  Node* rightmost_ = nullptr;  // last leaf, end()
+  size_type size_ = 0;
+  leaf_allocator_type leaf_allocator_;
+  internal_allocator_type internal_allocator_;
+  Traits key_extractor_;
+  Compare key_compare_;
+
+  // The node and slot holding key, or the leaf slot it would go to.
+  struct SearchResult {
+    Node* node;
+    size_type position;
+    bool found;
+  };
+
+  template <typename Lookup>
+  SearchResult search(const Lookup& key) const;
+  template <typename Lookup>
+  size_type node_lower_bound(const Node* node, const Lookup& key) const;
+  template <typename Lookup>
+  size_type node_upper_bound(const Node* node, const Lookup& key) const;
+  template <typename Lookup>
+  Node* lower_bound_node(const Lookup& key, size_type& position) const;
+  template <typename Lookup>
+  Node* upper_bound_node(const Lookup& key, size_type& position) const;
+
+  Node* create_leaf();
+  Node* create_internal();
+  void destroy_node(Node* node) noexcept;
+  void destroy_subtree(Node* node) noexcept;
+  Node* copy_subtree(const Node* source);
+  void reset() noexcept;
+
+  iterator insert_into_empty(mutable_value_type&& value);
+  iterator insert_value(Node* node, size_type position,
+                        mutable_value_type&& value);
+  std::pair<Node*, size_type> split(Node* node, size_type position);
+  iterator rebalance_after_erase(Node* node, size_type position);
+  bool merge_or_borrow(Node* node, Node*& tracked, size_type& position);
+  void merge_nodes(Node* left, Node* right) noexcept;
+  void borrow_from_left(Node* node) noexcept;
+  void borrow_from_right(Node* node) noexcept;
+  iterator next_slot(Node* node, size_type position) noexcept;
+
+  static void relocate(BTreeSlot<value_type>& to,
+                       BTreeSlot<value_type>& from) noexcept;
+  static void shift_right(Node* node, size_type position) noexcept;
+  static void shift_left(Node* node, size_type position) noexcept;
+
+  const key_type& get_key(const value_type& value) const {
+    return key_extractor_(value);
+  }
+  const key_type& get_key(const Node* node, size_type i) const {
+    return key_extractor_(node->slots[i].value);
+  }
+  const key_type& get_mutable_key(const mutable_value_type& value) const {
+    if constexpr (std::is_same_v<mutable_value_type, value_type>) {
+      return key_extractor_(value);
+    } else {
+      return value.first;
+    }
+  }
+};
+
+}  // namespace s21
+
+#include "s21_btree.tpp"
+
+#endif  // S21_BTREE_H_
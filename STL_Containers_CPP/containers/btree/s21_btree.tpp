@@ -0,0 +1,679 @@
+#ifndef S21_BTREE_TPP_
+#define S21_BTREE_TPP_
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <cstring>:
+ *  std::memmove: Shifts elements that can be relocated bytewise.
+ *
+ * From <limits>:
+ *  std::numeric_limits: The bound reported by max_size().
+ *
+ * From <memory>:
+ *  std::construct_at, std::destroy_at: Build and destroy elements in their
+ * slots.
+ *
+ * From <type_traits>:
+ *  std::is_trivially_move_constructible_v, std::is_trivially_destructible_v:
+ * Pick the bytewise shift.
+ *
+ * From <utility>:
+ *  std::exchange: Takes the nodes over in the move constructor and move
+ * assignment. std::move, std::forward: Pass elements on without copies.
+ * std::swap: Exchanges the members in swap().
+ */
+
+namespace s21 {
+
+#define BT_TEMPLATE_PARAMS \
+  template <typename K, typename T, typename Tr, typename Cmp, typename A>
+#define BT_CLASS BTree<K, T, Tr, Cmp, A>
+
+BT_TEMPLATE_PARAMS
+BT_CLASS::BTree(const Cmp& comp, const A& alloc)
+    : leaf_allocator_(alloc), internal_allocator_(alloc), key_compare_(comp) {}
+
+BT_TEMPLATE_PARAMS
+BT_CLASS::BTree(const BT_CLASS& other)
+    : leaf_allocator_(leaf_traits::select_on_container_copy_construction(
+          other.leaf_allocator_)),
+      internal_allocator_(
+          internal_traits::select_on_container_copy_construction(
+              other.internal_allocator_)),
+      key_extractor_(other.key_extractor_),
+      key_compare_(other.key_compare_) {
+  if (other.root_) {
+    root_ = leftmost_ = rightmost_ = copy_subtree(other.root_);
+    while (!leftmost_->leaf) leftmost_ = leftmost_->child(0);
+    while (!rightmost_->leaf) rightmost_ = rightmost_->child(rightmost_->count);
+    size_ = other.size_;
+  }
+}
+
+BT_TEMPLATE_PARAMS
+BT_CLASS::BTree(BT_CLASS&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      leftmost_(std::exchange(other.leftmost_, nullptr)),
+      rightmost_(std::exchange(other.rightmost_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      leaf_allocator_(std::move(other.leaf_allocator_)),
+      internal_allocator_(std::move(other.internal_allocator_)),
+      key_extractor_(std::move(other.key_extractor_)),
+      key_compare_(std::move(other.key_compare_)) {}
+
+BT_TEMPLATE_PARAMS
+BT_CLASS::~BTree() { clear(); }
+
+BT_TEMPLATE_PARAMS
+BT_CLASS& BT_CLASS::operator=(const BT_CLASS& other) {
+  if (this != &other) {
+    BT_CLASS temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+BT_TEMPLATE_PARAMS
+BT_CLASS& BT_CLASS::operator=(BT_CLASS&& other) noexcept {
+  if (this != &other) {
+    clear();
+    root_ = std::exchange(other.root_, nullptr);
+    leftmost_ = std::exchange(other.leftmost_, nullptr);
+    rightmost_ = std::exchange(other.rightmost_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    leaf_allocator_ = std::move(other.leaf_allocator_);
+    internal_allocator_ = std::move(other.internal_allocator_);
+    key_extractor_ = std::move(other.key_extractor_);
+    key_compare_ = std::move(other.key_compare_);
+  }
+  return *this;
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::size_type BT_CLASS::max_size() const noexcept {
+  return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(value_type);
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::size_type BT_CLASS::height() const noexcept {
+  size_type levels = 0;
+  for (const Node* node = root_; node; ++levels) {
+    node = node->leaf ? nullptr : node->child(0);
+  }
+  return levels;
+}
+
+BT_TEMPLATE_PARAMS
+void BT_CLASS::clear() noexcept {
+  if (root_) destroy_subtree(root_);
+  reset();
+}
+
+BT_TEMPLATE_PARAMS
+void BT_CLASS::reset() noexcept {
+  root_ = leftmost_ = rightmost_ = nullptr;
+  size_ = 0;
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup, typename... Args>
+std::pair<typename BT_CLASS::iterator, bool> BT_CLASS::try_emplace(
+    const Lookup& key, Args&&... args) {
+  if (!root_) {
+    return {insert_into_empty(mutable_value_type(std::forward<Args>(args)...)),
+            true};
+  }
+  SearchResult found = search(key);
+  if (found.found) return {iterator(found.node, found.position), false};
+  mutable_value_type value(std::forward<Args>(args)...);
+  return {insert_value(found.node, found.position, std::move(value)), true};
+}
+
+BT_TEMPLATE_PARAMS
+template <typename... Args>
+std::pair<typename BT_CLASS::iterator, bool> BT_CLASS::emplace(
+    Args&&... args) {
+  mutable_value_type value(std::forward<Args>(args)...);
+  if (!root_) return {insert_into_empty(std::move(value)), true};
+  SearchResult found = search(get_mutable_key(value));
+  if (found.found) return {iterator(found.node, found.position), false};
+  return {insert_value(found.node, found.position, std::move(value)), true};
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::iterator BT_CLASS::insert_into_empty(
+    mutable_value_type&& value) {
+  root_ = leftmost_ = rightmost_ = create_leaf();
+  return insert_value(root_, 0, std::move(value));
+}
+
+/*
+ * Puts value at slot 'position' of leaf 'node', splitting full nodes on the
+ * way up first. Splits only allocate before they change anything, so a
+ * failed allocation leaves a valid tree without the new element.
+ */
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::iterator BT_CLASS::insert_value(
+    Node* node, size_type position, mutable_value_type&& value) {
+  if (node->count == kNodeSlots) {
+    auto target = split(node, position);
+    node = target.first;
+    position = target.second;
+  }
+  shift_right(node, position);
+  std::construct_at(&node->slots[position].mutable_value, std::move(value));
+  ++node->count;
+  ++size_;
+  return iterator(node, position);
+}
+
+/*
+ * Splits the full node around a median that moves up into the parent (which
+ * is split first when it is full too, or created when node is the root) and
+ * returns where slot 'position' of the old node ended up. Appending at the
+ * end keeps the node full and starts the new one empty, prepending does the
+ * opposite, so sequential input leaves nodes full rather than half full.
+ */
+BT_TEMPLATE_PARAMS
+std::pair<typename BT_CLASS::Node*, typename BT_CLASS::size_type>
+BT_CLASS::split(Node* node, size_type position) {
+  Node* right = node->leaf ? create_leaf() : create_internal();
+  try {
+    if (node == root_) {
+      root_ = create_internal();
+      root_->set_child(0, node);
+    } else if (node->parent->count == kNodeSlots) {
+      split(node->parent, node->position);
+    }
+  } catch (...) {
+    destroy_node(right);
+    throw;
+  }
+
+  size_type moved = position == kNodeSlots ? 0
+                    : position == 0        ? kNodeSlots - 1
+                                           : kNodeSlots / 2;
+  size_type kept = kNodeSlots - moved;  // including the median
+  for (size_type i = 0; i < moved; ++i) {
+    relocate(right->slots[i], node->slots[kept + i]);
+  }
+  if (!node->leaf) {
+    for (size_type i = 0; i <= moved; ++i) {
+      right->set_child(i, node->child(kept + i));
+    }
+  }
+  right->count = static_cast<std::uint16_t>(moved);
+  node->count = static_cast<std::uint16_t>(kept - 1);
+
+  Node* parent = node->parent;
+  size_type at = node->position;
+  shift_right(parent, at);
+  for (size_type i = parent->count + 1; i > at + 1; --i) {
+    parent->set_child(i, parent->child(i - 1));
+  }
+  relocate(parent->slots[at], node->slots[kept - 1]);
+  parent->set_child(at + 1, right);
+  ++parent->count;
+  if (node == rightmost_) rightmost_ = right;
+
+  if (position <= node->count) return {node, position};
+  return {right, position - node->count - 1};
+}
+
+/*
+ * An element of an internal node is replaced by its predecessor, the last
+ * element of a leaf, so slots are only ever removed from leaves. Underfull
+ * nodes are then refilled bottom-up, see rebalance_after_erase().
+ */
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::iterator BT_CLASS::erase(const_iterator pos) {
+  Node* node = const_cast<Node*>(pos.get_node());
+  size_type position = pos.get_position();
+  bool internal = !node->leaf;
+  std::destroy_at(&node->slots[position].mutable_value);
+  if (internal) {
+    Node* leaf = node->child(position);
+    while (!leaf->leaf) leaf = leaf->child(leaf->count);
+    relocate(node->slots[position], leaf->slots[leaf->count - 1]);
+    node = leaf;
+    position = --leaf->count;
+  } else {
+    shift_left(node, position);
+    --node->count;
+  }
+  --size_;
+  iterator next = rebalance_after_erase(node, position);
+  // the predecessor now sits where the erased element was
+  if (internal) ++next;
+  return next;
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::size_type BT_CLASS::erase_key(const Lookup& key) {
+  if (!root_) return 0;
+  SearchResult found = search(key);
+  if (!found.found) return 0;
+  erase(const_iterator(found.node, found.position));
+  return 1;
+}
+
+/*
+ * Walks up from the leaf that lost a slot while nodes are below kMinSlots,
+ * merging each with a sibling or borrowing one element through the parent.
+ * (node, position) is followed through the first step, which is the only
+ * one that moves leaf elements, and names the element after the erased one.
+ */
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::iterator BT_CLASS::rebalance_after_erase(
+    Node* node, size_type position) {
+  Node* tracked = node;
+  while (node != root_ && node->count < kMinSlots) {
+    Node* parent = node->parent;
+    if (!merge_or_borrow(node, tracked, position)) break;
+    node = parent;
+  }
+  if (root_->count == 0) {
+    Node* old_root = root_;
+    if (old_root->leaf) {
+      reset();
+      destroy_node(old_root);
+      return end();
+    }
+    root_ = old_root->child(0);
+    root_->parent = nullptr;
+    root_->position = 0;
+    destroy_node(old_root);
+  }
+  return next_slot(tracked, position);
+}
+
+// Returns whether node was merged away, which may leave the parent short.
+BT_TEMPLATE_PARAMS
+bool BT_CLASS::merge_or_borrow(Node* node, Node*& tracked,
+                               size_type& position) {
+  Node* parent = node->parent;
+  size_type at = node->position;
+  Node* left = at > 0 ? parent->child(at - 1) : nullptr;
+  Node* right = at < parent->count ? parent->child(at + 1) : nullptr;
+  if (left && left->count + node->count < kNodeSlots) {
+    if (tracked == node) {
+      tracked = left;
+      position += left->count + 1;
+    }
+    merge_nodes(left, node);
+    return true;
+  }
+  if (right && node->count + right->count < kNodeSlots) {
+    merge_nodes(node, right);
+    return true;
+  }
+  if (right) {
+    borrow_from_right(node);
+  } else if (left) {
+    borrow_from_left(node);
+    if (tracked == node) ++position;
+  }
+  return false;
+}
+
+// Appends the parent's separator and all of right to left, frees right.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::merge_nodes(Node* left, Node* right) noexcept {
+  Node* parent = left->parent;
+  size_type at = left->position;
+  relocate(left->slots[left->count], parent->slots[at]);
+  for (size_type i = 0; i < right->count; ++i) {
+    relocate(left->slots[left->count + 1 + i], right->slots[i]);
+  }
+  if (!left->leaf) {
+    for (size_type i = 0; i <= right->count; ++i) {
+      left->set_child(left->count + 1 + i, right->child(i));
+    }
+  }
+  left->count = static_cast<std::uint16_t>(left->count + 1 + right->count);
+
+  shift_left(parent, at);
+  for (size_type i = at + 1; i < parent->count; ++i) {
+    parent->set_child(i, parent->child(i + 1));
+  }
+  --parent->count;
+  if (right == rightmost_) rightmost_ = left;
+  right->count = 0;
+  destroy_node(right);
+}
+
+// Rotates the separator down into node and the left sibling's last element
+// up in its place.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::borrow_from_left(Node* node) noexcept {
+  Node* parent = node->parent;
+  size_type at = node->position - 1;
+  Node* left = parent->child(at);
+  shift_right(node, 0);
+  relocate(node->slots[0], parent->slots[at]);
+  relocate(parent->slots[at], left->slots[left->count - 1]);
+  if (!node->leaf) {
+    for (size_type i = node->count + 1; i > 0; --i) {
+      node->set_child(i, node->child(i - 1));
+    }
+    node->set_child(0, left->child(left->count));
+  }
+  ++node->count;
+  --left->count;
+}
+
+BT_TEMPLATE_PARAMS
+void BT_CLASS::borrow_from_right(Node* node) noexcept {
+  Node* parent = node->parent;
+  size_type at = node->position;
+  Node* right = parent->child(at + 1);
+  relocate(node->slots[node->count], parent->slots[at]);
+  relocate(parent->slots[at], right->slots[0]);
+  shift_left(right, 0);
+  if (!node->leaf) {
+    node->set_child(node->count + 1, right->child(0));
+    for (size_type i = 0; i < right->count; ++i) {
+      right->set_child(i, right->child(i + 1));
+    }
+  }
+  ++node->count;
+  --right->count;
+}
+
+// The element at (node, position), climbing when that is past the node's
+// last slot; end() when nothing follows.
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::iterator BT_CLASS::next_slot(Node* node,
+                                                size_type position) noexcept {
+  while (position == node->count && node->parent) {
+    position = node->position;
+    node = node->parent;
+  }
+  if (position == node->count) return end();
+  return iterator(node, position);
+}
+
+BT_TEMPLATE_PARAMS
+void BT_CLASS::swap(BT_CLASS& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(leftmost_, other.leftmost_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+  if (leaf_traits::propagate_on_container_swap::value) {
+    std::swap(leaf_allocator_, other.leaf_allocator_);
+    std::swap(internal_allocator_, other.internal_allocator_);
+  }
+  std::swap(key_extractor_, other.key_extractor_);
+  std::swap(key_compare_, other.key_compare_);
+}
+
+/*
+ * Elements are moved, not copied: each one missing here is moved into its
+ * slot and then erased from other, O(m log(n + m)) for m = other.size().
+ */
+BT_TEMPLATE_PARAMS
+void BT_CLASS::merge(BT_CLASS& other) {
+  if (this == &other) return;
+  for (iterator it = other.begin(); it != other.end();) {
+    mutable_value_type& value =
+        it.get_node()->slots[it.get_position()].mutable_value;
+    if (!root_) {
+      insert_into_empty(std::move(value));
+    } else {
+      SearchResult found = search(get_key(*it));
+      if (found.found) {
+        ++it;
+        continue;
+      }
+      insert_value(found.node, found.position, std::move(value));
+    }
+    it = other.erase(it);
+  }
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::iterator BT_CLASS::find(const Lookup& key) {
+  if (!root_) return end();
+  SearchResult found = search(key);
+  return found.found ? iterator(found.node, found.position) : end();
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::const_iterator BT_CLASS::find(const Lookup& key) const {
+  if (!root_) return end();
+  SearchResult found = search(key);
+  return found.found ? const_iterator(found.node, found.position) : end();
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::iterator BT_CLASS::lower_bound(const Lookup& key) {
+  size_type position = 0;
+  Node* node = lower_bound_node(key, position);
+  return node ? iterator(node, position) : end();
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::const_iterator BT_CLASS::lower_bound(
+    const Lookup& key) const {
+  size_type position = 0;
+  Node* node = lower_bound_node(key, position);
+  return node ? const_iterator(node, position) : end();
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::iterator BT_CLASS::upper_bound(const Lookup& key) {
+  size_type position = 0;
+  Node* node = upper_bound_node(key, position);
+  return node ? iterator(node, position) : end();
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::const_iterator BT_CLASS::upper_bound(
+    const Lookup& key) const {
+  size_type position = 0;
+  Node* node = upper_bound_node(key, position);
+  return node ? const_iterator(node, position) : end();
+}
+
+// Needs a non-empty tree.
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::SearchResult BT_CLASS::search(const Lookup& key) const {
+  Node* node = root_;
+  while (true) {
+    size_type position = node_lower_bound(node, key);
+    if (position < node->count &&
+        !key_compare_(key, get_key(node, position))) {
+      return {node, position, true};
+    }
+    if (node->leaf) return {node, position, false};
+    node = node->child(position);
+  }
+}
+
+/*
+ * Branchless binary search over the slots of one node: the loop runs
+ * log2(count) times whatever the keys are, and the comparison only feeds a
+ * conditional move, so there are no mispredicted branches to pay for.
+ */
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::size_type BT_CLASS::node_lower_bound(
+    const Node* node, const Lookup& key) const {
+  size_type base = 0;
+  size_type length = node->count;
+  if (length == 0) return 0;
+  while (length > 1) {
+    size_type half = length / 2;
+    base = key_compare_(get_key(node, base + half - 1), key) ? base + half
+                                                             : base;
+    length -= half;
+  }
+  return base + (key_compare_(get_key(node, base), key) ? 1 : 0);
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::size_type BT_CLASS::node_upper_bound(
+    const Node* node, const Lookup& key) const {
+  size_type base = 0;
+  size_type length = node->count;
+  if (length == 0) return 0;
+  while (length > 1) {
+    size_type half = length / 2;
+    base = key_compare_(key, get_key(node, base + half - 1)) ? base
+                                                             : base + half;
+    length -= half;
+  }
+  return base + (key_compare_(key, get_key(node, base)) ? 0 : 1);
+}
+
+// The deepest slot that bounds key is the smallest one; nullptr if none.
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::Node* BT_CLASS::lower_bound_node(
+    const Lookup& key, size_type& position) const {
+  Node* result = nullptr;
+  for (Node* node = root_; node;) {
+    size_type i = node_lower_bound(node, key);
+    if (i < node->count) {
+      result = node;
+      position = i;
+    }
+    node = node->leaf ? nullptr : node->child(i);
+  }
+  return result;
+}
+
+BT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename BT_CLASS::Node* BT_CLASS::upper_bound_node(
+    const Lookup& key, size_type& position) const {
+  Node* result = nullptr;
+  for (Node* node = root_; node;) {
+    size_type i = node_upper_bound(node, key);
+    if (i < node->count) {
+      result = node;
+      position = i;
+    }
+    node = node->leaf ? nullptr : node->child(i);
+  }
+  return result;
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::Node* BT_CLASS::create_leaf() {
+  Node* node = leaf_traits::allocate(leaf_allocator_, 1);
+  leaf_traits::construct(leaf_allocator_, node);
+  return node;
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::Node* BT_CLASS::create_internal() {
+  InternalNode* node = internal_traits::allocate(internal_allocator_, 1);
+  internal_traits::construct(internal_allocator_, node);
+  return node;
+}
+
+// Destroys the node's elements and frees it; children are left alone.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::destroy_node(Node* node) noexcept {
+  for (size_type i = 0; i < node->count; ++i) {
+    std::destroy_at(&node->slots[i].mutable_value);
+  }
+  if (node->leaf) {
+    leaf_traits::destroy(leaf_allocator_, node);
+    leaf_traits::deallocate(leaf_allocator_, node, 1);
+  } else {
+    InternalNode* internal = static_cast<InternalNode*>(node);
+    internal_traits::destroy(internal_allocator_, internal);
+    internal_traits::deallocate(internal_allocator_, internal, 1);
+  }
+}
+
+// Recursion depth is the height, a handful of levels for any size.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::destroy_subtree(Node* node) noexcept {
+  if (!node->leaf) {
+    for (size_type i = 0; i <= node->count; ++i) {
+      if (Node* child = node->child(i)) destroy_subtree(child);
+    }
+  }
+  destroy_node(node);
+}
+
+BT_TEMPLATE_PARAMS
+typename BT_CLASS::Node* BT_CLASS::copy_subtree(const Node* source) {
+  Node* node = source->leaf ? create_leaf() : create_internal();
+  try {
+    for (; node->count < source->count; ++node->count) {
+      std::construct_at(&node->slots[node->count].mutable_value,
+                        source->slots[node->count].value);
+    }
+    if (!source->leaf) {
+      for (size_type i = 0; i <= source->count; ++i) {
+        node->set_child(i, copy_subtree(source->child(i)));
+      }
+    }
+  } catch (...) {
+    destroy_subtree(node);
+    throw;
+  }
+  return node;
+}
+
+BT_TEMPLATE_PARAMS
+void BT_CLASS::relocate(BTreeSlot<value_type>& to,
+                        BTreeSlot<value_type>& from) noexcept {
+  std::construct_at(&to.mutable_value, std::move(from.mutable_value));
+  std::destroy_at(&from.mutable_value);
+}
+
+// Opens slot 'position' by moving the slots from there on one to the right.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::shift_right(Node* node, size_type position) noexcept {
+  if constexpr (std::is_trivially_move_constructible_v<mutable_value_type> &&
+                std::is_trivially_destructible_v<mutable_value_type>) {
+    std::memmove(static_cast<void*>(node->slots + position + 1),
+                 static_cast<const void*>(node->slots + position),
+                 (node->count - position) * sizeof(node->slots[0]));
+  } else {
+    for (size_type i = node->count; i > position; --i) {
+      relocate(node->slots[i], node->slots[i - 1]);
+    }
+  }
+}
+
+// Closes the empty slot 'position' by moving the later slots to the left.
+BT_TEMPLATE_PARAMS
+void BT_CLASS::shift_left(Node* node, size_type position) noexcept {
+  if constexpr (std::is_trivially_move_constructible_v<mutable_value_type> &&
+                std::is_trivially_destructible_v<mutable_value_type>) {
+    std::memmove(static_cast<void*>(node->slots + position),
+                 static_cast<const void*>(node->slots + position + 1),
+                 (node->count - position - 1) * sizeof(node->slots[0]));
+  } else {
+    for (size_type i = position; i + 1 < node->count; ++i) {
+      relocate(node->slots[i], node->slots[i + 1]);
+    }
+  }
+}
+
+#undef BT_TEMPLATE_PARAMS
+#undef BT_CLASS
+
+}  // namespace s21
+
+#endif  // S21_BTREE_TPP_
@@ -0,0 +1,117 @@
+#ifndef S21_BTREE_ITERATOR_H_
+#define S21_BTREE_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/*
+ * From <iterator>:
+ *  std::bidirectional_iterator_tag: The iterator category.
+ *
+ * From <type_traits>:
+ *  std::conditional_t: Picks const or non-const node and element types
+ *    depending on 'IsConst'.
+ */
+
+#include "s21_btree_node.h"
+
+namespace s21 {
+
+/*
+ * Position of an element: a node and a slot index. end() is one past the
+ * last slot of the rightmost leaf. Moving past the end of a node climbs to
+ * the first ancestor that still has elements to the right; moving from an
+ * internal slot descends to the leftmost leaf of the next child.
+ *
+ * Inserting or erasing may move elements between nodes and so invalidates
+ * all iterators of the tree.
+ */
+template <typename T, bool IsConst>
+class BTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+  using Node = BTreeNode<T>;
+  using node_pointer = std::conditional_t<IsConst, const Node*, Node*>;
+
+  BTreeIterator() = default;
+  BTreeIterator(node_pointer node, std::size_t position)
+      : node_(node), position_(position) {}
+
+  operator BTreeIterator<T, true>() const {
+    return BTreeIterator<T, true>(node_, position_);
+  }
+
+  reference operator*() const { return node_->slots[position_].value; }
+  pointer operator->() const { return &node_->slots[position_].value; }
+
+  BTreeIterator& operator++() {
+    if (!node_->leaf) {
+      node_ = node_->child(position_ + 1);
+      while (!node_->leaf) node_ = node_->child(0);
+      position_ = 0;
+    } else if (++position_ == node_->count) {
+      // climb to the next ancestor slot; stay at end() if there is none
+      node_pointer node = node_;
+      std::size_t position = position_;
+      while (position == node->count && node->parent) {
+        position = node->position;
+        node = node->parent;
+      }
+      if (position != node->count) {
+        node_ = node;
+        position_ = position;
+      }
+    }
+    return *this;
+  }
+
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  BTreeIterator& operator--() {
+    if (!node_->leaf) {
+      node_ = node_->child(position_);
+      while (!node_->leaf) node_ = node_->child(node_->count);
+      position_ = node_->count - 1;
+    } else if (position_ > 0) {
+      --position_;
+    } else {
+      while (position_ == 0 && node_->parent) {
+        position_ = node_->position;
+        node_ = node_->parent;
+      }
+      --position_;
+    }
+    return *this;
+  }
+
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  template <bool OtherIsConst>
+  bool operator==(const BTreeIterator<T, OtherIsConst>& other) const {
+    return node_ == other.get_node() && position_ == other.get_position();
+  }
+
+  node_pointer get_node() const { return node_; }
+  std::size_t get_position() const { return position_; }
+
+ private:
+  node_pointer node_ = nullptr;
+  std::size_t position_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_BTREE_ITERATOR_H_
@@ -0,0 +1,99 @@
+#ifndef S21_BTREE_NODE_H_
+#define S21_BTREE_NODE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/*
+ * From <algorithm>:
+ *  std::max: Keeps at least three slots per node for very large elements.
+ *
+ * From <cstdint>:
+ *  std::uint16_t: Element count and position of a node in its parent.
+ *
+ * From <utility>:
+ *  std::pair: Map elements, whose key is const for users but not inside the
+ *    tree (see BTreeSlot).
+ */
+
+namespace s21 {
+
+// The element as stored while the tree moves it around: a map's
+// pair<const K, V> with a mutable key, anything else as it is.
+template <typename T>
+struct btree_mutable_value {
+  using type = T;
+};
+template <typename K, typename V>
+struct btree_mutable_value<std::pair<const K, V>> {
+  using type = std::pair<K, V>;
+};
+
+/*
+ * Storage for one element. The tree constructs and relocates elements
+ * through 'mutable_value', so shifting a map's elements inside a node moves
+ * keys instead of copying them; users only ever see 'value'. Both members
+ * have the same layout (the technique of abseil's btree and libc++'s map).
+ */
+template <typename T>
+union BTreeSlot {
+  using mutable_type = typename btree_mutable_value<T>::type;
+
+  BTreeSlot() noexcept {}
+  ~BTreeSlot() {}
+
+  T value;
+  mutable_type mutable_value;
+};
+
+/*
+ * A B-tree node: up to kSlots sorted elements in one block of about
+ * kTargetBytes, so a lookup touches a few cache lines per level instead of
+ * one node per comparison. Leaves are plain BTreeNodes; internal nodes are
+ * BTreeInternalNodes, which add kSlots + 1 child pointers. Child i holds
+ * the elements between slots i - 1 and i.
+ */
+template <typename T>
+struct BTreeNode {
+  static constexpr std::size_t kTargetBytes = 256;
+  static constexpr std::size_t kSlots =
+      std::max<std::size_t>(3, (kTargetBytes - 16) / sizeof(T));
+
+  BTreeNode* parent = nullptr;
+  std::uint16_t position = 0;  // index among the parent's children
+  std::uint16_t count = 0;
+  bool leaf = true;
+  BTreeSlot<T> slots[kSlots];
+
+  BTreeNode() = default;
+  explicit BTreeNode(bool is_leaf) : leaf(is_leaf) {}
+
+  BTreeNode* child(std::size_t i) const noexcept;
+  void set_child(std::size_t i, BTreeNode* node) noexcept;
+};
+
+template <typename T>
+struct BTreeInternalNode : BTreeNode<T> {
+  BTreeInternalNode() : BTreeNode<T>(false) {}
+
+  BTreeNode<T>* children[BTreeNode<T>::kSlots + 1] = {};
+};
+
+template <typename T>
+BTreeNode<T>* BTreeNode<T>::child(std::size_t i) const noexcept {
+  return static_cast<const BTreeInternalNode<T>*>(this)->children[i];
+}
+
+// Hangs node at index i and keeps its parent link and position in sync.
+template <typename T>
+void BTreeNode<T>::set_child(std::size_t i, BTreeNode* node) noexcept {
+  static_cast<BTreeInternalNode<T>*>(this)->children[i] = node;
+  node->parent = this;
+  node->position = static_cast<std::uint16_t>(i);
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_NODE_H_
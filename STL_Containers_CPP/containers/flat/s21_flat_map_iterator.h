@@ -0,0 +1,158 @@
+#ifndef S21_FLAT_MAP_ITERATOR_H_
+#define S21_FLAT_MAP_ITERATOR_H_
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <compare>:
+ *  std::strong_ordering: The result of comparing two positions.
+ *
+ * From <concepts>, <type_traits>:
+ *  std::basic_common_reference, std::convertible_to: Tell the iterator
+ *    concepts that the proxy reference and value_type are interchangeable.
+ *  std::conditional_t: Picks const or non-const mapped values depending on
+ *    'IsConst'.
+ *
+ * From <iterator>:
+ *  std::random_access_iterator_tag: The iterator category.
+ *
+ * From <utility>:
+ *  std::pair: The value_type, which the proxy reference converts to.
+ */
+
+namespace s21 {
+
+// What dereferencing a flat_map iterator yields: references to a key and to
+// the mapped value stored at the same position of the two arrays.
+template <typename Key, typename Mapped>
+struct FlatMapReference {
+  const Key& first;
+  Mapped& second;
+
+  template <typename T>
+    requires std::convertible_to<const Mapped&, T>
+  operator std::pair<Key, T>() const {
+    return std::pair<Key, T>(first, second);
+  }
+};
+
+/*
+ * Iterator of flat_map. Keys and mapped values live in separate arrays, so
+ * there is no pair object to point at: dereferencing yields a pair of
+ * references (key, mapped value), and operator-> a small holder of that
+ * pair, so it->first and it->second work as they do for s21::map. Bind the
+ * result of *it by value or const reference (const auto& [k, v] = *it).
+ * The pair of references converts to value_type when a copy is needed.
+ */
+template <typename Key, typename T, bool IsConst>
+class FlatMapIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using mapped_pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference =
+      FlatMapReference<Key, std::conditional_t<IsConst, const T, T>>;
+
+  struct pointer {
+    reference ref;
+    const reference* operator->() const noexcept { return &ref; }
+  };
+
+  FlatMapIterator() = default;
+  FlatMapIterator(const Key* key, mapped_pointer value)
+      : key_(key), value_(value) {}
+
+  operator FlatMapIterator<Key, T, true>() const {
+    return FlatMapIterator<Key, T, true>(key_, value_);
+  }
+
+  reference operator*() const { return reference(*key_, *value_); }
+  pointer operator->() const { return pointer{**this}; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  FlatMapIterator& operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+  FlatMapIterator operator++(int) {
+    FlatMapIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  FlatMapIterator& operator--() {
+    --key_;
+    --value_;
+    return *this;
+  }
+  FlatMapIterator operator--(int) {
+    FlatMapIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+  FlatMapIterator& operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+  FlatMapIterator& operator-=(difference_type n) { return *this += -n; }
+  friend FlatMapIterator operator+(FlatMapIterator it, difference_type n) {
+    return it += n;
+  }
+  friend FlatMapIterator operator+(difference_type n, FlatMapIterator it) {
+    return it += n;
+  }
+  friend FlatMapIterator operator-(FlatMapIterator it, difference_type n) {
+    return it -= n;
+  }
+  template <bool OtherIsConst>
+  difference_type operator-(
+      const FlatMapIterator<Key, T, OtherIsConst>& other) const {
+    return key_ - other.key_pointer();
+  }
+
+  template <bool OtherIsConst>
+  bool operator==(const FlatMapIterator<Key, T, OtherIsConst>& other) const {
+    return key_ == other.key_pointer();
+  }
+  template <bool OtherIsConst>
+  std::strong_ordering operator<=>(
+      const FlatMapIterator<Key, T, OtherIsConst>& other) const {
+    return key_ <=> other.key_pointer();
+  }
+
+  const Key* key_pointer() const { return key_; }
+
+ private:
+  const Key* key_ = nullptr;
+  mapped_pointer value_ = nullptr;
+};
+
+}  // namespace s21
+
+// The common reference of a proxy reference and value_type is value_type,
+// which is what std::indirectly_readable asks for.
+template <typename Key, typename Mapped, typename T,
+          template <typename> class TQual, template <typename> class UQual>
+  requires std::same_as<std::remove_const_t<Mapped>, T>
+struct std::basic_common_reference<s21::FlatMapReference<Key, Mapped>,
+                                   std::pair<Key, T>, TQual, UQual> {
+  using type = std::pair<Key, T>;
+};
+
+template <typename Key, typename Mapped, typename T,
+          template <typename> class TQual, template <typename> class UQual>
+  requires std::same_as<std::remove_const_t<Mapped>, T>
+struct std::basic_common_reference<std::pair<Key, T>,
+                                   s21::FlatMapReference<Key, Mapped>, TQual,
+                                   UQual> {
+  using type = std::pair<Key, T>;
+};
+
+#endif  // S21_FLAT_MAP_ITERATOR_H_
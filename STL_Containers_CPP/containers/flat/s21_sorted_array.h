@@ -0,0 +1,151 @@
+#ifndef S21_SORTED_ARRAY_H_
+#define S21_SORTED_ARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/*
+ * From <algorithm>:
+ *  std::stable_sort, std::is_sorted, std::adjacent_find: Order bulk input;
+ *    the stable sort keeps the first of several equal keys in front.
+ *
+ * From <numeric>:
+ *  std::iota: The identity permutation sorted by key in sort_unique().
+ *
+ * From <stdexcept>:
+ *  std::invalid_argument: Thrown when input tagged sorted_unique is not.
+ *
+ * From <vector>:
+ *  std::vector: The permutation of a key/value pair of arrays.
+ */
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Helpers shared by flat_map and flat_set, which keep their keys in one
+ * sorted s21::vector.
+ *
+ * The searches are branchless: each step halves the range with a
+ * conditional move instead of a branch the predictor has to guess, and the
+ * loop runs log2(n) times whatever the keys are. On arrays larger than the
+ * caches the next two candidate probes are prefetched, so the next memory
+ * access overlaps with the current comparison.
+ */
+template <typename Key, typename Lookup, typename Compare>
+std::size_t sorted_lower_bound(const Key* keys, std::size_t n,
+                               const Lookup& key, const Compare& comp) {
+  if (n == 0) return 0;
+  const Key* base = keys;
+  while (n > 1) {
+    std::size_t half = n / 2;
+#if defined(__GNUC__)
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+#endif
+    base = comp(base[half - 1], key) ? base + half : base;
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - keys) + (comp(*base, key) ? 1 : 0);
+}
+
+template <typename Key, typename Lookup, typename Compare>
+std::size_t sorted_upper_bound(const Key* keys, std::size_t n,
+                               const Lookup& key, const Compare& comp) {
+  if (n == 0) return 0;
+  const Key* base = keys;
+  while (n > 1) {
+    std::size_t half = n / 2;
+#if defined(__GNUC__)
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+#endif
+    base = comp(key, base[half - 1]) ? base : base + half;
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - keys) + (comp(key, *base) ? 0 : 1);
+}
+
+// Drops all but the first of each run of equal keys from sorted keys (and
+// the values at the same positions).
+template <typename Key, typename Compare, typename... Values>
+void sorted_unique_compact(vector<Key>& keys, const Compare& comp,
+                           vector<Values>&... values) {
+  std::size_t n = keys.size();
+  if (n < 2) return;
+  Key* k = keys.data();
+  std::size_t kept = 1;
+  for (std::size_t i = 1; i < n; ++i) {
+    if (comp(k[kept - 1], k[i])) {
+      if (kept != i) {
+        k[kept] = std::move(k[i]);
+        ((values.data()[kept] = std::move(values.data()[i])), ...);
+      }
+      ++kept;
+    }
+  }
+  for (; n > kept; --n) {
+    keys.pop_back();
+    (values.pop_back(), ...);
+  }
+}
+
+// Sorts keys and drops duplicates, keeping the earliest of equal keys.
+template <typename Key, typename Compare>
+void sort_unique(vector<Key>& keys, const Compare& comp) {
+  if (!std::is_sorted(keys.begin(), keys.end(), comp)) {
+    std::stable_sort(keys.begin(), keys.end(), comp);
+  }
+  sorted_unique_compact(keys, comp);
+}
+
+// The same for parallel key and value arrays: the keys are sorted through
+// a permutation that is then applied to both, each element moved once.
+template <typename Key, typename T, typename Compare>
+void sort_unique(vector<Key>& keys, vector<T>& values, const Compare& comp) {
+  if (!std::is_sorted(keys.begin(), keys.end(), comp)) {
+    const Key* k = keys.data();
+    std::vector<std::size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) {
+                       return comp(k[a], k[b]);
+                     });
+    vector<Key> sorted_keys;
+    vector<T> sorted_values;
+    sorted_keys.reserve(order.size());
+    sorted_values.reserve(order.size());
+    for (std::size_t i : order) {
+      if (sorted_keys.empty() ||
+          comp(sorted_keys.data()[sorted_keys.size() - 1], k[i])) {
+        sorted_keys.push_back(std::move(keys.data()[i]));
+        sorted_values.push_back(std::move(values.data()[i]));
+      }
+    }
+    keys.swap(sorted_keys);
+    values.swap(sorted_values);
+  } else {
+    sorted_unique_compact(keys, comp, values);
+  }
+}
+
+// For input tagged sorted_unique: one linear check instead of a sort.
+template <typename Key, typename Compare>
+void check_sorted_unique(const vector<Key>& keys, const Compare& comp) {
+  auto not_ascending = [&](const Key& a, const Key& b) {
+    return !comp(a, b);
+  };
+  if (std::adjacent_find(keys.begin(), keys.end(), not_ascending) !=
+      keys.end()) {
+    throw std::invalid_argument("sorted_unique: input is not sorted");
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_SORTED_ARRAY_H_
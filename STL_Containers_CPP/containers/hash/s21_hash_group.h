@@ -0,0 +1,207 @@
+#ifndef S21_HASH_GROUP_H_
+#define S21_HASH_GROUP_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * From <bit>:
+ *  std::countr_zero, std::countr_one, std::endian: Turn match masks into
+ *    slot indices.
+ *
+ * From <cstdint>:
+ *  std::int8_t, std::uint32_t, std::uint64_t: Control bytes and the masks
+ *    built from a group of them.
+ *
+ * From <cstring>:
+ *  std::memcpy: Loads a group of control bytes into a word in the portable
+ *    version.
+ *
+ * From <immintrin.h>:
+ *  _mm_cmpeq_epi8, _mm_movemask_epi8 and their 256-bit forms: Compare a
+ *    whole group of control bytes at once.
+ *
+ * From <utility>:
+ *  std::pair: Map elements, whose key is const for users but not inside the
+ *    table (see HashSlot).
+ */
+
+namespace s21 {
+
+/*
+ * The metadata of SwissTable: one control byte per slot. A full slot holds
+ * the low 7 bits of its element's hash (H2), so a probe compares 16 or 32
+ * slots with one SIMD instruction and only looks at the elements whose H2
+ * matches. Free slots are kEmpty; kSentinel marks the end of the slots and
+ * stops iteration. There are no tombstones: erase shifts elements back
+ * instead (see SwissTable::erase).
+ */
+using ctrl_t = std::int8_t;
+
+inline constexpr ctrl_t kEmpty = -128;    // 0b10000000
+inline constexpr ctrl_t kSentinel = -1;   // 0b11111111
+
+/*
+ * The positions that matched in a group, one bit per slot (every 8th bit in
+ * the portable version, Shift = 3), visited lowest first.
+ */
+template <typename Mask, int Shift>
+class HashBitMask {
+ public:
+  explicit HashBitMask(Mask mask) : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+  std::size_t lowest() const noexcept {
+    return static_cast<std::size_t>(std::countr_zero(mask_)) >> Shift;
+  }
+  void clear_lowest() noexcept { mask_ &= mask_ - 1; }
+
+ private:
+  Mask mask_;
+};
+
+#if defined(__AVX2__)
+
+struct HashGroup {
+  static constexpr std::size_t kWidth = 32;
+  using BitMask = HashBitMask<std::uint32_t, 0>;
+
+  explicit HashGroup(const ctrl_t* ctrl)
+      : ctrl_(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl))) {}
+
+  BitMask match(ctrl_t h2) const {
+    return BitMask(static_cast<std::uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(ctrl_, _mm256_set1_epi8(h2)))));
+  }
+  // Empty slots and the sentinel, i.e. every byte with the sign bit set.
+  BitMask match_non_full() const {
+    return BitMask(static_cast<std::uint32_t>(_mm256_movemask_epi8(ctrl_)));
+  }
+  std::size_t count_leading_empty() const {
+    std::uint32_t empty = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(ctrl_, _mm256_set1_epi8(kEmpty))));
+    return static_cast<std::size_t>(std::countr_one(empty));
+  }
+
+  __m256i ctrl_;
+};
+
+#elif defined(__SSE2__)
+
+struct HashGroup {
+  static constexpr std::size_t kWidth = 16;
+  using BitMask = HashBitMask<std::uint32_t, 0>;
+
+  explicit HashGroup(const ctrl_t* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  BitMask match(ctrl_t h2) const {
+    return BitMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2)))));
+  }
+  // Empty slots and the sentinel, i.e. every byte with the sign bit set.
+  BitMask match_non_full() const {
+    return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)));
+  }
+  std::size_t count_leading_empty() const {
+    std::uint32_t empty = static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(kEmpty))));
+    return static_cast<std::size_t>(std::countr_one(empty));
+  }
+
+  __m128i ctrl_;
+};
+
+#else
+
+// Eight control bytes in a 64-bit word, compared with bit tricks.
+struct HashGroup {
+  static constexpr std::size_t kWidth = 8;
+  using BitMask = HashBitMask<std::uint64_t, 3>;
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ULL;
+
+  explicit HashGroup(const ctrl_t* ctrl) {
+    std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+    if constexpr (std::endian::native == std::endian::big) {
+      ctrl_ = __builtin_bswap64(ctrl_);
+    }
+  }
+
+  // May report a false match after a true one; the caller compares keys.
+  BitMask match(ctrl_t h2) const {
+    std::uint64_t x =
+        ctrl_ ^ (kLsbs * static_cast<std::uint8_t>(h2));
+    return BitMask((x - kLsbs) & ~x & kMsbs);
+  }
+  BitMask match_non_full() const { return BitMask(ctrl_ & kMsbs); }
+  std::size_t count_leading_empty() const {
+    // empty is the only control byte with bit 7 set and bit 1 clear
+    std::uint64_t empty = ctrl_ & ~(ctrl_ << 6) & kMsbs;
+    return static_cast<std::size_t>(std::countr_zero(~empty & kMsbs)) >> 3;
+  }
+
+  std::uint64_t ctrl_;
+};
+
+#endif
+
+/*
+ * Spreads the bits of a hash over the whole word: std::hash of an integer
+ * is the integer itself, and the table takes H2 from the low bits and the
+ * home slot from the ones above.
+ */
+inline std::size_t hash_mix(std::size_t hash) noexcept {
+  constexpr std::uint64_t kMultiplier = 0x9E3779B97F4A7C15ULL;
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product =
+      static_cast<unsigned __int128>(hash) * kMultiplier;
+  return static_cast<std::size_t>(static_cast<std::uint64_t>(product) ^
+                                  static_cast<std::uint64_t>(product >> 64));
+#else
+  std::uint64_t x = static_cast<std::uint64_t>(hash) * kMultiplier;
+  return static_cast<std::size_t>(x ^ (x >> 32));
+#endif
+}
+
+inline ctrl_t hash_h2(std::size_t mixed) noexcept {
+  return static_cast<ctrl_t>(mixed & 0x7F);
+}
+
+// The element as stored while the table moves it around: a map's
+// pair<const K, V> with a mutable key, anything else as it is.
+template <typename T>
+struct hash_mutable_value {
+  using type = T;
+};
+template <typename K, typename V>
+struct hash_mutable_value<std::pair<const K, V>> {
+  using type = std::pair<K, V>;
+};
+
+/*
+ * Storage for one element. The table constructs and relocates elements
+ * through 'mutable_value' so that moving a map's elements moves their keys
+ * too; users only ever see 'value' (the same technique as BTreeSlot).
+ */
+template <typename T>
+union HashSlot {
+  using mutable_type = typename hash_mutable_value<T>::type;
+
+  HashSlot() noexcept {}
+  ~HashSlot() {}
+
+  T value;
+  mutable_type mutable_value;
+};
+
+}  // namespace s21
+
+#endif  // S21_HASH_GROUP_H_
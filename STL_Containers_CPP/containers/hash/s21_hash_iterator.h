@@ -0,0 +1,90 @@
+#ifndef S21_HASH_ITERATOR_H_
+#define S21_HASH_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/*
+ * From <iterator>:
+ *  std::forward_iterator_tag: The iterator category.
+ *
+ * From <type_traits>:
+ *  std::conditional_t: Picks const or non-const slot and element types
+ *    depending on 'IsConst'.
+ */
+
+#include "s21_hash_group.h"
+
+namespace s21 {
+
+/*
+ * Position of an element of SwissTable: its control byte and its slot,
+ * which sit at the same index of the two arrays. Advancing skips whole runs
+ * of empty slots a group at a time and stops at the sentinel that follows
+ * the last slot, which is end().
+ *
+ * Inserting may rehash and so invalidates all iterators; erasing shifts
+ * the elements that follow the erased one in its cluster back (see
+ * SwissTable::erase).
+ */
+template <typename T, bool IsConst>
+class HashIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+  using Slot = HashSlot<T>;
+  using slot_pointer = std::conditional_t<IsConst, const Slot*, Slot*>;
+
+  HashIterator() = default;
+  HashIterator(const ctrl_t* ctrl, slot_pointer slot)
+      : ctrl_(ctrl), slot_(slot) {}
+
+  operator HashIterator<T, true>() const {
+    return HashIterator<T, true>(ctrl_, slot_);
+  }
+
+  reference operator*() const { return slot_->value; }
+  pointer operator->() const { return &slot_->value; }
+
+  HashIterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    skip_empty();
+    return *this;
+  }
+
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  template <bool OtherIsConst>
+  bool operator==(const HashIterator<T, OtherIsConst>& other) const {
+    return ctrl_ == other.get_ctrl();
+  }
+
+  // Moves forward to the first full slot or the sentinel.
+  void skip_empty() {
+    while (*ctrl_ == kEmpty) {
+      std::size_t shift = HashGroup(ctrl_).count_leading_empty();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+  }
+
+  const ctrl_t* get_ctrl() const { return ctrl_; }
+  slot_pointer get_slot() const { return slot_; }
+
+ private:
+  const ctrl_t* ctrl_ = nullptr;
+  slot_pointer slot_ = nullptr;
+};
+
+}  // namespace s21
+
+#endif  // S21_HASH_ITERATOR_H_
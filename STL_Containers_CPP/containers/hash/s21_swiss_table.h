@@ -0,0 +1,211 @@
+#ifndef S21_SWISS_TABLE_H_
+#define S21_SWISS_TABLE_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <functional>:
+ *  std::hash, std::equal_to: The default hash function and key equality.
+ *
+ * From <memory>:
+ *  std::allocator, std::allocator_traits: Allocate the control bytes and
+ *    the slots through rebound copies of 'Allocator'.
+ *
+ * From <type_traits>:
+ *  std::is_same_v: Tells sets, whose stored element is the value_type, from
+ *    maps, whose stored element has a mutable key.
+ *
+ * From <utility>:
+ *  std::pair: Returned by try_emplace() and emplace() to bundle an iterator
+ *    and whether the element was inserted.
+ */
+
+#include "s21_hash_group.h"
+#include "s21_hash_iterator.h"
+
+namespace s21 {
+
+/*
+ * An open-addressing hash table of unique keys in the Swiss-table layout,
+ * the engine behind unordered_map and unordered_set. Elements live in one
+ * flat array of slots; a parallel array of control bytes holds 7 bits of
+ * each element's hash (see HashGroup), so a lookup compares a whole group
+ * of 16 (SSE2) or 32 (AVX2) candidates with one instruction and touches
+ * the slots themselves only for the few whose bits match.
+ *
+ * An element's home slot is taken from its hash, and it sits at the first
+ * free slot from there on (linear probing); a lookup stops at the first
+ * group with a free slot. Probing never wraps around: the home slots
+ * are followed by a tail of overflow slots and a sentinel, and an
+ * insert that would run past the tail grows the table instead. Because of
+ * that, erase needs no tombstones: it shifts the rest of the cluster back
+ * into the hole (backward-shift deletion), so lookups never wade through
+ * deleted slots and the table never has to be cleaned up. The elements it
+ * shifts only ever move towards the front, so a loop of it = erase(it)
+ * still visits every element exactly once.
+ *
+ * Inserting invalidates all iterators and references when it rehashes;
+ * erasing invalidates those to elements of the same cluster after the
+ * erased one. Moving an element is assumed not to throw; an element is
+ * fully built and all memory allocated before the table changes.
+ *
+ *Key type,
+ *Value type,
+ *Traits functor get key from value: SetTraits, MapTraits.
+ *Hash, KeyEqual functors std::hash, std::equal_to and others
+ *Allocator class for memory handling, rebound to the slot and control types
+ */
+template <typename Key, typename T, typename Traits,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<T>>
+class SwissTable {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  using Slot = HashSlot<value_type>;
+  using mutable_value_type = typename Slot::mutable_type;
+  using iterator = HashIterator<value_type, false>;
+  using const_iterator = HashIterator<value_type, true>;
+
+  static constexpr size_type kGroupWidth = HashGroup::kWidth;
+  static constexpr size_type kMinCapacity = 16;
+  static constexpr float kDefaultMaxLoadFactor = 0.875f;
+
+  explicit SwissTable(size_type bucket_count = 0, const Hash& hash = Hash(),
+                      const KeyEqual& equal = KeyEqual(),
+                      const Allocator& alloc = Allocator());
+  SwissTable(const SwissTable& other);
+  SwissTable(SwissTable&& other) noexcept;
+  ~SwissTable();
+
+  SwissTable& operator=(const SwissTable& other);
+  SwissTable& operator=(SwissTable&& other) noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept {
+    return iterator(ctrl_end(), slots_ + slots_count_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(ctrl_end(), slots_ + slots_count_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  // Hashes key first and builds the element from args only when no equal
+  // key is present; args must produce an element with that key.
+  template <typename Lookup, typename... Args>
+  std::pair<iterator, bool> try_emplace(const Lookup& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  template <typename Lookup>
+  size_type erase_key(const Lookup& key);
+  void swap(SwissTable& other) noexcept;
+  // Moves every element of other whose key is not present here.
+  void merge(SwissTable& other);
+
+  template <typename Lookup>
+  iterator find(const Lookup& key);
+  template <typename Lookup>
+  const_iterator find(const Lookup& key) const;
+
+  // Hash policy. The bucket count is the number of home slots, a power of
+  // two; the table grows (doubling it) before size() would exceed
+  // bucket_count() * max_load_factor().
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept;
+  float max_load_factor() const noexcept { return max_load_factor_; }
+  // Throws std::invalid_argument unless 0 < ml <= 1.
+  void max_load_factor(float ml);
+  // At least count buckets and enough for size(); may shrink the table.
+  void rehash(size_type count);
+  // Room for count elements without a rehash.
+  void reserve(size_type count);
+  Hash hash_function() const { return hasher_; }
+  KeyEqual key_eq() const { return key_equal_; }
+
+ private:
+  using ctrl_allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<ctrl_t>;
+  using slot_allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator_type>;
+  using slot_traits = std::allocator_traits<slot_allocator_type>;
+
+  ctrl_t* ctrl_ = nullptr;  // slots_count_ bytes, the sentinel, padding
+  Slot* slots_ = nullptr;
+  size_type capacity_ = 0;     // home slots, 0 or a power of two
+  size_type slots_count_ = 0;  // home slots and the overflow tail
+  size_type size_ = 0;
+  size_type growth_limit_ = 0;  // elements allowed before growing
+  float max_load_factor_ = kDefaultMaxLoadFactor;
+  ctrl_allocator_type ctrl_allocator_;
+  slot_allocator_type slot_allocator_;
+  [[no_unique_address]] Hash hasher_;
+  [[no_unique_address]] KeyEqual key_equal_;
+  [[no_unique_address]] Traits key_extractor_;
+
+  static constexpr size_type kNotFound = static_cast<size_type>(-1);
+
+  const ctrl_t* ctrl_end() const noexcept;
+  static size_type tail_for(size_type capacity) noexcept {
+    return capacity / 8 + kGroupWidth;
+  }
+  size_type capacity_for(size_type count) const;
+  size_type home_of(size_type mixed) const noexcept {
+    return (mixed >> 7) & (capacity_ - 1);
+  }
+  template <typename Lookup>
+  size_type mixed_hash(const Lookup& key) const {
+    return hash_mix(static_cast<size_type>(hasher_(key)));
+  }
+
+  template <typename Lookup>
+  size_type find_index(const Lookup& key, size_type mixed) const;
+  static size_type find_free(const ctrl_t* ctrl, size_type home) noexcept;
+  iterator insert_new(size_type mixed, mutable_value_type&& value);
+  void erase_at(size_type index) noexcept;
+  void resize(size_type new_capacity);
+  void release() noexcept;
+  void destroy_elements() noexcept;
+  ctrl_t* allocate_ctrl(size_type slots_count);
+  iterator iterator_at(size_type index) noexcept {
+    return iterator(ctrl_ + index, slots_ + index);
+  }
+
+  const key_type& get_key(const value_type& value) const {
+    return key_extractor_(value);
+  }
+  const key_type& get_key(size_type index) const {
+    return key_extractor_(slots_[index].value);
+  }
+  const key_type& get_mutable_key(const mutable_value_type& value) const {
+    if constexpr (std::is_same_v<mutable_value_type, value_type>) {
+      return key_extractor_(value);
+    } else {
+      return value.first;
+    }
+  }
+};
+
+}  // namespace s21
+
+#include "s21_swiss_table.tpp"
+
+#endif  // S21_SWISS_TABLE_H_
@@ -0,0 +1,505 @@
+#ifndef S21_SWISS_TABLE_TPP_
+#define S21_SWISS_TABLE_TPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * From <algorithm>:
+ *  std::max: The larger of the requested and the needed capacity.
+ *
+ * From <bit>:
+ *  std::bit_ceil: Rounds the number of home slots up to a power of two.
+ *
+ * From <cstring>:
+ *  std::memset, std::memcpy: Fill and copy whole control byte arrays.
+ *
+ * From <limits>:
+ *  std::numeric_limits: The bound reported by max_size().
+ *
+ * From <memory>:
+ *  std::construct_at, std::destroy_at: Build and destroy elements in their
+ * slots.
+ *
+ * From <stdexcept>:
+ *  std::invalid_argument: Thrown for a max_load_factor outside (0, 1].
+ *  std::length_error: Thrown when no capacity can hold the elements.
+ *
+ * From <type_traits>:
+ *  std::is_trivially_destructible_v: Skips the destructor walk over the
+ * slots.
+ *
+ * From <utility>:
+ *  std::exchange: Takes the arrays over in the move constructor and move
+ * assignment. std::move, std::forward: Pass elements on without copies.
+ * std::swap: Exchanges the members in swap().
+ *
+ * From <vector>:
+ *  std::vector: The new slot of every element while resize() plans a
+ * rehash.
+ */
+
+namespace s21 {
+
+#define ST_TEMPLATE_PARAMS                                              \
+  template <typename K, typename T, typename Tr, typename H, typename E, \
+            typename A>
+#define ST_CLASS SwissTable<K, T, Tr, H, E, A>
+
+ST_TEMPLATE_PARAMS
+ST_CLASS::SwissTable(size_type bucket_count, const H& hash, const E& equal,
+                     const A& alloc)
+    : ctrl_allocator_(alloc),
+      slot_allocator_(alloc),
+      hasher_(hash),
+      key_equal_(equal) {
+  if (bucket_count > 0) rehash(bucket_count);
+}
+
+/*
+ * The copy takes over the layout of other as it is: the same hash function
+ * puts every element into the same slot, so the control bytes are copied
+ * in one go and nothing is hashed.
+ */
+ST_TEMPLATE_PARAMS
+ST_CLASS::SwissTable(const ST_CLASS& other)
+    : max_load_factor_(other.max_load_factor_),
+      ctrl_allocator_(ctrl_traits::select_on_container_copy_construction(
+          other.ctrl_allocator_)),
+      slot_allocator_(slot_traits::select_on_container_copy_construction(
+          other.slot_allocator_)),
+      hasher_(other.hasher_),
+      key_equal_(other.key_equal_),
+      key_extractor_(other.key_extractor_) {
+  if (other.capacity_ == 0) return;
+  ctrl_t* ctrl = allocate_ctrl(other.slots_count_);
+  Slot* slots = nullptr;
+  size_type built = 0;
+  try {
+    slots = slot_traits::allocate(slot_allocator_, other.slots_count_);
+    for (; built < other.slots_count_; ++built) {
+      if (other.ctrl_[built] >= 0) {
+        std::construct_at(&slots[built].mutable_value,
+                          other.slots_[built].mutable_value);
+      }
+    }
+  } catch (...) {
+    for (size_type i = 0; i < built; ++i) {
+      if (other.ctrl_[i] >= 0) std::destroy_at(&slots[i].mutable_value);
+    }
+    if (slots) slot_traits::deallocate(slot_allocator_, slots,
+                                       other.slots_count_);
+    ctrl_traits::deallocate(ctrl_allocator_, ctrl,
+                            other.slots_count_ + kGroupWidth);
+    throw;
+  }
+  std::memcpy(ctrl, other.ctrl_, other.slots_count_ + kGroupWidth);
+  ctrl_ = ctrl;
+  slots_ = slots;
+  capacity_ = other.capacity_;
+  slots_count_ = other.slots_count_;
+  size_ = other.size_;
+  growth_limit_ = other.growth_limit_;
+}
+
+ST_TEMPLATE_PARAMS
+ST_CLASS::SwissTable(ST_CLASS&& other) noexcept
+    : ctrl_(std::exchange(other.ctrl_, nullptr)),
+      slots_(std::exchange(other.slots_, nullptr)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      slots_count_(std::exchange(other.slots_count_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      growth_limit_(std::exchange(other.growth_limit_, 0)),
+      max_load_factor_(other.max_load_factor_),
+      ctrl_allocator_(std::move(other.ctrl_allocator_)),
+      slot_allocator_(std::move(other.slot_allocator_)),
+      hasher_(std::move(other.hasher_)),
+      key_equal_(std::move(other.key_equal_)),
+      key_extractor_(std::move(other.key_extractor_)) {}
+
+ST_TEMPLATE_PARAMS
+ST_CLASS::~SwissTable() { release(); }
+
+ST_TEMPLATE_PARAMS
+ST_CLASS& ST_CLASS::operator=(const ST_CLASS& other) {
+  if (this != &other) {
+    ST_CLASS temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+ST_TEMPLATE_PARAMS
+ST_CLASS& ST_CLASS::operator=(ST_CLASS&& other) noexcept {
+  if (this != &other) {
+    release();
+    ctrl_ = std::exchange(other.ctrl_, nullptr);
+    slots_ = std::exchange(other.slots_, nullptr);
+    capacity_ = std::exchange(other.capacity_, 0);
+    slots_count_ = std::exchange(other.slots_count_, 0);
+    size_ = std::exchange(other.size_, 0);
+    growth_limit_ = std::exchange(other.growth_limit_, 0);
+    max_load_factor_ = other.max_load_factor_;
+    ctrl_allocator_ = std::move(other.ctrl_allocator_);
+    slot_allocator_ = std::move(other.slot_allocator_);
+    hasher_ = std::move(other.hasher_);
+    key_equal_ = std::move(other.key_equal_);
+    key_extractor_ = std::move(other.key_extractor_);
+  }
+  return *this;
+}
+
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::iterator ST_CLASS::begin() noexcept {
+  iterator it(ctrl_end() - slots_count_, slots_);
+  it.skip_empty();
+  return it;
+}
+
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::const_iterator ST_CLASS::begin() const noexcept {
+  const_iterator it(ctrl_end() - slots_count_, slots_);
+  it.skip_empty();
+  return it;
+}
+
+// An empty table has no arrays; its begin() and end() both point at a
+// shared sentinel.
+ST_TEMPLATE_PARAMS
+const ctrl_t* ST_CLASS::ctrl_end() const noexcept {
+  static constexpr ctrl_t kEmptyTable = kSentinel;
+  return ctrl_ ? ctrl_ + slots_count_ : &kEmptyTable;
+}
+
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::size_type ST_CLASS::max_size() const noexcept {
+  return std::numeric_limits<std::ptrdiff_t>::max() /
+         (sizeof(Slot) + sizeof(ctrl_t));
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::clear() noexcept {
+  if (size_ == 0) return;
+  destroy_elements();
+  std::memset(ctrl_, kEmpty, slots_count_);
+  size_ = 0;
+}
+
+ST_TEMPLATE_PARAMS
+template <typename Lookup, typename... Args>
+std::pair<typename ST_CLASS::iterator, bool> ST_CLASS::try_emplace(
+    const Lookup& key, Args&&... args) {
+  size_type mixed = mixed_hash(key);
+  size_type index = find_index(key, mixed);
+  if (index != kNotFound) return {iterator_at(index), false};
+  mutable_value_type value(std::forward<Args>(args)...);
+  return {insert_new(mixed, std::move(value)), true};
+}
+
+ST_TEMPLATE_PARAMS
+template <typename... Args>
+std::pair<typename ST_CLASS::iterator, bool> ST_CLASS::emplace(
+    Args&&... args) {
+  mutable_value_type value(std::forward<Args>(args)...);
+  const key_type& key = get_mutable_key(value);
+  size_type mixed = mixed_hash(key);
+  size_type index = find_index(key, mixed);
+  if (index != kNotFound) return {iterator_at(index), false};
+  return {insert_new(mixed, std::move(value)), true};
+}
+
+ST_TEMPLATE_PARAMS
+template <typename Lookup>
+typename ST_CLASS::size_type ST_CLASS::find_index(const Lookup& key,
+                                                  size_type mixed) const {
+  if (size_ == 0) return kNotFound;
+  ctrl_t h2 = hash_h2(mixed);
+  for (size_type position = home_of(mixed);; position += kGroupWidth) {
+    HashGroup group(ctrl_ + position);
+    for (auto match = group.match(h2); match; match.clear_lowest()) {
+      size_type index = position + match.lowest();
+      if (key_equal_(get_key(index), key)) return index;
+    }
+    // the key would have been placed before the first free slot
+    if (group.match_non_full()) return kNotFound;
+  }
+}
+
+// The first free slot from home on, or the sentinel when the tail is full.
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::size_type ST_CLASS::find_free(const ctrl_t* ctrl,
+                                                 size_type home) noexcept {
+  for (size_type position = home;; position += kGroupWidth) {
+    auto free = HashGroup(ctrl + position).match_non_full();
+    if (free) return position + free.lowest();
+  }
+}
+
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::iterator ST_CLASS::insert_new(
+    size_type mixed, mutable_value_type&& value) {
+  if (size_ + 1 > growth_limit_) resize(capacity_for(size_ + 1));
+  size_type index = find_free(ctrl_, home_of(mixed));
+  while (index == slots_count_) {
+    // the cluster ran into the end of the tail: grow until it fits
+    resize(capacity_ * 2);
+    index = find_free(ctrl_, home_of(mixed));
+  }
+  std::construct_at(&slots_[index].mutable_value, std::move(value));
+  ctrl_[index] = hash_h2(mixed);
+  ++size_;
+  return iterator_at(index);
+}
+
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::iterator ST_CLASS::erase(const_iterator pos) {
+  size_type index = static_cast<size_type>(pos.get_ctrl() - ctrl_);
+  erase_at(index);
+  iterator next = iterator_at(index);
+  next.skip_empty();
+  return next;
+}
+
+ST_TEMPLATE_PARAMS
+template <typename Lookup>
+typename ST_CLASS::size_type ST_CLASS::erase_key(const Lookup& key) {
+  size_type index = find_index(key, mixed_hash(key));
+  if (index == kNotFound) return 0;
+  erase_at(index);
+  return 1;
+}
+
+/*
+ * Backward-shift deletion. Every element of a cluster lies between its home
+ * and the first free slot after it; after the hole is made, each later
+ * element of the cluster whose home is at or before the hole moves into it
+ * and leaves a new hole behind, until the cluster ends. The table is then
+ * exactly as if the erased element had never been inserted.
+ */
+ST_TEMPLATE_PARAMS
+void ST_CLASS::erase_at(size_type index) noexcept {
+  std::destroy_at(&slots_[index].mutable_value);
+  ctrl_[index] = kEmpty;
+  --size_;
+  size_type hole = index;
+  for (size_type i = index + 1; ctrl_[i] >= 0; ++i) {
+    if (home_of(mixed_hash(get_key(i))) <= hole) {
+      std::construct_at(&slots_[hole].mutable_value,
+                        std::move(slots_[i].mutable_value));
+      std::destroy_at(&slots_[i].mutable_value);
+      ctrl_[hole] = ctrl_[i];
+      ctrl_[i] = kEmpty;
+      hole = i;
+    }
+  }
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::swap(ST_CLASS& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(slots_count_, other.slots_count_);
+  std::swap(size_, other.size_);
+  std::swap(growth_limit_, other.growth_limit_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(ctrl_allocator_, other.ctrl_allocator_);
+  std::swap(slot_allocator_, other.slot_allocator_);
+  std::swap(hasher_, other.hasher_);
+  std::swap(key_equal_, other.key_equal_);
+  std::swap(key_extractor_, other.key_extractor_);
+}
+
+// Walks other by index: erasing from it only shifts later elements back,
+// so the slot just emptied is looked at again.
+ST_TEMPLATE_PARAMS
+void ST_CLASS::merge(ST_CLASS& other) {
+  if (this == &other) return;
+  size_type i = 0;
+  while (i < other.slots_count_) {
+    if (other.ctrl_[i] < 0) {
+      ++i;
+      continue;
+    }
+    const key_type& key = other.get_key(i);
+    size_type mixed = mixed_hash(key);
+    if (find_index(key, mixed) != kNotFound) {
+      ++i;
+      continue;
+    }
+    insert_new(mixed, std::move(other.slots_[i].mutable_value));
+    other.erase_at(i);
+  }
+}
+
+ST_TEMPLATE_PARAMS
+template <typename Lookup>
+typename ST_CLASS::iterator ST_CLASS::find(const Lookup& key) {
+  size_type index = find_index(key, mixed_hash(key));
+  return index == kNotFound ? end() : iterator_at(index);
+}
+
+ST_TEMPLATE_PARAMS
+template <typename Lookup>
+typename ST_CLASS::const_iterator ST_CLASS::find(const Lookup& key) const {
+  size_type index = find_index(key, mixed_hash(key));
+  return index == kNotFound
+             ? end()
+             : const_iterator(ctrl_ + index, slots_ + index);
+}
+
+ST_TEMPLATE_PARAMS
+float ST_CLASS::load_factor() const noexcept {
+  return capacity_ ? static_cast<float>(size_) / static_cast<float>(capacity_)
+                   : 0.0f;
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::max_load_factor(float ml) {
+  if (!(ml > 0.0f && ml <= 1.0f)) {
+    throw std::invalid_argument("SwissTable: max_load_factor not in (0, 1]");
+  }
+  max_load_factor_ = ml;
+  if (capacity_ == 0) return;
+  if (size_ > static_cast<size_type>(static_cast<float>(capacity_) * ml)) {
+    resize(capacity_for(size_));
+  } else {
+    growth_limit_ = static_cast<size_type>(static_cast<float>(capacity_) * ml);
+  }
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::rehash(size_type count) {
+  if (count == 0 && size_ == 0) {
+    release();
+    return;
+  }
+  size_type capacity =
+      std::max(capacity_for(size_), std::bit_ceil(std::max(count,
+                                                           kMinCapacity)));
+  if (capacity != capacity_) resize(capacity);
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::reserve(size_type count) {
+  size_type capacity = capacity_for(count);
+  if (capacity > capacity_) resize(capacity);
+}
+
+// The smallest power of two whose load limit leaves room for count.
+ST_TEMPLATE_PARAMS
+typename ST_CLASS::size_type ST_CLASS::capacity_for(size_type count) const {
+  size_type capacity = kMinCapacity;
+  while (static_cast<size_type>(static_cast<float>(capacity) *
+                                max_load_factor_) < count) {
+    if (capacity > max_size() / 2) {
+      throw std::length_error("SwissTable: too many elements");
+    }
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+/*
+ * Moves every element into a table of new_capacity home slots. The new
+ * slot of each element is planned on the new control bytes first; if a
+ * cluster would run past the tail (only with a very poor hash) the plan
+ * starts over with twice the capacity. All memory is allocated before any
+ * element moves, so a failed allocation leaves the table unchanged.
+ */
+ST_TEMPLATE_PARAMS
+void ST_CLASS::resize(size_type new_capacity) {
+  std::vector<size_type> targets(size_);
+  ctrl_t* ctrl = nullptr;
+  size_type slots_count = 0;
+  for (bool planned = false; !planned;) {
+    slots_count = new_capacity + tail_for(new_capacity);
+    ctrl = allocate_ctrl(slots_count);
+    planned = true;
+    size_type element = 0;
+    for (size_type i = 0; i < slots_count_ && planned; ++i) {
+      if (ctrl_[i] < 0) continue;
+      size_type mixed = mixed_hash(get_key(i));
+      size_type target =
+          find_free(ctrl, (mixed >> 7) & (new_capacity - 1));
+      if (target == slots_count) {
+        ctrl_traits::deallocate(ctrl_allocator_, ctrl,
+                                slots_count + kGroupWidth);
+        new_capacity *= 2;
+        planned = false;
+      } else {
+        ctrl[target] = hash_h2(mixed);
+        targets[element++] = target;
+      }
+    }
+  }
+  Slot* slots = nullptr;
+  try {
+    slots = slot_traits::allocate(slot_allocator_, slots_count);
+  } catch (...) {
+    ctrl_traits::deallocate(ctrl_allocator_, ctrl, slots_count + kGroupWidth);
+    throw;
+  }
+  size_type element = 0;
+  for (size_type i = 0; i < slots_count_; ++i) {
+    if (ctrl_[i] < 0) continue;
+    Slot& to = slots[targets[element++]];
+    std::construct_at(&to.mutable_value, std::move(slots_[i].mutable_value));
+    std::destroy_at(&slots_[i].mutable_value);
+  }
+  if (ctrl_) {
+    ctrl_traits::deallocate(ctrl_allocator_, ctrl_, slots_count_ + kGroupWidth);
+    slot_traits::deallocate(slot_allocator_, slots_, slots_count_);
+  }
+  ctrl_ = ctrl;
+  slots_ = slots;
+  capacity_ = new_capacity;
+  slots_count_ = slots_count;
+  growth_limit_ =
+      static_cast<size_type>(static_cast<float>(capacity_) * max_load_factor_);
+}
+
+// Control bytes of an empty table: every slot free, then the sentinel and
+// a group's worth of padding so the last group load stays in bounds.
+ST_TEMPLATE_PARAMS
+ctrl_t* ST_CLASS::allocate_ctrl(size_type slots_count) {
+  ctrl_t* ctrl = ctrl_traits::allocate(ctrl_allocator_,
+                                       slots_count + kGroupWidth);
+  std::memset(ctrl, kEmpty, slots_count + kGroupWidth);
+  ctrl[slots_count] = kSentinel;
+  return ctrl;
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::destroy_elements() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<mutable_value_type>) {
+    for (size_type i = 0; i < slots_count_; ++i) {
+      if (ctrl_[i] >= 0) std::destroy_at(&slots_[i].mutable_value);
+    }
+  }
+}
+
+ST_TEMPLATE_PARAMS
+void ST_CLASS::release() noexcept {
+  if (!ctrl_) return;
+  destroy_elements();
+  ctrl_traits::deallocate(ctrl_allocator_, ctrl_, slots_count_ + kGroupWidth);
+  slot_traits::deallocate(slot_allocator_, slots_, slots_count_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = slots_count_ = size_ = growth_limit_ = 0;
+}
+
+#undef ST_TEMPLATE_PARAMS
+#undef ST_CLASS
+
+}  // namespace s21
+
+#endif  // S21_SWISS_TABLE_TPP_
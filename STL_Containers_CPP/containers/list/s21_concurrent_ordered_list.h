@@ -0,0 +1,261 @@
+#ifndef S21_CONCURRENT_ORDERED_LIST_H_
+#define S21_CONCURRENT_ORDERED_LIST_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+/*
+ * From <atomic>:
+ *  std::atomic: Every 'next' link is an atomic word whose low bit is the
+ *    Harris deletion mark; insert and erase publish changes with CAS.
+ *
+ * From <functional>:
+ *  std::less: Default ordering of the elements.
+ *
+ * From <iterator>:
+ *  std::forward_iterator_tag: Category of the weakly consistent iterator.
+ */
+
+#include "../memory/s21_epoch_reclaimer.h"
+
+namespace s21 {
+
+/*
+ * Sorted set of unique values backed by a lock-free singly linked list
+ * (Harris-Michael). insert, erase and contains may be called from any number
+ * of threads without external locking.
+ *
+ * erase first marks the victim's 'next' link (logical deletion) and then
+ * unlinks it; traversals that meet a marked node help unlink it. Unlinked
+ * nodes are handed to the epoch reclaimer, so a thread that is still looking
+ * at a node never sees it freed.
+ *
+ * Iterators are weakly consistent: they never crash or repeat an element,
+ * yield values in ascending order, and reflect some but not necessarily all
+ * changes made after they were created. An iterator pins the current epoch
+ * and must stay on the thread that created it.
+ */
+template <typename T, typename Compare = std::less<T>>
+class concurrent_ordered_list {
+ private:
+  struct Node {
+    T value;
+    std::atomic<std::uintptr_t> next;
+
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : value(std::forward<Args>(args)...), next(0) {}
+  };
+
+  static constexpr std::uintptr_t kMark = 1;
+
+  static Node* pointer_of(std::uintptr_t link) noexcept {
+    return reinterpret_cast<Node*>(link & ~kMark);
+  }
+  static bool is_marked(std::uintptr_t link) noexcept { return link & kMark; }
+  static std::uintptr_t link_of(Node* node) noexcept {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  // Position found by search(): *prev links to curr, curr is the first
+  // unmarked node whose value is not less than the key (or nullptr).
+  struct Window {
+    std::atomic<std::uintptr_t>* prev;
+    Node* curr;
+  };
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = const T&;
+
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator() : node_(nullptr) {}
+
+    reference operator*() const { return node_->value; }
+    pointer operator->() const { return &node_->value; }
+
+    const_iterator& operator++() {
+      node_ = first_live(
+          pointer_of(node_->next.load(std::memory_order_acquire)));
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class concurrent_ordered_list;
+
+    explicit const_iterator(Node* node) : node_(first_live(node)) {}
+
+    static Node* first_live(Node* node) {
+      while (node && is_marked(node->next.load(std::memory_order_acquire))) {
+        node = pointer_of(node->next.load(std::memory_order_acquire));
+      }
+      return node;
+    }
+
+    epoch_guard guard_;
+    Node* node_;
+  };
+
+  using iterator = const_iterator;
+
+  concurrent_ordered_list() = default;
+  explicit concurrent_ordered_list(const Compare& comp) : compare_(comp) {}
+  concurrent_ordered_list(const concurrent_ordered_list&) = delete;
+  concurrent_ordered_list& operator=(const concurrent_ordered_list&) = delete;
+
+  // Must not run concurrently with any other member function.
+  ~concurrent_ordered_list() {
+    Node* node = pointer_of(head_.load(std::memory_order_relaxed));
+    while (node) {
+      Node* next = pointer_of(node->next.load(std::memory_order_relaxed));
+      delete node;
+      node = next;
+    }
+  }
+
+  bool insert(const value_type& value) { return emplace(value); }
+  bool insert(value_type&& value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace(Args&&... args) {
+    Node* node = new Node(std::forward<Args>(args)...);
+    epoch_guard guard;
+    while (true) {
+      Window w = search(node->value);
+      if (w.curr && !compare_(node->value, w.curr->value)) {
+        delete node;
+        return false;
+      }
+      node->next.store(link_of(w.curr), std::memory_order_relaxed);
+      std::uintptr_t expected = link_of(w.curr);
+      if (w.prev->compare_exchange_strong(expected, link_of(node),
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+
+  bool erase(const value_type& value) {
+    epoch_guard guard;
+    while (true) {
+      Window w = search(value);
+      if (!w.curr || compare_(value, w.curr->value)) {
+        return false;
+      }
+      std::uintptr_t next = w.curr->next.load(std::memory_order_acquire);
+      if (is_marked(next)) {
+        continue;
+      }
+      // Logical deletion: whoever sets the mark owns the removal.
+      if (!w.curr->next.compare_exchange_strong(next, next | kMark,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed)) {
+        continue;
+      }
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      std::uintptr_t expected = link_of(w.curr);
+      if (w.prev->compare_exchange_strong(expected, next,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+        epoch_retire(w.curr);
+      } else {
+        search(value);  // a helper unlinks (and retires) it
+      }
+      return true;
+    }
+  }
+
+  // Wait-free: never writes, skips nodes that are logically deleted.
+  bool contains(const value_type& value) const {
+    epoch_guard guard;
+    Node* node = pointer_of(head_.load(std::memory_order_acquire));
+    while (node && compare_(node->value, value)) {
+      node = pointer_of(node->next.load(std::memory_order_acquire));
+    }
+    return node && !compare_(value, node->value) &&
+           !is_marked(node->next.load(std::memory_order_acquire));
+  }
+
+  const_iterator begin() const {
+    epoch_guard guard;
+    return const_iterator(pointer_of(head_.load(std::memory_order_acquire)));
+  }
+  const_iterator end() const { return const_iterator(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // Approximate while other threads are modifying the list.
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+ private:
+  // Michael's search: unlinks marked nodes on the way and restarts from the
+  // head whenever a CAS shows that the window changed under us.
+  Window search(const value_type& key) {
+    while (true) {
+      std::atomic<std::uintptr_t>* prev = &head_;
+      Node* curr = pointer_of(prev->load(std::memory_order_acquire));
+      bool restart = false;
+      while (curr) {
+        std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+        if (is_marked(next)) {
+          std::uintptr_t expected = link_of(curr);
+          if (!prev->compare_exchange_strong(expected, next & ~kMark,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)) {
+            restart = true;
+            break;
+          }
+          epoch_retire(curr);
+          curr = pointer_of(next);
+          continue;
+        }
+        if (!compare_(curr->value, key)) {
+          break;
+        }
+        prev = &curr->next;
+        curr = pointer_of(next);
+      }
+      if (!restart) {
+        return {prev, curr};
+      }
+    }
+  }
+
+  std::atomic<std::uintptr_t> head_{0};
+  std::atomic<size_type> size_{0};
+  Compare compare_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_ORDERED_LIST_H_
@@ -11,33 +11,157 @@
   в ListIterator и ListConstIterator
 */
 #include <limits>     // numeric_limits(max)
+#include <memory>     // allocator для блоков узлов
+#include <new>        // placement new для узлов в блоке
 #include <stdexcept>  // out_of_range
-#include <utility>    // swap
+#include <utility>    // swap, in_place, exchange
+
+#include "../s21_container_tags.h"  // from_range для конструктора из диапазона
 
 namespace s21 {
+template <typename T>
+class list;
+
+namespace parallel {
+// параллельная сортировка, реализация в s21_list_parallel.h
+template <typename T>
+void sort(list<T>& l, unsigned threads = 0);
+}  // namespace parallel
+
 template <typename T>
 class list {
  private:
   /*
   ---- BEGINLINE NODE INIT ----
   */
+  struct NodeBlock;
+
   struct Node {  // структура узла двусявзного
     T data;      // данные
     Node* next;  // указатель к следующему элементу-узлу
     Node* prev;  // указатель к предыдущему
+    NodeBlock* block = nullptr;  // блок узла, nullptr для узла из кучи
     // конструктор узла с назначением value в data
     Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+    // конструктор узла из произвольных аргументов для data
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
     // конструктор узла для вставки границ конца самого List
     Node() : next(nullptr), prev(nullptr) {}
   };
 
+  /*
+    Непрерывный блок узлов, созданный compact().
+    Узлы внутри блока не удаляются через delete: при удалении узла
+    уменьшается счетчик live, и блок освобождается целиком,
+    когда в нем не остается живых узлов. Узел знает свой блок, а блоки
+    списка образуют кольцо, поэтому удаление узла, освобождение блока и
+    передача блоков другому списку стоят O(1).
+  */
+  struct NodeBlock {
+    NodeBlock* next_block;  // следующий блок в кольце блоков списка
+    NodeBlock* prev_block;  // предыдущий блок в кольце
+    Node* nodes;            // начало массива узлов
+    std::size_t capacity;   // количество узлов в блоке
+    std::size_t live;       // количество еще используемых узлов
+  };
+
   Node* create_node(const T& value) {
     // выденление памяти для узла с инициалзиацией значения
     Node* new_node = new Node(value);
     return new_node;
   }
-  // удаление узла
-  void delete_node(Node* node) { delete node; }
+  // удаление узла (из блока или из кучи)
+  void delete_node(Node* node) {
+    NodeBlock* block = node->block;
+    if (!block) {
+      delete node;
+      return;
+    }
+    node->~Node();
+    if (--block->live == 0) {
+      unlink_block(block);
+      free_block(block);
+    }
+  }
+
+  // добавление блока в кольцо блоков списка
+  void link_block(NodeBlock* block) {
+    if (!blocks) {
+      block->next_block = block->prev_block = block;
+      blocks = block;
+      return;
+    }
+    block->next_block = blocks;
+    block->prev_block = blocks->prev_block;
+    blocks->prev_block->next_block = block;
+    blocks->prev_block = block;
+  }
+
+  // исключение блока из кольца
+  void unlink_block(NodeBlock* block) {
+    if (block->next_block == block) {
+      blocks = nullptr;
+      return;
+    }
+    block->prev_block->next_block = block->next_block;
+    block->next_block->prev_block = block->prev_block;
+    if (blocks == block) blocks = block->next_block;
+  }
+
+  NodeBlock* allocate_block(std::size_t capacity) {
+    NodeBlock* block = new NodeBlock{nullptr, nullptr, nullptr, capacity, 0};
+    try {
+      block->nodes = std::allocator<Node>().allocate(capacity);
+    } catch (...) {
+      delete block;
+      throw;
+    }
+    return block;
+  }
+
+  void free_block(NodeBlock* block) {
+    std::allocator<Node>().deallocate(block->nodes, block->capacity);
+    delete block;
+  }
+
+  /*
+    Сортировка перестановкой указателей: узлы не копируются.
+    Цепочка - односвязная по next, заканчивается nullptr.
+  */
+  static Node* merge_chains(Node* a, Node* b);  // слияние двух цепочек
+  static Node* sort_chain(Node* head);          // сортировка цепочки
+  Node* detach_chain();            // отцепить узлы от sentry в цепочку
+  void attach_chain(Node* head);  // прицепить цепочку и восстановить prev
+
+  friend void parallel::sort<T>(list<T>& l, unsigned threads);
+
+  /*
+    Добавление n узлов в конец одним блоком: construct(slot) создает
+    узел на месте slot. Блок освобождается, когда удалены все его узлы.
+  */
+  template <typename Construct>
+  void append_block(std::size_t n, Construct construct);
+  template <typename It, typename Sent>
+  void append_range(It first, Sent last);  // добавление диапазона в конец
+
+  // передача блоков другого списка этому (при splice и merge): два кольца
+  // сшиваются в одно
+  void adopt_blocks(list& other) {
+    NodeBlock* theirs = std::exchange(other.blocks, nullptr);
+    if (!theirs) return;
+    if (!blocks) {
+      blocks = theirs;
+      return;
+    }
+    NodeBlock* my_last = blocks->prev_block;
+    NodeBlock* their_last = theirs->prev_block;
+    my_last->next_block = theirs;
+    theirs->prev_block = my_last;
+    their_last->next_block = blocks;
+    blocks->prev_block = their_last;
+  }
 
   /*
 ---- ENDLINE NODE INIT ----
@@ -56,11 +180,9 @@ class list {
     using pointer = T*;
     using reference = T&;
 
+    ListIterator() : current_ptr(nullptr) {}       // пустой итератор
     ListIterator(Node* ptr) : current_ptr(ptr) {}  // Constructor
-    T& operator*() { return current_ptr->data; }   // Разыменование
-    const T& operator*() const {
-      return current_ptr->data;
-    }  // Конст разыменование
+    T& operator*() const { return current_ptr->data; }  // Разыменование
 
     T* operator->() const { return &(current_ptr->data); }  // Дать доступ
     // const T* operator->() const { return &(current_ptr->data); }
@@ -169,12 +291,17 @@ class list {
      sentry->prev указывает на последний элемент
   */
   std::size_t list_size;
+  NodeBlock* blocks = nullptr;  // блоки узлов после compact()
 
  public:
   // constructs, destr, assign
   list();             // пустой список
   list(size_type n);  // параметризованный список
   list(std::initializer_list<value_type> const& items);  // инит лист список
+  template <std::input_iterator InputIt>
+  list(InputIt first, InputIt last);  // список из диапазона итераторов
+  template <container_compatible_range<T> R>
+  list(from_range_t, R&& rg);  // список из любого диапазона (range)
   list(const list& l);  // копирующий список
   list(list&& l);       // перемещение списка
   ~list();              // деструктор списка
@@ -209,6 +336,15 @@ class list {
   void reverse();            // смена порядка элементов
   void unique();             // удаление дубликатов
   void sort();               // соритровка элементов
+  template <std::input_iterator InputIt>
+  void assign(InputIt first,
+              InputIt last);  // замена содержимого элементами диапазона
+
+  // public methods for memory layout
+  void compact();  // перенос всех узлов в один непрерывный блок по порядку
+  template <typename UnaryFunction>
+  void for_each(UnaryFunction f,
+                bool prefetch = false);  // обход с опциональной предвыборкой
 };
 
 }  // namespace s21
@@ -217,5 +353,6 @@ class list {
 #include "s21_list_capacity.tpp"
 #include "s21_list_edit.tpp"
 #include "s21_list_funcs.tpp"
+#include "s21_list_layout.tpp"
 
 #endif
\ No newline at end of file
@@ -93,6 +93,8 @@ void list<T>::swap(list& other) {
   size_type temp_size = list_size;
   list_size = other.list_size;
   other.list_size = temp_size;
+
+  std::swap(blocks, other.blocks);
 }
 // слияние двух списков
 template <typename T>
@@ -170,6 +172,8 @@ void list<T>::merge(list& other) {
     other.sentry->next = other.sentry;
     other.sentry->prev = other.sentry;
   }
+  // все узлы other теперь в this, вместе с ними и блоки
+  adopt_blocks(other);
 }
 // перемещение элементов начания с pos от списка other
 template <typename T>
@@ -192,6 +196,7 @@ void list<T>::splice(const_iterator pos, list& other) {
 
   other.sentry->next = other.sentry;
   other.sentry->prev = other.sentry;
+  adopt_blocks(other);
 }
 
 template <typename T>
@@ -246,34 +251,88 @@ void list<T>::unique() {
 template <typename T>
 void list<T>::sort() {
   /*
-    Деление списка пополам на временных полях списков
-    с рекурсивной сортировкой друг на друга
-    с последующим слиянием merge
+    Сортировка слиянием без копирования элементов:
+    список превращается в цепочку узлов, которая сортируется
+    перестановкой указателей и прицепляется обратно
   */
   if (list_size <= 1) {
     return;
   }
+  attach_chain(sort_chain(detach_chain()));
+}
 
-  list<T> left;
-  list<T> right;
-  size_type mid = list_size / 2;
+// замена содержимого элементами [first, last)
+template <typename T>
+template <std::input_iterator InputIt>
+void list<T>::assign(InputIt first, InputIt last) {
+  clear();
+  append_range(first, last);
+}
 
-  iterator it = begin();
-  for (size_type i = 0; i < mid; ++i) {
-    left.push_back(*it);
-    ++it;
+// слияние двух отсортированных цепочек, при равенстве первым идет a
+template <typename T>
+typename list<T>::Node* list<T>::merge_chains(Node* a, Node* b) {
+  Node* head = nullptr;
+  Node** tail = &head;
+  while (a && b) {
+    if (b->data < a->data) {
+      *tail = b;
+      b = b->next;
+    } else {
+      *tail = a;
+      a = a->next;
+    }
+    tail = &(*tail)->next;
+  }
+  *tail = a ? a : b;
+  return head;
+}
+
+/*
+  Восходящая сортировка слиянием: bins[i] хранит отсортированную
+  цепочку из 2^i узлов, каждый новый узел "переносится" как в
+  двоичном счетчике. Один проход по цепочке, без рекурсии.
+*/
+template <typename T>
+typename list<T>::Node* list<T>::sort_chain(Node* head) {
+  Node* bins[64] = {};
+  while (head) {
+    Node* carry = head;
+    head = head->next;
+    carry->next = nullptr;
+    int i = 0;
+    for (; bins[i]; ++i) {
+      carry = merge_chains(bins[i], carry);  // bins[i] старше, идет первым
+      bins[i] = nullptr;
+    }
+    bins[i] = carry;
   }
-  while (it != end()) {
-    right.push_back(*it);
-    ++it;
+  Node* result = nullptr;
+  for (Node* bin : bins) {
+    if (bin) result = merge_chains(bin, result);
   }
-  left.sort();
-  right.sort();
+  return result;
+}
 
-  clear();
+template <typename T>
+typename list<T>::Node* list<T>::detach_chain() {
+  Node* head = sentry->next;
+  sentry->prev->next = nullptr;
+  sentry->next = sentry;
+  sentry->prev = sentry;
+  return head == sentry ? nullptr : head;
+}
 
-  merge(left);
-  merge(right);
+template <typename T>
+void list<T>::attach_chain(Node* head) {
+  Node* prev = sentry;
+  for (Node* node = head; node; node = node->next) {
+    node->prev = prev;
+    prev->next = node;
+    prev = node;
+  }
+  prev->next = sentry;
+  sentry->prev = prev;
 }
 }  // namespace s21
 
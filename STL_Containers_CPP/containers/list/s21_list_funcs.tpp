@@ -10,35 +10,42 @@ list<T>::list() : list_size(0) {
 
 template <typename T>
 list<T>::list(size_type n) : list() {  // инициализация пустого конструктора
-  for (size_type i = 0; i < n; ++i) {
-    push_back(T());  // добавление к концу списка исходя из размера n
-  }
+  // n узлов со значением по умолчанию одним блоком
+  append_block(n, [](Node* slot) { new (slot) Node(std::in_place); });
 }
 
 template <typename T>
-list<T>::list(std::initializer_list<value_type> const& items) : list_size(0) {
-  sentry = new Node();
-  sentry->next = sentry;
-  sentry->prev = sentry;
-  // указание диапазона через ": items"
-  // и вставкой значений со списка инициалзиации через item
-  // const со ссылкой что не именяется item для безопасности
-  for (const auto& item : items) {
-    push_back(item);
-  }
+list<T>::list(std::initializer_list<value_type> const& items) : list() {
+  // указание диапазона через begin/end списка инициализации,
+  // все узлы создаются одним блоком
+  append_range(items.begin(), items.end());
+}
+
+// список из диапазона [first, last)
+template <typename T>
+template <std::input_iterator InputIt>
+list<T>::list(InputIt first, InputIt last) : list() {
+  append_range(first, last);
+}
+
+// список из диапазона (range), например list(s21::from_range, vector)
+template <typename T>
+template <container_compatible_range<T> R>
+list<T>::list(from_range_t, R&& rg) : list() {
+  append_range(std::ranges::begin(rg), std::ranges::end(rg));
 }
 
 // копирование элементов со списка l
 template <typename T>
 list<T>::list(const list& l) : list() {
-  for (const auto& item : l) {
-    push_back(item);
-  }
+  append_range(l.begin(), l.end());
 }
 
 // перемещение содержимого со списка other при этом устанавливая пустой other
 template <typename T>
-list<T>::list(list&& other) : sentry(other.sentry), list_size(other.list_size) {
+list<T>::list(list&& other)
+    : sentry(other.sentry), list_size(other.list_size), blocks(other.blocks) {
+  other.blocks = nullptr;
   other.sentry = new Node();
   other.sentry->next = other.sentry;
   other.sentry->prev = other.sentry;
@@ -53,6 +60,8 @@ list<T>& list<T>::operator=(list&& l) noexcept {
     delete sentry;
     sentry = l.sentry;
     list_size = l.list_size;
+    blocks = l.blocks;
+    l.blocks = nullptr;
     l.sentry = new Node();
     l.sentry->next = l.sentry;
     l.sentry->prev = l.sentry;
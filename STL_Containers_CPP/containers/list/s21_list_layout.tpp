@@ -0,0 +1,125 @@
+#ifndef _s21_list_layout_
+#define _s21_list_layout_
+
+namespace s21 {
+
+/*
+  Перенос всех узлов в один непрерывный блок в порядке обхода.
+  После долгих вставок и удалений узлы разбросаны по куче и каждый
+  переход по next - промах кэша; после compact() соседние элементы
+  лежат рядом в памяти. Значения перемещаются в новые узлы, поэтому
+  все итераторы становятся недействительными.
+*/
+template <typename T>
+void list<T>::compact() {
+  if (empty()) {
+    return;
+  }
+
+  // старые узлы отцепляются в цепочку и остаются живы, пока
+  // новые не созданы: при исключении список восстанавливается
+  size_type n = list_size;
+  Node* old_head = detach_chain();
+  list_size = 0;
+  Node* source = old_head;
+  try {
+    append_block(n, [&source](Node* slot) {
+      new (slot) Node(std::in_place, std::move_if_noexcept(source->data));
+      source = source->next;
+    });
+  } catch (...) {
+    list_size = n;
+    attach_chain(old_head);
+    throw;
+  }
+
+  while (old_head) {
+    Node* next = old_head->next;
+    delete_node(old_head);
+    old_head = next;
+  }
+}
+
+template <typename T>
+template <typename Construct>
+void list<T>::append_block(std::size_t n, Construct construct) {
+  if (n == 0) {
+    return;
+  }
+  NodeBlock* block = allocate_block(n);
+  size_type built = 0;
+  try {
+    for (; built < n; ++built) {
+      construct(block->nodes + built);
+    }
+  } catch (...) {
+    for (size_type i = 0; i < built; ++i) {
+      block->nodes[i].~Node();
+    }
+    free_block(block);
+    throw;
+  }
+
+  // связывание узлов блока по порядку после последнего элемента
+  Node* prev = sentry->prev;
+  for (size_type i = 0; i < n; ++i) {
+    Node* node = block->nodes + i;
+    node->block = block;
+    node->prev = prev;
+    prev->next = node;
+    prev = node;
+  }
+  prev->next = sentry;
+  sentry->prev = prev;
+
+  block->live = n;
+  link_block(block);
+  list_size += n;
+}
+
+template <typename T>
+template <typename It, typename Sent>
+void list<T>::append_range(It first, Sent last) {
+  if constexpr (std::forward_iterator<It>) {
+    // размер известен заранее: все узлы в одном блоке
+    size_type n = static_cast<size_type>(std::ranges::distance(first, last));
+    append_block(n, [&first](Node* slot) {
+      new (slot) Node(std::in_place, *first);
+      ++first;
+    });
+  } else {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+}
+
+/*
+  Обход всех элементов с вызовом f.
+  При prefetch = true перед обработкой текущего узла запрашивается
+  загрузка следующего, чтобы промах кэша на нем перекрывался с работой f.
+*/
+template <typename T>
+template <typename UnaryFunction>
+void list<T>::for_each(UnaryFunction f, bool prefetch) {
+  Node* node = sentry->next;
+  if (prefetch) {
+    while (node != sentry) {
+      Node* next = node->next;
+#if defined(__GNUC__)
+      __builtin_prefetch(next);
+#endif
+      f(node->data);
+      node = next;
+    }
+  } else {
+    while (node != sentry) {
+      f(node->data);
+      node = node->next;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif
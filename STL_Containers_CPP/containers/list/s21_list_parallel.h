@@ -0,0 +1,87 @@
+#ifndef _S21_LIST_PARALLEL_H
+#define _S21_LIST_PARALLEL_H
+
+#include <cstddef>  // size_t
+#include <thread>   // jthread и hardware_concurrency для рабочих потоков
+#include <vector>   // vector для головных узлов кусков и потоков
+
+#include "s21_list.h"
+
+namespace s21 {
+namespace parallel {
+
+// кусок меньше этого сортировать в отдельном потоке невыгодно
+inline constexpr std::size_t kMinChunkSize = 4096;
+
+/*
+  Параллельная сортировка списка без копирования элементов.
+  1) один проход режет список на threads примерно равных цепочек;
+  2) каждая цепочка сортируется в своем потоке перестановкой указателей;
+  3) цепочки сливаются попарно деревом слияний, слияния одного уровня
+     идут параллельно.
+  Если поток не удалось создать, его работа выполняется в текущем потоке.
+  operator< для T не должен бросать исключений.
+  threads = 0 - по числу аппаратных потоков.
+*/
+template <typename T>
+void sort(list<T>& l, unsigned threads) {
+  using Node = typename list<T>::Node;
+
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  std::size_t chunks = l.list_size / kMinChunkSize;
+  if (chunks > threads) chunks = threads;
+  if (chunks <= 1) {
+    l.sort();
+    return;
+  }
+
+  // память выделяется до того, как список разобран на куски
+  std::vector<Node*> heads(chunks);
+  std::vector<std::jthread> workers;
+  workers.reserve(chunks - 1);
+  auto spawn = [&workers](auto task) {
+    try {
+      workers.emplace_back(task);
+    } catch (...) {
+      task();  // поток не создан (system_error, bad_alloc)
+    }
+  };
+
+  // один проход: разрезание цепочки на куски
+  Node* node = l.detach_chain();
+  for (std::size_t i = 0; i < chunks; ++i) {
+    std::size_t length = l.list_size / chunks + (i < l.list_size % chunks);
+    heads[i] = node;
+    for (std::size_t j = 1; j < length; ++j) node = node->next;
+    Node* next = node->next;
+    node->next = nullptr;
+    node = next;
+  }
+
+  // сортировка кусков: нулевой кусок в текущем потоке
+  for (std::size_t i = 1; i < chunks; ++i) {
+    spawn([&heads, i] { heads[i] = list<T>::sort_chain(heads[i]); });
+  }
+  heads[0] = list<T>::sort_chain(heads[0]);
+  workers.clear();  // jthread присоединяется в деструкторе
+
+  // дерево слияний: на каждом уровне пары (i, i + step) сливаются в i
+  for (std::size_t step = 1; step < chunks; step *= 2) {
+    for (std::size_t i = 2 * step; i + step < chunks; i += 2 * step) {
+      spawn([&heads, i, step] {
+        heads[i] = list<T>::merge_chains(heads[i], heads[i + step]);
+      });
+    }
+    heads[0] = list<T>::merge_chains(heads[0], heads[step]);
+    workers.clear();
+  }
+
+  l.attach_chain(heads[0]);
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef S21_BACKGROUND_RECLAIMER_H_
+#define S21_BACKGROUND_RECLAIMER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/*
+ * From <condition_variable>:
+ *  std::condition_variable: Wakes the worker when work arrives and the
+ *    callers of drain() when the queue runs empty.
+ *
+ * From <deque>, <functional>:
+ *  std::deque<std::function<void()>>: The queue of pending jobs.
+ *
+ * From <mutex>:
+ *  std::mutex, std::unique_lock, std::lock_guard: Protect the queue.
+ *
+ * From <thread>:
+ *  std::thread: The worker, started by the first submit().
+ */
+
+namespace s21 {
+
+/*
+ * A process-wide thread that runs teardown work off the caller's path.
+ * Containers hand it memory they have already detached (see
+ * RedBlackTree::clear_deferred), so a job never touches anything another
+ * thread can still reach. Jobs run in submission order; jobs still queued
+ * at exit run before the worker is joined.
+ */
+class background_reclaimer {
+ public:
+  static background_reclaimer& instance() {
+    static background_reclaimer reclaimer;
+    return reclaimer;
+  }
+
+  background_reclaimer(const background_reclaimer&) = delete;
+  background_reclaimer& operator=(const background_reclaimer&) = delete;
+
+  ~background_reclaimer() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    work_ready_.notify_one();
+    if (worker_.joinable()) worker_.join();
+  }
+
+  // The job must not throw.
+  void submit(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(std::move(job));
+      if (!worker_.joinable()) worker_ = std::thread([this] { run(); });
+    }
+    work_ready_.notify_one();
+  }
+
+  // Blocks until every job submitted so far has finished.
+  void drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+  }
+
+ private:
+  background_reclaimer() = default;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) return;
+      std::function<void()> job = std::move(jobs_.front());
+      jobs_.pop_front();
+      busy_ = true;
+      lock.unlock();
+      job();
+      job = nullptr;  // whatever the job owns is freed unlocked too
+      lock.lock();
+      busy_ = false;
+      if (jobs_.empty()) idle_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable work_ready_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> jobs_;
+  bool busy_ = false;
+  bool stopping_ = false;
+  std::thread worker_;
+};
+
+}  // namespace s21
+
+#endif  // S21_BACKGROUND_RECLAIMER_H_
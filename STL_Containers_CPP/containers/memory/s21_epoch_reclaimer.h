@@ -0,0 +1,197 @@
+#ifndef S21_EPOCH_RECLAIMER_H_
+#define S21_EPOCH_RECLAIMER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+/*
+ * From <atomic>:
+ *  std::atomic: Holds the global epoch and the per-thread announcements that
+ *    readers publish while they are inside a critical section.
+ *
+ * From <mutex>:
+ *  std::mutex, std::lock_guard: Protect the list of objects orphaned by
+ *    threads that exited before their retired objects could be freed.
+ *
+ * From <vector>:
+ *  std::vector: Per-thread limbo lists of retired objects.
+ */
+
+namespace s21 {
+
+/*
+ * Epoch-based memory reclamation shared by the lock-free containers.
+ *
+ * A thread that reads shared nodes holds an epoch_guard. A node that has
+ * been unlinked is passed to retire() instead of being deleted; it is freed
+ * once every thread that could still see it has left its critical section,
+ * i.e. two global epochs later. All containers use the one process-wide
+ * domain, so a thread registers once no matter how many containers it uses.
+ */
+class epoch_domain {
+ public:
+  using deleter_type = void (*)(void*);
+
+  static constexpr std::size_t kMaxThreads = 512;
+
+  static epoch_domain& instance() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  epoch_domain(const epoch_domain&) = delete;
+  epoch_domain& operator=(const epoch_domain&) = delete;
+
+  ~epoch_domain() {
+    for (const retired& r : orphans_) r.deleter(r.object);
+  }
+
+  void enter() {
+    thread_record& rec = record();
+    if (rec.nesting++ == 0) {
+      std::uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+      slots_[rec.slot].announced.store((epoch << 1) | 1,
+                                       std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+  }
+
+  void leave() {
+    thread_record& rec = record();
+    if (--rec.nesting == 0) {
+      slots_[rec.slot].announced.store(0, std::memory_order_release);
+    }
+  }
+
+  // The object must already be unreachable for threads entering from now on.
+  void retire(void* object, deleter_type deleter) {
+    thread_record& rec = record();
+    std::uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+    rec.limbo.push_back({object, deleter, epoch});
+    if (rec.limbo.size() >= kCollectThreshold) {
+      collect(rec);
+    }
+  }
+
+ private:
+  struct retired {
+    void* object;
+    deleter_type deleter;
+    std::uint64_t epoch;
+  };
+
+  struct alignas(64) slot {
+    std::atomic<std::uint64_t> announced{0};
+    std::atomic<bool> in_use{false};
+  };
+
+  struct thread_record {
+    explicit thread_record(epoch_domain& d)
+        : domain(d), slot(d.acquire_slot()) {}
+    ~thread_record() { domain.release_slot(*this); }
+
+    epoch_domain& domain;
+    std::size_t slot;
+    std::size_t nesting = 0;
+    std::vector<retired> limbo;
+  };
+
+  static constexpr std::size_t kCollectThreshold = 128;
+
+  epoch_domain() = default;
+
+  thread_record& record() {
+    thread_local thread_record rec(*this);
+    return rec;
+  }
+
+  std::size_t acquire_slot() {
+    for (std::size_t i = 0; i < kMaxThreads; ++i) {
+      bool expected = false;
+      if (!slots_[i].in_use.load(std::memory_order_relaxed) &&
+          slots_[i].in_use.compare_exchange_strong(expected, true)) {
+        return i;
+      }
+    }
+    throw std::runtime_error("epoch_domain: too many threads");
+  }
+
+  void release_slot(thread_record& rec) {
+    slots_[rec.slot].announced.store(0, std::memory_order_release);
+    if (!rec.limbo.empty()) {
+      std::lock_guard<std::mutex> lock(orphans_mutex_);
+      orphans_.insert(orphans_.end(), rec.limbo.begin(), rec.limbo.end());
+    }
+    slots_[rec.slot].in_use.store(false, std::memory_order_release);
+  }
+
+  // Advances the global epoch if every active thread has observed it.
+  std::uint64_t try_advance() {
+    std::uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+    for (std::size_t i = 0; i < kMaxThreads; ++i) {
+      std::uint64_t announced =
+          slots_[i].announced.load(std::memory_order_seq_cst);
+      if ((announced & 1) && (announced >> 1) != epoch) {
+        return epoch;
+      }
+    }
+    global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+    return global_epoch_.load(std::memory_order_acquire);
+  }
+
+  // Moves expired entries to 'out'; deleters run later, outside any list,
+  // because a deleter may itself retire more objects.
+  static void take_expired(std::vector<retired>& list, std::uint64_t epoch,
+                           std::vector<retired>& out) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < list.size(); ++i) {
+      if (list[i].epoch + 2 <= epoch) {
+        out.push_back(list[i]);
+      } else {
+        list[kept++] = list[i];
+      }
+    }
+    list.resize(kept);
+  }
+
+  void collect(thread_record& rec) {
+    std::uint64_t epoch = try_advance();
+    std::vector<retired> expired;
+    take_expired(rec.limbo, epoch, expired);
+    {
+      std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+      if (lock.owns_lock()) {
+        take_expired(orphans_, epoch, expired);
+      }
+    }
+    for (const retired& r : expired) r.deleter(r.object);
+  }
+
+  std::atomic<std::uint64_t> global_epoch_{2};
+  slot slots_[kMaxThreads];
+  std::mutex orphans_mutex_;
+  std::vector<retired> orphans_;
+};
+
+// RAII critical section: nodes seen while it is alive are not freed.
+class epoch_guard {
+ public:
+  epoch_guard() { epoch_domain::instance().enter(); }
+  epoch_guard(const epoch_guard&) : epoch_guard() {}
+  epoch_guard& operator=(const epoch_guard&) { return *this; }
+  ~epoch_guard() { epoch_domain::instance().leave(); }
+};
+
+template <typename T>
+void epoch_retire(T* object) {
+  epoch_domain::instance().retire(
+      object, [](void* p) { delete static_cast<T*>(p); });
+}
+
+}  // namespace s21
+
+#endif  // S21_EPOCH_RECLAIMER_H_
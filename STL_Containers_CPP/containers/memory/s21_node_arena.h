@@ -0,0 +1,269 @@
+#ifndef S21_NODE_ARENA_H_
+#define S21_NODE_ARENA_H_
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+/*
+ * From <sys/mman.h>:
+ *  mmap: Reserves the arena's address range once; pages are only backed by
+ *    memory when a node is first placed on them.
+ *
+ * From <algorithm>:
+ *  std::min: Caps the reservation by the number of 32-bit indices.
+ *
+ * From <cstring>:
+ *  std::memcpy: Reads and writes the free-list link kept in a freed slot.
+ *
+ * From <mutex>:
+ *  std::mutex, std::lock_guard: Guard the shared free list and the
+ *    reservation; threads only take the lock to move a batch of slots
+ *    (or single slots once their cache is gone).
+ *
+ * From <new>:
+ *  std::bad_alloc: Thrown when the reservation fails or is exhausted.
+ */
+
+namespace s21 {
+
+/*
+ * One contiguous array of T per type T, shared by every container using
+ * node_arena_allocator<T>. Because the array never moves, a slot is named
+ * by a 32-bit index: pointer(index) and index(pointer) are one multiply
+ * away, which is what lets tree nodes link to each other with indices
+ * (see ArenaIndexLinks). Index 0 is never handed out and stands for null.
+ *
+ * The address range for kCapacity slots (at most 64 GiB) is reserved on
+ * first use; only touched pages take memory. Freed slots are reused, but
+ * memory is not returned to the system while the process runs.
+ *
+ * Every thread keeps its own free list and a run of never-used slots, and
+ * only locks the shared state to move kBatch slots at a time, so trees of
+ * one node type on different threads rarely wait for each other. A slot
+ * may be freed by another thread than the one that allocated it. Slots
+ * cached by a thread go back to the shared list when the thread exits;
+ * after that (a static tree destroyed at exit, say) the thread allocates
+ * and frees one slot at a time under the lock.
+ */
+template <typename T>
+class node_arena {
+ public:
+  // The top bit of an index stays free for the tree's color.
+  static constexpr std::uint32_t kCapacity = static_cast<std::uint32_t>(
+      std::min<std::size_t>(std::size_t{1} << 31,
+                            (std::size_t{1} << 36) / sizeof(T)));
+
+  static T* pointer(std::uint32_t index) noexcept {
+    return index ? base_ + index : nullptr;
+  }
+  static std::uint32_t index(const T* p) noexcept {
+    return p ? static_cast<std::uint32_t>(p - base_) : 0;
+  }
+
+  static T* allocate() {
+    static_assert(sizeof(T) >= sizeof(std::uint32_t),
+                  "a freed slot holds the next free index");
+    if (cache_gone_) return base_ + take_shared();
+    thread_cache& cache = local_cache();
+    if (!cache.free_head && cache.fresh_next == cache.fresh_end) {
+      refill(cache);
+    }
+    std::uint32_t slot = cache.free_head;
+    if (slot) {
+      cache.free_head = next_free(slot);
+      --cache.free_count;
+    } else {
+      slot = cache.fresh_next++;
+    }
+    return base_ + slot;
+  }
+
+  static void deallocate(T* p) noexcept {
+    std::uint32_t slot = index(p);
+    if (cache_gone_) {
+      put_shared(slot);
+      return;
+    }
+    thread_cache& cache = local_cache();
+    set_next_free(slot, cache.free_head);
+    cache.free_head = slot;
+    if (++cache.free_count > 2 * kBatch) give_back(cache, kBatch);
+  }
+
+ private:
+  // Slots moved between a thread and the shared state at once.
+  static constexpr std::uint32_t kBatch = 64;
+
+  struct arena_state {
+    std::mutex mutex;
+    std::uint32_t next = 1;
+    std::uint32_t free_head = 0;
+  };
+
+  // One per thread: a free list and the never-used slots [fresh_next,
+  // fresh_end), which are not linked so their pages stay untouched.
+  struct thread_cache {
+    std::uint32_t free_head = 0;
+    std::uint32_t free_count = 0;
+    std::uint32_t fresh_next = 0;
+    std::uint32_t fresh_end = 0;
+
+    ~thread_cache() {
+      cache_gone_ = true;
+      while (fresh_next != fresh_end) {
+        set_next_free(fresh_next, free_head);
+        free_head = fresh_next++;
+        ++free_count;
+      }
+      if (free_count) give_back(*this, free_count);
+    }
+  };
+
+  static arena_state& state() {
+    static arena_state s;
+    return s;
+  }
+
+  static thread_cache& local_cache() noexcept {
+    static thread_local thread_cache cache;
+    return cache;
+  }
+
+  static std::uint32_t next_free(std::uint32_t slot) noexcept {
+    std::uint32_t next;
+    std::memcpy(&next, static_cast<const void*>(base_ + slot), sizeof(next));
+    return next;
+  }
+  static void set_next_free(std::uint32_t slot, std::uint32_t next) noexcept {
+    std::memcpy(static_cast<void*>(base_ + slot), &next, sizeof(next));
+  }
+
+  // Takes up to kBatch freed slots, or else kBatch fresh ones.
+  static void refill(thread_cache& cache) {
+    arena_state& shared = state();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (!base_) reserve();
+    if (shared.free_head) {
+      std::uint32_t first = shared.free_head;
+      std::uint32_t last = first;
+      std::uint32_t count = 1;
+      while (count < kBatch && next_free(last)) {
+        last = next_free(last);
+        ++count;
+      }
+      shared.free_head = next_free(last);
+      set_next_free(last, cache.free_head);
+      cache.free_head = first;
+      cache.free_count += count;
+    } else {
+      if (shared.next == kCapacity) throw std::bad_alloc();
+      cache.fresh_next = shared.next;
+      shared.next = std::min(kCapacity, shared.next + kBatch);
+      cache.fresh_end = shared.next;
+    }
+  }
+
+  // One slot from the shared state, for a thread whose cache is gone.
+  static std::uint32_t take_shared() {
+    arena_state& shared = state();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (!base_) reserve();
+    std::uint32_t slot = shared.free_head;
+    if (slot) {
+      shared.free_head = next_free(slot);
+    } else {
+      if (shared.next == kCapacity) throw std::bad_alloc();
+      slot = shared.next++;
+    }
+    return slot;
+  }
+
+  static void put_shared(std::uint32_t slot) noexcept {
+    arena_state& shared = state();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    set_next_free(slot, shared.free_head);
+    shared.free_head = slot;
+  }
+
+  // Moves the first count slots of the thread's free list to the shared one.
+  static void give_back(thread_cache& cache, std::uint32_t count) noexcept {
+    std::uint32_t first = cache.free_head;
+    std::uint32_t last = first;
+    for (std::uint32_t i = 1; i < count; ++i) last = next_free(last);
+    cache.free_head = next_free(last);
+    cache.free_count -= count;
+    arena_state& shared = state();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    set_next_free(last, shared.free_head);
+    shared.free_head = first;
+  }
+
+  static void reserve() {
+    void* memory =
+        ::mmap(nullptr, std::size_t{kCapacity} * sizeof(T),
+               PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (memory == MAP_FAILED) throw std::bad_alloc();
+    base_ = static_cast<T*>(memory);
+  }
+
+  // Set once, under the mutex, before the first slot is handed out.
+  static inline T* base_ = nullptr;
+  // Set when the thread's cache is destroyed; trivially destructible, so
+  // it can still be read after that.
+  static inline thread_local bool cache_gone_ = false;
+};
+
+/*
+ * Stateless allocator over node_arena<T>: all instances are equal and free
+ * each other's memory. Single objects come from the arena; arrays (which
+ * RedBlackTree never asks for) from operator new. The arena is thread-safe,
+ * so nodes may be allocated and freed from any thread.
+ */
+template <typename T>
+class node_arena_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using is_always_equal = std::true_type;
+
+  node_arena_allocator() noexcept = default;
+  template <typename U>
+  node_arena_allocator(const node_arena_allocator<U>&) noexcept {}
+
+  T* allocate(size_type n) {
+    if (n != 1) {
+      if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<T*>(
+          ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+    return node_arena<T>::allocate();
+  }
+
+  void deallocate(T* p, size_type n) noexcept {
+    if (n != 1) {
+      ::operator delete(p, std::align_val_t(alignof(T)));
+    } else {
+      node_arena<T>::deallocate(p);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const node_arena_allocator<U>&) const noexcept {
+    return true;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_NODE_ARENA_H_
@@ -0,0 +1,293 @@
+#ifndef S21_NODE_POOL_ALLOCATOR_H_
+#define S21_NODE_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <memory>:
+ *  std::shared_ptr, std::make_shared: The pool is shared by an allocator, its
+ *    copies and its rebinds, and freed together with the last of them.
+ *
+ * From <new>:
+ *  ::operator new/delete with std::align_val_t: Raw memory for slabs and for
+ *    requests the pool does not serve (arrays, unusual sizes/alignments).
+ *
+ * From <type_traits>:
+ *  std::true_type, std::false_type: Allocator propagation traits.
+ */
+
+namespace s21 {
+
+/*
+ * Untyped slab pool for single-object allocations.
+ *
+ * Each distinct (size, alignment) gets a size class with its own free list.
+ * Chunks are carved from slabs that double in size up to kMaxSlabChunks
+ * chunks; freed chunks go to the free list and are reused first. Slabs are
+ * only returned to the system by release() or when the pool is destroyed.
+ * Not thread-safe: a pool belongs to one container at a time.
+ */
+class node_pool {
+ public:
+  static constexpr std::size_t kMaxSizeClasses = 4;
+  static constexpr std::size_t kFirstSlabChunks = 64;
+  static constexpr std::size_t kMaxSlabChunks = std::size_t(1) << 16;
+
+  node_pool() = default;
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() { release(); }
+
+  void* allocate(std::size_t size, std::size_t alignment) {
+    size_class* sc = find_class(size, alignment, true);
+    if (!sc) {
+      return ::operator new(size, std::align_val_t(alignment));
+    }
+    if (sc->free_list) {
+      free_chunk* chunk = sc->free_list;
+      sc->free_list = chunk->next;
+      return chunk;
+    }
+    if (sc->cursor == sc->end) {
+      refill(*sc);
+    }
+    void* result = sc->cursor;
+    sc->cursor += sc->chunk;
+    return result;
+  }
+
+  void deallocate(void* p, std::size_t size, std::size_t alignment) noexcept {
+    size_class* sc = find_class(size, alignment, false);
+    if (!sc) {
+      ::operator delete(p, std::align_val_t(alignment));
+      return;
+    }
+    free_chunk* chunk = static_cast<free_chunk*>(p);
+    chunk->next = sc->free_list;
+    sc->free_list = chunk;
+  }
+
+  /*
+   * Takes over all memory of other: its slabs, free chunks and the unused
+   * tail of its current slabs. Chunks other handed out may then be returned
+   * to this pool and live until this pool releases. Fails without changing
+   * anything when other uses a size class this pool has no room for.
+   */
+  bool absorb(node_pool& other) noexcept {
+    if (&other == this) return true;
+    size_class* targets[kMaxSizeClasses] = {};
+    std::size_t free_classes = kMaxSizeClasses - class_count_;
+    for (std::size_t i = 0; i < other.class_count_; ++i) {
+      const size_class& theirs = other.classes_[i];
+      targets[i] = find_class(theirs.size, theirs.alignment, false);
+      if (!targets[i] && free_classes-- == 0) return false;
+    }
+    for (std::size_t i = 0; i < other.class_count_; ++i) {
+      size_class& theirs = other.classes_[i];
+      size_class* ours = targets[i] ? targets[i]
+                                    : find_class(theirs.size, theirs.alignment,
+                                                 true);
+      for (; theirs.cursor != theirs.end; theirs.cursor += theirs.chunk) {
+        free_chunk* chunk = reinterpret_cast<free_chunk*>(theirs.cursor);
+        chunk->next = ours->free_list;
+        ours->free_list = chunk;
+      }
+      while (theirs.free_list) {
+        free_chunk* chunk = theirs.free_list;
+        theirs.free_list = chunk->next;
+        chunk->next = ours->free_list;
+        ours->free_list = chunk;
+      }
+    }
+    while (other.slabs_) {
+      slab* next = other.slabs_->next;
+      other.slabs_->next = slabs_;
+      slabs_ = other.slabs_;
+      other.slabs_ = next;
+    }
+    other.release();
+    return true;
+  }
+
+  // Frees every slab at once; all chunks handed out become invalid.
+  void release() noexcept {
+    while (slabs_) {
+      slab* next = slabs_->next;
+      ::operator delete(slabs_);
+      slabs_ = next;
+    }
+    for (std::size_t i = 0; i < class_count_; ++i) {
+      classes_[i].free_list = nullptr;
+      classes_[i].cursor = nullptr;
+      classes_[i].end = nullptr;
+      classes_[i].next_slab_chunks = kFirstSlabChunks;
+    }
+  }
+
+ private:
+  struct free_chunk {
+    free_chunk* next;
+  };
+
+  struct alignas(std::max_align_t) slab {
+    slab* next;
+  };
+
+  struct size_class {
+    std::size_t size = 0;
+    std::size_t alignment = 0;
+    std::size_t chunk = 0;
+    free_chunk* free_list = nullptr;
+    char* cursor = nullptr;
+    char* end = nullptr;
+    std::size_t next_slab_chunks = kFirstSlabChunks;
+  };
+
+  size_class* find_class(std::size_t size, std::size_t alignment,
+                         bool create) noexcept {
+    for (std::size_t i = 0; i < class_count_; ++i) {
+      if (classes_[i].size == size && classes_[i].alignment == alignment) {
+        return &classes_[i];
+      }
+    }
+    if (!create || class_count_ == kMaxSizeClasses ||
+        alignment > alignof(std::max_align_t)) {
+      return nullptr;
+    }
+    size_class& sc = classes_[class_count_++];
+    sc.size = size;
+    sc.alignment = alignment;
+    std::size_t chunk = size < sizeof(free_chunk) ? sizeof(free_chunk) : size;
+    std::size_t align = alignment < alignof(free_chunk) ? alignof(free_chunk)
+                                                        : alignment;
+    sc.chunk = (chunk + align - 1) / align * align;
+    return &sc;
+  }
+
+  void refill(size_class& sc) {
+    std::size_t chunks = sc.next_slab_chunks;
+    slab* s =
+        static_cast<slab*>(::operator new(sizeof(slab) + chunks * sc.chunk));
+    s->next = slabs_;
+    slabs_ = s;
+    sc.cursor = reinterpret_cast<char*>(s + 1);
+    sc.end = sc.cursor + chunks * sc.chunk;
+    if (sc.next_slab_chunks < kMaxSlabChunks) {
+      sc.next_slab_chunks *= 2;
+    }
+  }
+
+  size_class classes_[kMaxSizeClasses];
+  std::size_t class_count_ = 0;
+  slab* slabs_ = nullptr;
+};
+
+/*
+ * Allocator that serves single objects from a node_pool.
+ *
+ * Copies and rebinds share the pool, so RedBlackTree's rebound node
+ * allocator draws from the same pool as the allocator the map was given.
+ * Two allocators are equal only when they share a pool. A container copy
+ * gets a fresh pool (select_on_container_copy_construction), and a
+ * moved-from allocator creates a new pool on its next allocation.
+ *
+ * can_release()/release() let a container that is the only user of the pool
+ * drop all of its nodes at once instead of freeing them one by one.
+ *
+ * Containers built on one allocator share its pool, which has no locking:
+ * they must be used under one lock (or from one thread), even when each
+ * is otherwise only touched by its own thread.
+ */
+template <typename T>
+class node_pool_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  node_pool_allocator() : pool_(std::make_shared<node_pool>()) {}
+  explicit node_pool_allocator(std::shared_ptr<node_pool> pool) noexcept
+      : pool_(std::move(pool)) {}
+  node_pool_allocator(const node_pool_allocator&) noexcept = default;
+  node_pool_allocator(node_pool_allocator&& other) noexcept
+      : pool_(std::move(other.pool_)) {}
+  template <typename U>
+  node_pool_allocator(const node_pool_allocator<U>& other) noexcept
+      : pool_(other.pool_) {}
+
+  node_pool_allocator& operator=(const node_pool_allocator&) noexcept = default;
+  node_pool_allocator& operator=(node_pool_allocator&& other) noexcept {
+    pool_ = std::move(other.pool_);
+    return *this;
+  }
+
+  T* allocate(size_type n) {
+    if (!pool_) {
+      pool_ = std::make_shared<node_pool>();
+    }
+    if (n != 1) {
+      if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<T*>(
+          ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+    return static_cast<T*>(pool_->allocate(sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_type n) noexcept {
+    if (n != 1) {
+      ::operator delete(p, std::align_val_t(alignof(T)));
+    } else {
+      pool_->deallocate(p, sizeof(T), alignof(T));
+    }
+  }
+
+  node_pool_allocator select_on_container_copy_construction() const {
+    return node_pool_allocator();
+  }
+
+  bool can_release() const noexcept { return pool_ && pool_.use_count() == 1; }
+  void release() noexcept {
+    if (pool_) pool_->release();
+  }
+
+  /*
+   * Moves the memory of other's pool into this allocator's pool, so that
+   * everything other allocated can be freed through this allocator. Only
+   * possible when other is the sole owner of its pool. other keeps its own,
+   * now empty pool, never this one: the two stay independent, but other
+   * must not free what it allocated before. RedBlackTree's parallel copy
+   * uses this to take over the nodes its workers built.
+   */
+  bool absorb(node_pool_allocator& other) noexcept {
+    if (pool_ == other.pool_) return true;
+    if (!pool_ || (other.pool_ && other.pool_.use_count() != 1)) return false;
+    return !other.pool_ || pool_->absorb(*other.pool_);
+  }
+
+  const std::shared_ptr<node_pool>& pool() const noexcept { return pool_; }
+
+  template <typename U>
+  bool operator==(const node_pool_allocator<U>& other) const noexcept {
+    return pool_ == other.pool();
+  }
+
+ private:
+  template <typename U>
+  friend class node_pool_allocator;
+
+  std::shared_ptr<node_pool> pool_;
+};
+
+}  // namespace s21
+
+#endif  // S21_NODE_POOL_ALLOCATOR_H_
@@ -2,8 +2,12 @@
 #define _SUPPORTED_DEQUE_H_
 
 #include <cstddef>
+#include <iterator>
+#include <ranges>
 #include <stdexcept>
 
+#include "../../s21_container_tags.h"
+
 namespace s21 {
 template <typename T>
 class deque {
@@ -35,6 +39,17 @@ class deque {
     }
   }
 
+  template <std::input_iterator InputIt>
+  deque(InputIt first, InputIt last)
+      : head(nullptr), tail(nullptr), deque_size(0) {
+    append_range(first, last);
+  }
+
+  template <container_compatible_range<T> R>
+  deque(from_range_t, R&& rg) : head(nullptr), tail(nullptr), deque_size(0) {
+    append_range(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+
   deque(const deque& other) : head(nullptr), tail(nullptr), deque_size(0) {
     Node* current = other.head;
     while (current != nullptr) {
@@ -184,6 +199,12 @@ class deque {
     deque_size--;
   }
 
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    deque fresh(first, last);
+    swap(fresh);
+  }
+
   void swap(deque& other) {
     Node* temp_head = head;
     Node* temp_tail = tail;
@@ -195,6 +216,44 @@ class deque {
     other.tail = temp_tail;
     other.deque_size = temp_size;
   }
+
+ private:
+  // builds the new nodes as a detached chain first, so a throwing copy
+  // leaves the deque unchanged, then attaches the chain in one step
+  template <typename It, typename Sent>
+  void append_range(It first, Sent last) {
+    Node* chain_head = nullptr;
+    Node* chain_tail = nullptr;
+    size_type count = 0;
+    try {
+      for (; first != last; ++first, ++count) {
+        Node* node = new Node(*first);
+        node->prev = chain_tail;
+        if (chain_tail) {
+          chain_tail->next = node;
+        } else {
+          chain_head = node;
+        }
+        chain_tail = node;
+      }
+    } catch (...) {
+      while (chain_head) {
+        Node* temp = chain_head;
+        chain_head = chain_head->next;
+        delete temp;
+      }
+      throw;
+    }
+    if (!chain_head) return;
+    if (tail) {
+      tail->next = chain_head;
+      chain_head->prev = tail;
+    } else {
+      head = chain_head;
+    }
+    tail = chain_tail;
+    deque_size += count;
+  }
 };
 }  // namespace s21
 
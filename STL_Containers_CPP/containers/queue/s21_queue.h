@@ -3,7 +3,9 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
 #include "./deque/s21_deque.h"
 
@@ -26,11 +28,14 @@ class queue {  // FIFO - First In First Out
 
   queue(size_type n) : deque_(n) {}
 
-  queue(std::initializer_list<value_type> const& items) {
-    for (const auto& item : items) {
-      deque_.push_back(item);
-    }
-  }
+  queue(std::initializer_list<value_type> const& items)
+      : deque_(items.begin(), items.end()) {}
+
+  template <std::input_iterator InputIt>
+  queue(InputIt first, InputIt last) : deque_(first, last) {}
+
+  template <container_compatible_range<T> R>
+  queue(from_range_t, R&& rg) : deque_(from_range, std::forward<R>(rg)) {}
 
   queue(const queue& q) : deque_(q.deque_) {}
 
@@ -72,6 +77,11 @@ class queue {  // FIFO - First In First Out
   void pop() { deque_.pop_front(); }
 
   void swap(queue& other) { deque_.swap(other.deque_); }
+
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    deque_.assign(first, last);
+  }
 };
 }  // namespace s21
 
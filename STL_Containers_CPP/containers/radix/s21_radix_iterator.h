@@ -0,0 +1,88 @@
+#ifndef S21_RADIX_ITERATOR_H_
+#define S21_RADIX_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/*
+ * From <iterator>:
+ *  std::bidirectional_iterator_tag: The iterator category.
+ *
+ * From <type_traits>:
+ *  std::conditional_t: Picks const or non-const links and element types
+ *    depending on 'IsConst'.
+ */
+
+#include "s21_radix_node.h"
+
+namespace s21 {
+
+/*
+ * Position of an element: its leaf in the tree's list of leaves, or the
+ * list header for end(). Leaves do not move when inner nodes grow, shrink
+ * or split, so only erasing an element invalidates iterators to it.
+ */
+template <typename T, bool IsConst>
+class RadixIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+  using Leaf = RadixLeaf<T>;
+  using links_pointer =
+      std::conditional_t<IsConst, const RadixLeafLinks*, RadixLeafLinks*>;
+
+  RadixIterator() : links_(nullptr) {}
+  explicit RadixIterator(links_pointer links) : links_(links) {}
+
+  operator RadixIterator<T, true>() const {
+    return RadixIterator<T, true>(links_);
+  }
+
+  reference operator*() const { return leaf()->value; }
+  pointer operator->() const { return &leaf()->value; }
+
+  RadixIterator& operator++() {
+    links_ = links_->next;
+    return *this;
+  }
+  RadixIterator operator++(int) {
+    RadixIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+  RadixIterator& operator--() {
+    links_ = links_->prev;
+    return *this;
+  }
+  RadixIterator operator--(int) {
+    RadixIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  template <bool OtherIsConst>
+  bool operator==(const RadixIterator<T, OtherIsConst>& other) const {
+    return links_ == other.get_links();
+  }
+
+  links_pointer get_links() const { return links_; }
+
+ private:
+  links_pointer links_;
+
+  auto* leaf() const {
+    if constexpr (IsConst) {
+      return static_cast<const Leaf*>(links_);
+    } else {
+      return static_cast<Leaf*>(links_);
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_RADIX_ITERATOR_H_
@@ -0,0 +1,94 @@
+#ifndef S21_RADIX_KEY_H_
+#define S21_RADIX_KEY_H_
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * From <array>:
+ *  std::array: The big-endian bytes of an integer key.
+ *
+ * From <concepts>:
+ *  std::unsigned_integral, std::signed_integral: Pick the integer
+ *    encodings.
+ *
+ * From <string>, <string_view>:
+ *  std::string: The variable-length key type; its bytes are used as they
+ *    are, through a std::string_view.
+ *
+ * From <type_traits>:
+ *  std::make_unsigned_t: Signed keys are encoded as their unsigned bit
+ *    pattern with the sign bit flipped.
+ */
+
+namespace s21 {
+
+/*
+ * How RadixTree turns a key into the bytes it branches on. The encoding
+ * must order like the key: comparing two encodings byte by byte (a shorter
+ * one first when it is a prefix of the other) gives the order of the keys.
+ * Each specialisation provides
+ *
+ *   static constexpr bool kFixedLength;  // every key has the same length
+ *   static <bytes> encode(const Key&);   // indexable, with size()
+ *
+ * where the bytes are an std::array or a std::string_view, read through
+ * radix_byte().
+ */
+template <typename Key>
+struct radix_key;
+
+// Big-endian, so that the most significant byte branches first.
+template <std::unsigned_integral Key>
+struct radix_key<Key> {
+  static constexpr bool kFixedLength = true;
+
+  static std::array<unsigned char, sizeof(Key)> encode(Key key) noexcept {
+    std::array<unsigned char, sizeof(Key)> bytes;
+    for (std::size_t i = sizeof(Key); i-- > 0; key >>= 8) {
+      bytes[i] = static_cast<unsigned char>(key);
+    }
+    return bytes;
+  }
+};
+
+// Flipping the sign bit puts negative keys before positive ones.
+template <std::signed_integral Key>
+struct radix_key<Key> {
+  static constexpr bool kFixedLength = true;
+
+  static std::array<unsigned char, sizeof(Key)> encode(Key key) noexcept {
+    using Unsigned = std::make_unsigned_t<Key>;
+    constexpr Unsigned kSignBit = Unsigned{1} << (sizeof(Key) * 8 - 1);
+    return radix_key<Unsigned>::encode(static_cast<Unsigned>(key) ^ kSignBit);
+  }
+};
+
+template <>
+struct radix_key<std::string> {
+  static constexpr bool kFixedLength = false;
+
+  static std::string_view encode(std::string_view key) noexcept {
+    return key;
+  }
+};
+
+// Keys RadixTree can store.
+template <typename Key>
+concept radix_encodable = requires(const Key& key) {
+  { radix_key<Key>::kFixedLength } -> std::convertible_to<bool>;
+  radix_key<Key>::encode(key);
+};
+
+template <typename Bytes>
+unsigned char radix_byte(const Bytes& bytes, std::size_t i) noexcept {
+  return static_cast<unsigned char>(bytes[i]);
+}
+
+}  // namespace s21
+
+#endif  // S21_RADIX_KEY_H_
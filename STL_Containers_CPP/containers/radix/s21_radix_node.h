@@ -0,0 +1,345 @@
+#ifndef S21_RADIX_NODE_H_
+#define S21_RADIX_NODE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * From <cstdint>:
+ *  std::uint8_t, std::uint16_t, std::uint32_t: The node kind, the child
+ *    count and the compressed prefix length.
+ *
+ * From <cstring>:
+ *  std::memmove: Shifts the sorted keys and children of Node4 and Node16.
+ *
+ * From <emmintrin.h>:
+ *  _mm_cmpeq_epi8, _mm_movemask_epi8: Find a byte among the 16 keys of a
+ *    Node16 with one comparison.
+ */
+
+namespace s21 {
+
+/*
+ * The nodes of RadixTree, an adaptive radix tree (Leis et al., "The
+ * Adaptive Radix Tree", ICDE 2013). Inner nodes branch on one key byte and
+ * come in four sizes, each used while its children fit:
+ *
+ *   Node4, Node16  sorted key bytes next to their child pointers
+ *   Node48         a 256-entry byte index into 48 child pointers
+ *   Node256        one child pointer per byte value
+ *
+ * Every inner node also skips a compressed path ('prefix_len' bytes that
+ * all keys below it share); the first kMaxPrefix of them are kept inline
+ * and the rest are read from any leaf below when needed. A key that ends
+ * exactly at an inner node hangs from its 'terminal' slot, which sorts
+ * before all children. A subtree with a single key is just its leaf.
+ */
+enum class RadixKind : std::uint8_t {
+  kLeaf,
+  kNode4,
+  kNode16,
+  kNode48,
+  kNode256
+};
+
+struct RadixNode {
+  RadixKind kind;
+
+  explicit RadixNode(RadixKind k) noexcept : kind(k) {}
+  bool is_leaf() const noexcept { return kind == RadixKind::kLeaf; }
+};
+
+// The leaves form a circular doubly-linked list in key order through a
+// header owned by the tree, so iteration never touches inner nodes.
+struct RadixLeafLinks {
+  RadixLeafLinks* prev = this;
+  RadixLeafLinks* next = this;
+
+  void link_before(RadixLeafLinks* position) noexcept {
+    prev = position->prev;
+    next = position;
+    prev->next = this;
+    position->prev = this;
+  }
+  void unlink() noexcept {
+    prev->next = next;
+    next->prev = prev;
+  }
+  // Moves the list headed by 'from' under this header; 'from' is left
+  // empty and this header's own list is dropped.
+  void take_list(RadixLeafLinks& from) noexcept {
+    if (from.next == &from) {
+      prev = next = this;
+      return;
+    }
+    next = from.next;
+    prev = from.prev;
+    next->prev = this;
+    prev->next = this;
+    from.prev = from.next = &from;
+  }
+};
+
+template <typename T>
+struct RadixLeaf : RadixNode, RadixLeafLinks {
+  T value;
+
+  template <typename... Args>
+  explicit RadixLeaf(Args&&... args)
+      : RadixNode(RadixKind::kLeaf), value(static_cast<Args&&>(args)...) {}
+};
+
+struct RadixInner : RadixNode {
+  static constexpr std::size_t kMaxPrefix = 10;
+
+  std::uint16_t count = 0;
+  unsigned char prefix[kMaxPrefix] = {};
+  std::uint32_t prefix_len = 0;
+  RadixNode* terminal = nullptr;
+
+  using RadixNode::RadixNode;
+};
+
+struct RadixNode4 : RadixInner {
+  static constexpr std::size_t kCapacity = 4;
+  unsigned char keys[kCapacity] = {};
+  RadixNode* children[kCapacity] = {};
+
+  RadixNode4() noexcept : RadixInner(RadixKind::kNode4) {}
+};
+
+struct RadixNode16 : RadixInner {
+  static constexpr std::size_t kCapacity = 16;
+  unsigned char keys[kCapacity] = {};
+  RadixNode* children[kCapacity] = {};
+
+  RadixNode16() noexcept : RadixInner(RadixKind::kNode16) {}
+};
+
+struct RadixNode48 : RadixInner {
+  static constexpr std::size_t kCapacity = 48;
+  // slot + 1 of each byte's child, 0 when there is none
+  unsigned char index[256] = {};
+  RadixNode* children[kCapacity] = {};
+
+  RadixNode48() noexcept : RadixInner(RadixKind::kNode48) {}
+};
+
+struct RadixNode256 : RadixInner {
+  static constexpr std::size_t kCapacity = 256;
+  RadixNode* children[kCapacity] = {};
+
+  RadixNode256() noexcept : RadixInner(RadixKind::kNode256) {}
+};
+
+// Position of byte among the first count sorted keys, count if absent.
+inline std::size_t radix_find_key(const unsigned char* keys, std::size_t count,
+                                  unsigned char byte) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    if (keys[i] == byte) return i;
+  }
+  return count;
+}
+
+inline std::size_t radix_find_key16(const unsigned char* keys,
+                                    std::size_t count,
+                                    unsigned char byte) noexcept {
+#if defined(__SSE2__)
+  __m128i cmp = _mm_cmpeq_epi8(
+      _mm_set1_epi8(static_cast<char>(byte)),
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys)));
+  unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp)) &
+                  ((1u << count) - 1);
+  return mask ? static_cast<std::size_t>(__builtin_ctz(mask)) : count;
+#else
+  return radix_find_key(keys, count, byte);
+#endif
+}
+
+// The child slot for byte, or nullptr.
+inline RadixNode** radix_find_child(RadixInner* node,
+                                    unsigned char byte) noexcept {
+  switch (node->kind) {
+    case RadixKind::kNode4: {
+      auto* n = static_cast<RadixNode4*>(node);
+      std::size_t i = radix_find_key(n->keys, n->count, byte);
+      return i < n->count ? &n->children[i] : nullptr;
+    }
+    case RadixKind::kNode16: {
+      auto* n = static_cast<RadixNode16*>(node);
+      std::size_t i = radix_find_key16(n->keys, n->count, byte);
+      return i < n->count ? &n->children[i] : nullptr;
+    }
+    case RadixKind::kNode48: {
+      auto* n = static_cast<RadixNode48*>(node);
+      return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+    }
+    default: {
+      auto* n = static_cast<RadixNode256*>(node);
+      return n->children[byte] ? &n->children[byte] : nullptr;
+    }
+  }
+}
+
+/*
+ * The first child whose byte is >= from (or > from when 'strict'), in byte
+ * order; nullptr when there is none. 'byte' receives its key byte.
+ */
+inline RadixNode* radix_next_child(const RadixInner* node, unsigned from,
+                                   bool strict,
+                                   unsigned char* byte = nullptr) noexcept {
+  unsigned first = strict ? from + 1 : from;
+  auto found = [byte](RadixNode* child, unsigned b) {
+    if (byte) *byte = static_cast<unsigned char>(b);
+    return child;
+  };
+  switch (node->kind) {
+    case RadixKind::kNode4:
+    case RadixKind::kNode16: {
+      const unsigned char* keys =
+          node->kind == RadixKind::kNode4
+              ? static_cast<const RadixNode4*>(node)->keys
+              : static_cast<const RadixNode16*>(node)->keys;
+      RadixNode* const* children =
+          node->kind == RadixKind::kNode4
+              ? static_cast<const RadixNode4*>(node)->children
+              : static_cast<const RadixNode16*>(node)->children;
+      for (std::size_t i = 0; i < node->count; ++i) {
+        if (keys[i] >= first) return found(children[i], keys[i]);
+      }
+      return nullptr;
+    }
+    case RadixKind::kNode48: {
+      auto* n = static_cast<const RadixNode48*>(node);
+      for (unsigned b = first; b < 256; ++b) {
+        if (n->index[b]) return found(n->children[n->index[b] - 1], b);
+      }
+      return nullptr;
+    }
+    default: {
+      auto* n = static_cast<const RadixNode256*>(node);
+      for (unsigned b = first; b < 256; ++b) {
+        if (n->children[b]) return found(n->children[b], b);
+      }
+      return nullptr;
+    }
+  }
+}
+
+// The child with the largest byte; the node must have one.
+inline RadixNode* radix_last_child(const RadixInner* node) noexcept {
+  switch (node->kind) {
+    case RadixKind::kNode4:
+      return static_cast<const RadixNode4*>(node)->children[node->count - 1];
+    case RadixKind::kNode16:
+      return static_cast<const RadixNode16*>(node)->children[node->count - 1];
+    case RadixKind::kNode48: {
+      auto* n = static_cast<const RadixNode48*>(node);
+      for (unsigned b = 256; b-- > 0;) {
+        if (n->index[b]) return n->children[n->index[b] - 1];
+      }
+      return nullptr;
+    }
+    default: {
+      auto* n = static_cast<const RadixNode256*>(node);
+      for (unsigned b = 256; b-- > 0;) {
+        if (n->children[b]) return n->children[b];
+      }
+      return nullptr;
+    }
+  }
+}
+
+// Sorted insert into the keys and children of a Node4 or Node16 with room.
+template <typename SortedNode>
+void radix_insert_sorted(SortedNode* node, unsigned char byte,
+                         RadixNode* child) noexcept {
+  std::size_t i = 0;
+  while (i < node->count && node->keys[i] < byte) ++i;
+  std::size_t tail = node->count - i;
+  std::memmove(node->keys + i + 1, node->keys + i, tail);
+  std::memmove(node->children + i + 1, node->children + i,
+               tail * sizeof(RadixNode*));
+  node->keys[i] = byte;
+  node->children[i] = child;
+  ++node->count;
+}
+
+template <typename SortedNode>
+void radix_erase_sorted(SortedNode* node, std::size_t i) noexcept {
+  std::size_t tail = node->count - i - 1;
+  std::memmove(node->keys + i, node->keys + i + 1, tail);
+  std::memmove(node->children + i, node->children + i + 1,
+               tail * sizeof(RadixNode*));
+  --node->count;
+}
+
+// Adds a child whose byte is larger than all present ones, as when
+// copying or resizing a node in byte order.
+inline void radix_append(RadixInner* node, unsigned char byte,
+                         RadixNode* child) noexcept {
+  switch (node->kind) {
+    case RadixKind::kNode4: {
+      auto* n = static_cast<RadixNode4*>(node);
+      n->keys[n->count] = byte;
+      n->children[n->count] = child;
+      break;
+    }
+    case RadixKind::kNode16: {
+      auto* n = static_cast<RadixNode16*>(node);
+      n->keys[n->count] = byte;
+      n->children[n->count] = child;
+      break;
+    }
+    case RadixKind::kNode48: {
+      auto* n = static_cast<RadixNode48*>(node);
+      n->children[n->count] = child;
+      n->index[byte] = static_cast<unsigned char>(n->count + 1);
+      break;
+    }
+    default:
+      static_cast<RadixNode256*>(node)->children[byte] = child;
+  }
+  ++node->count;
+}
+
+// Calls fn(byte, child) for every child in byte order.
+template <typename F>
+void radix_for_each_child(const RadixInner* node, F&& fn) {
+  switch (node->kind) {
+    case RadixKind::kNode4: {
+      auto* n = static_cast<const RadixNode4*>(node);
+      for (std::size_t i = 0; i < n->count; ++i) fn(n->keys[i], n->children[i]);
+      break;
+    }
+    case RadixKind::kNode16: {
+      auto* n = static_cast<const RadixNode16*>(node);
+      for (std::size_t i = 0; i < n->count; ++i) fn(n->keys[i], n->children[i]);
+      break;
+    }
+    case RadixKind::kNode48: {
+      auto* n = static_cast<const RadixNode48*>(node);
+      for (unsigned b = 0; b < 256; ++b) {
+        if (n->index[b]) {
+          fn(static_cast<unsigned char>(b), n->children[n->index[b] - 1]);
+        }
+      }
+      break;
+    }
+    default: {
+      auto* n = static_cast<const RadixNode256*>(node);
+      for (unsigned b = 0; b < 256; ++b) {
+        if (n->children[b]) fn(static_cast<unsigned char>(b), n->children[b]);
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_RADIX_NODE_H_
@@ -0,0 +1,188 @@
+#ifndef S21_RADIX_TREE_H_
+#define S21_RADIX_TREE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+/*
+ * From <memory>:
+ *  std::allocator, std::allocator_traits: Allocate the leaves and the four
+ *    inner node types through rebound copies of 'Allocator'.
+ *
+ * From <string_view>:
+ *  std::string_view: The prefix of prefix_range().
+ *
+ * From <utility>:
+ *  std::pair: Returned by try_emplace() and emplace() to bundle an iterator
+ *    and whether the element was inserted, and by prefix_range().
+ */
+
+#include "s21_radix_iterator.h"
+#include "s21_radix_key.h"
+#include "s21_radix_node.h"
+
+namespace s21 {
+
+/*
+ * An adaptive radix tree of unique keys, the engine behind radix_map. Keys
+ * are turned into bytes (see radix_key) and the tree branches on one byte
+ * per level, so a lookup costs O(key length) byte steps and one full key
+ * comparison at the leaf, independent of the number of elements; a long
+ * prefix shared by many keys is skipped in one step by path compression.
+ * Inner nodes grow from 4 to 16, 48 and 256 children as needed and shrink
+ * back on erase (see s21_radix_node.h).
+ *
+ * The leaves hold the elements and are also linked in key order, so
+ * iteration is a list walk and elements never move: only erase
+ * invalidates iterators, and only those to the erased element.
+ *
+ *Key type, see radix_key for the supported ones
+ *Value type,
+ *Traits functor get key from value: SetTraits, MapTraits.
+ *Allocator class for memory handling, rebound to the node types
+ */
+template <typename Key, typename T, typename Traits,
+          typename Allocator = std::allocator<T>>
+  requires radix_encodable<Key>
+class RadixTree {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using size_type = std::size_t;
+
+  using Leaf = RadixLeaf<value_type>;
+  using iterator = RadixIterator<value_type, false>;
+  using const_iterator = RadixIterator<value_type, true>;
+
+  static constexpr bool kFixedLength = radix_key<Key>::kFixedLength;
+
+  // Inner nodes of each size, see node_counts().
+  struct NodeCounts {
+    size_type node4 = 0;
+    size_type node16 = 0;
+    size_type node48 = 0;
+    size_type node256 = 0;
+  };
+
+  explicit RadixTree(const Allocator& alloc = Allocator());
+  RadixTree(const RadixTree& other);
+  RadixTree(RadixTree&& other) noexcept;
+  ~RadixTree();
+
+  RadixTree& operator=(const RadixTree& other);
+  RadixTree& operator=(RadixTree&& other) noexcept;
+
+  iterator begin() noexcept { return iterator(header_.next); }
+  const_iterator begin() const noexcept {
+    return const_iterator(header_.next);
+  }
+  iterator end() noexcept { return iterator(&header_); }
+  const_iterator end() const noexcept { return const_iterator(&header_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  NodeCounts node_counts() const noexcept;
+
+  void clear() noexcept;
+  // Descends with key first and builds the element from args only when the
+  // key is not present; args must produce an element with that key.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  size_type erase_key(const key_type& key);
+  void swap(RadixTree& other) noexcept;
+
+  iterator find(const key_type& key);
+  const_iterator find(const key_type& key) const;
+  iterator lower_bound(const key_type& key);
+  const_iterator lower_bound(const key_type& key) const;
+  iterator upper_bound(const key_type& key);
+  const_iterator upper_bound(const key_type& key) const;
+  // [first, last) of the keys that start with prefix: one descent to the
+  // subtree below the prefix, then its smallest and largest leaves.
+  std::pair<iterator, iterator> prefix_range(std::string_view prefix)
+    requires(!kFixedLength);
+  std::pair<const_iterator, const_iterator> prefix_range(
+      std::string_view prefix) const
+    requires(!kFixedLength);
+
+ private:
+  RadixNode* root_ = nullptr;
+  RadixLeafLinks header_;
+  size_type size_ = 0;
+  Allocator allocator_;
+  Traits key_extractor_;
+
+  template <typename Node, typename... Args>
+  Node* create(Args&&... args);
+  template <typename Node>
+  void destroy(Node* node) noexcept;
+  void destroy_inner(RadixInner* node) noexcept;
+  void destroy_subtree(RadixNode* node) noexcept;
+  RadixNode* copy_subtree(const RadixNode* source);
+
+  static const Leaf* as_leaf(const RadixNode* node) noexcept {
+    return static_cast<const Leaf*>(node);
+  }
+  static Leaf* as_leaf(RadixNode* node) noexcept {
+    return static_cast<Leaf*>(node);
+  }
+  static const Leaf* minimum(const RadixNode* node) noexcept;
+  static const Leaf* maximum(const RadixNode* node) noexcept;
+  static RadixLeafLinks* links(const Leaf* leaf) noexcept {
+    return const_cast<Leaf*>(leaf);
+  }
+
+  auto encode(const key_type& key) const {
+    return radix_key<Key>::encode(key);
+  }
+  auto leaf_bytes(const RadixNode* leaf) const {
+    return encode(key_extractor_(as_leaf(leaf)->value));
+  }
+  template <typename Bytes>
+  bool leaf_matches(const RadixNode* leaf, const Bytes& key) const;
+  template <typename Bytes>
+  std::size_t prefix_mismatch(const RadixInner* node, const Bytes& key,
+                              std::size_t depth) const;
+  template <typename Bytes>
+  static void set_prefix(RadixInner* node, const Bytes& bytes,
+                         std::size_t from, std::size_t length) noexcept;
+
+  template <typename Bytes>
+  RadixLeafLinks* find_links(const Bytes& key) const;
+  template <typename Bytes>
+  const Leaf* lower_bound_in(const RadixNode* node, const Bytes& key,
+                             std::size_t depth) const;
+  template <typename Bytes>
+  RadixLeafLinks* lower_bound_links(const Bytes& key) const;
+  std::pair<RadixLeafLinks*, RadixLeafLinks*> prefix_links(
+      std::string_view prefix) const;
+
+  // Links the leaf make() returns unless key is present.
+  template <typename Make>
+  std::pair<iterator, bool> insert_leaf(const key_type& key, Make make);
+  template <typename Bytes>
+  static void hang(RadixNode4* node, RadixNode* leaf, const Bytes& bytes,
+                   std::size_t at) noexcept;
+  void add_child(RadixNode*& ref, unsigned char byte, RadixNode* child);
+  void remove_child(RadixNode*& ref, unsigned char byte,
+                    std::size_t depth) noexcept;
+  void compact(RadixNode*& ref, std::size_t depth) noexcept;
+  // Replaces the inner node at ref by a To with the same contents.
+  template <typename To>
+  void resize(RadixNode*& ref);
+};
+
+}  // namespace s21
+
+#include "s21_radix_tree.tpp"
+
+#endif  // S21_RADIX_TREE_H_
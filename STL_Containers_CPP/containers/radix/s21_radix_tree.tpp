@@ -0,0 +1,808 @@
+#ifndef S21_RADIX_TREE_TPP_
+#define S21_RADIX_TREE_TPP_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+/*
+ * From <algorithm>:
+ *  std::min: Bounds the prefix bytes kept inline and compared.
+ *  std::equal: Compares a leaf's key bytes with the looked-up ones.
+ *
+ * From <cstring>:
+ *  std::memcpy: Copies compressed prefixes.
+ *
+ * From <memory>:
+ *  std::allocator_traits: Allocates, constructs, destroys and frees every
+ * node through the allocator rebound to its type.
+ *
+ * From <utility>:
+ *  std::exchange: Takes the nodes over in the move constructor.
+ *  std::move, std::forward: Pass elements on without copies.
+ *  std::swap: Exchanges the members in swap().
+ */
+
+namespace s21 {
+
+#define RT_TEMPLATE_PARAMS                                    \
+  template <typename K, typename T, typename Tr, typename A> \
+    requires radix_encodable<K>
+#define RT_CLASS RadixTree<K, T, Tr, A>
+
+RT_TEMPLATE_PARAMS
+RT_CLASS::RadixTree(const A& alloc) : allocator_(alloc) {}
+
+RT_TEMPLATE_PARAMS
+RT_CLASS::RadixTree(const RT_CLASS& other)
+    : allocator_(
+          std::allocator_traits<A>::select_on_container_copy_construction(
+              other.allocator_)),
+      key_extractor_(other.key_extractor_) {
+  if (other.root_) {
+    try {
+      root_ = copy_subtree(other.root_);
+    } catch (...) {
+      header_.prev = header_.next = &header_;
+      throw;
+    }
+    size_ = other.size_;
+  }
+}
+
+RT_TEMPLATE_PARAMS
+RT_CLASS::RadixTree(RT_CLASS&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      allocator_(std::move(other.allocator_)),
+      key_extractor_(std::move(other.key_extractor_)) {
+  header_.take_list(other.header_);
+}
+
+RT_TEMPLATE_PARAMS
+RT_CLASS::~RadixTree() { clear(); }
+
+RT_TEMPLATE_PARAMS
+RT_CLASS& RT_CLASS::operator=(const RT_CLASS& other) {
+  if (this != &other) {
+    RT_CLASS temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+RT_TEMPLATE_PARAMS
+RT_CLASS& RT_CLASS::operator=(RT_CLASS&& other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::size_type RT_CLASS::max_size() const noexcept {
+  using leaf_allocator =
+      typename std::allocator_traits<A>::template rebind_alloc<Leaf>;
+  return std::allocator_traits<leaf_allocator>::max_size(
+      leaf_allocator(allocator_));
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::NodeCounts RT_CLASS::node_counts() const noexcept {
+  NodeCounts counts;
+  auto visit = [&counts](auto& self, const RadixNode* node) -> void {
+    if (node->is_leaf()) return;
+    auto* inner = static_cast<const RadixInner*>(node);
+    switch (inner->kind) {
+      case RadixKind::kNode4:
+        ++counts.node4;
+        break;
+      case RadixKind::kNode16:
+        ++counts.node16;
+        break;
+      case RadixKind::kNode48:
+        ++counts.node48;
+        break;
+      default:
+        ++counts.node256;
+    }
+    radix_for_each_child(inner, [&](unsigned char, const RadixNode* child) {
+      self(self, child);
+    });
+  };
+  if (root_) visit(visit, root_);
+  return counts;
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::clear() noexcept {
+  if (root_) destroy_subtree(root_);
+  root_ = nullptr;
+  header_.prev = header_.next = &header_;
+  size_ = 0;
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::swap(RT_CLASS& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(allocator_, other.allocator_);
+  std::swap(key_extractor_, other.key_extractor_);
+  RadixLeafLinks temp;
+  temp.take_list(header_);
+  header_.take_list(other.header_);
+  other.header_.take_list(temp);
+}
+
+RT_TEMPLATE_PARAMS
+template <typename... Args>
+std::pair<typename RT_CLASS::iterator, bool> RT_CLASS::try_emplace(
+    const key_type& key, Args&&... args) {
+  return insert_leaf(
+      key, [&] { return create<Leaf>(std::forward<Args>(args)...); });
+}
+
+RT_TEMPLATE_PARAMS
+template <typename... Args>
+std::pair<typename RT_CLASS::iterator, bool> RT_CLASS::emplace(
+    Args&&... args) {
+  Leaf* leaf = create<Leaf>(std::forward<Args>(args)...);
+  std::pair<iterator, bool> result =
+      insert_leaf(key_extractor_(leaf->value), [leaf] { return leaf; });
+  if (!result.second) destroy(leaf);
+  return result;
+}
+
+/*
+ * Descends with the key's bytes until the key is found or its place is:
+ *  - an empty tree: the leaf becomes the root;
+ *  - a leaf with another key: a Node4 with their common bytes as prefix
+ *    takes both;
+ *  - an inner node whose prefix differs: a Node4 with the shared part
+ *    takes the node (with its prefix shortened) and the leaf;
+ *  - an inner node where the key ends: the leaf becomes its terminal;
+ *  - an inner node with no child for the next byte: the leaf is added,
+ *    growing the node when it is full.
+ * Each case knows the new leaf's neighbour, so it is linked into the list
+ * of leaves without another descent. Nothing changes before the leaf and
+ * any new node are allocated.
+ */
+RT_TEMPLATE_PARAMS
+template <typename Make>
+std::pair<typename RT_CLASS::iterator, bool> RT_CLASS::insert_leaf(
+    const key_type& lookup, Make make) {
+  auto key = encode(lookup);
+  RadixNode** ref = &root_;
+  std::size_t depth = 0;
+  auto make_with_node4 = [&](Leaf*& leaf) {
+    leaf = make();
+    try {
+      return create<RadixNode4>();
+    } catch (...) {
+      destroy(leaf);
+      throw;
+    }
+  };
+
+  if (!root_) {
+    Leaf* leaf = make();
+    root_ = leaf;
+    leaf->link_before(&header_);
+    ++size_;
+    return {iterator(leaf), true};
+  }
+  for (;;) {
+    RadixNode* node = *ref;
+    if (node->is_leaf()) {
+      auto existing = leaf_bytes(node);
+      std::size_t same = depth;
+      std::size_t limit = std::min(existing.size(), key.size());
+      while (same < limit &&
+             radix_byte(existing, same) == radix_byte(key, same)) {
+        ++same;
+      }
+      if (same == existing.size() && same == key.size()) {
+        return {iterator(as_leaf(node)), false};
+      }
+      Leaf* leaf;
+      RadixNode4* split = make_with_node4(leaf);
+      set_prefix(split, key, depth, same - depth);
+      hang(split, node, existing, same);
+      hang(split, leaf, key, same);
+      bool before = same == key.size() ||
+                    (same < existing.size() &&
+                     radix_byte(key, same) < radix_byte(existing, same));
+      leaf->link_before(before ? as_leaf(node) : as_leaf(node)->next);
+      *ref = split;
+      ++size_;
+      return {iterator(leaf), true};
+    }
+
+    auto* inner = static_cast<RadixInner*>(node);
+    if (inner->prefix_len) {
+      std::size_t m = prefix_mismatch(inner, key, depth);
+      if (m < inner->prefix_len) {
+        const Leaf* any = minimum(inner);
+        auto any_bytes = leaf_bytes(any);
+        unsigned char old_byte = radix_byte(any_bytes, depth + m);
+        RadixLeafLinks* after = maximum(inner)->next;
+        Leaf* leaf;
+        RadixNode4* split = make_with_node4(leaf);
+        set_prefix(split, key, depth, m);
+        set_prefix(inner, any_bytes, depth + m + 1, inner->prefix_len - m - 1);
+        radix_insert_sorted(split, old_byte, inner);
+        hang(split, leaf, key, depth + m);
+        bool before = depth + m == key.size() ||
+                      radix_byte(key, depth + m) < old_byte;
+        leaf->link_before(before ? links(any) : after);
+        *ref = split;
+        ++size_;
+        return {iterator(leaf), true};
+      }
+      depth += inner->prefix_len;
+    }
+
+    if (depth == key.size()) {
+      if (inner->terminal) return {iterator(as_leaf(inner->terminal)), false};
+      // the terminal sorts before everything else below the node
+      RadixLeafLinks* next = links(minimum(inner));
+      Leaf* leaf = make();
+      inner->terminal = leaf;
+      leaf->link_before(next);
+      ++size_;
+      return {iterator(leaf), true};
+    }
+
+    unsigned char byte = radix_byte(key, depth);
+    if (RadixNode** child = radix_find_child(inner, byte)) {
+      ref = child;
+      ++depth;
+      continue;
+    }
+    RadixNode* after = radix_next_child(inner, byte, true);
+    RadixLeafLinks* next =
+        after ? links(minimum(after)) : maximum(inner)->next;
+    Leaf* leaf = make();
+    try {
+      add_child(*ref, byte, leaf);
+    } catch (...) {
+      destroy(leaf);
+      throw;
+    }
+    leaf->link_before(next);
+    ++size_;
+    return {iterator(leaf), true};
+  }
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::iterator RT_CLASS::erase(const_iterator pos) {
+  RadixLeafLinks* next = const_cast<RadixLeafLinks*>(pos.get_links())->next;
+  erase_key(key_extractor_(*pos));
+  return iterator(next);
+}
+
+/*
+ * Descends like find(), remembering the slot and the depth of the inner
+ * node above the leaf. The leaf is taken out of that node (or out of the
+ * terminal slot of the node where the key ends), which then shrinks or
+ * merges into its only child (see compact()); the leaf is freed last, as
+ * key may be its own.
+ */
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::size_type RT_CLASS::erase_key(const key_type& lookup) {
+  auto key = encode(lookup);
+  RadixNode** ref = &root_;
+  RadixNode** parent = nullptr;
+  std::size_t parent_depth = 0;
+  unsigned char parent_byte = 0;
+  std::size_t depth = 0;
+  Leaf* erased = nullptr;
+
+  while (*ref && !erased) {
+    RadixNode* node = *ref;
+    if (node->is_leaf()) {
+      if (!leaf_matches(node, key)) return 0;
+      erased = as_leaf(node);
+      if (parent) {
+        remove_child(*parent, parent_byte, parent_depth);
+      } else {
+        root_ = nullptr;
+      }
+      break;
+    }
+    auto* inner = static_cast<RadixInner*>(node);
+    std::size_t start = depth;
+    if (prefix_mismatch(inner, key, depth) < inner->prefix_len) return 0;
+    depth += inner->prefix_len;
+    if (depth == key.size()) {
+      if (!inner->terminal || !leaf_matches(inner->terminal, key)) return 0;
+      erased = as_leaf(inner->terminal);
+      inner->terminal = nullptr;
+      compact(*ref, start);
+      break;
+    }
+    RadixNode** child = radix_find_child(inner, radix_byte(key, depth));
+    if (!child) return 0;
+    parent = ref;
+    parent_depth = start;
+    parent_byte = radix_byte(key, depth);
+    ref = child;
+    ++depth;
+  }
+  if (!erased) return 0;
+  erased->unlink();
+  destroy(erased);
+  --size_;
+  return 1;
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::iterator RT_CLASS::find(const key_type& key) {
+  return iterator(find_links(encode(key)));
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::const_iterator RT_CLASS::find(const key_type& key) const {
+  return const_iterator(find_links(encode(key)));
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::iterator RT_CLASS::lower_bound(const key_type& key) {
+  return iterator(lower_bound_links(encode(key)));
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::const_iterator RT_CLASS::lower_bound(
+    const key_type& key) const {
+  return const_iterator(lower_bound_links(encode(key)));
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::iterator RT_CLASS::upper_bound(const key_type& key) {
+  auto bytes = encode(key);
+  RadixLeafLinks* links = lower_bound_links(bytes);
+  if (links != &header_ && leaf_matches(static_cast<Leaf*>(links), bytes)) {
+    links = links->next;
+  }
+  return iterator(links);
+}
+
+RT_TEMPLATE_PARAMS
+typename RT_CLASS::const_iterator RT_CLASS::upper_bound(
+    const key_type& key) const {
+  return const_cast<RT_CLASS*>(this)->upper_bound(key);
+}
+
+RT_TEMPLATE_PARAMS
+std::pair<typename RT_CLASS::iterator, typename RT_CLASS::iterator>
+RT_CLASS::prefix_range(std::string_view prefix)
+  requires(!kFixedLength)
+{
+  auto [first, last] = prefix_links(prefix);
+  return {iterator(first), iterator(last)};
+}
+
+RT_TEMPLATE_PARAMS
+std::pair<typename RT_CLASS::const_iterator, typename RT_CLASS::const_iterator>
+RT_CLASS::prefix_range(std::string_view prefix) const
+  requires(!kFixedLength)
+{
+  auto [first, last] = prefix_links(prefix);
+  return {const_iterator(first), const_iterator(last)};
+}
+
+/*
+ * Optimistic: of a compressed prefix only the inline bytes are compared.
+ * The full key comparison at the leaf catches a difference in the rest.
+ */
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+RadixLeafLinks* RT_CLASS::find_links(const Bytes& key) const {
+  RadixLeafLinks* not_found = const_cast<RadixLeafLinks*>(&header_);
+  RadixNode* node = root_;
+  std::size_t depth = 0;
+  while (node) {
+    if (node->is_leaf()) {
+      return leaf_matches(node, key) ? as_leaf(node) : not_found;
+    }
+    auto* inner = static_cast<RadixInner*>(node);
+    if (key.size() - depth < inner->prefix_len) return not_found;
+    std::size_t checked =
+        std::min<std::size_t>(inner->prefix_len, RadixInner::kMaxPrefix);
+    for (std::size_t i = 0; i < checked; ++i) {
+      if (inner->prefix[i] != radix_byte(key, depth + i)) return not_found;
+    }
+    depth += inner->prefix_len;
+    if (depth == key.size()) {
+      node = inner->terminal;
+    } else {
+      RadixNode** child = radix_find_child(inner, radix_byte(key, depth));
+      node = child ? *child : nullptr;
+      ++depth;
+    }
+  }
+  return not_found;
+}
+
+// The smallest leaf at or after key in node's subtree, nullptr if none.
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+const typename RT_CLASS::Leaf* RT_CLASS::lower_bound_in(
+    const RadixNode* node, const Bytes& key, std::size_t depth) const {
+  if (node->is_leaf()) {
+    return leaf_bytes(node) < key ? nullptr : as_leaf(node);
+  }
+  auto* inner = static_cast<const RadixInner*>(node);
+  std::size_t m = prefix_mismatch(inner, key, depth);
+  if (m < inner->prefix_len) {
+    // the key ends inside the prefix, or differs from it at byte m
+    if (depth + m == key.size()) return minimum(inner);
+    unsigned char ours =
+        m < RadixInner::kMaxPrefix
+            ? inner->prefix[m]
+            : radix_byte(leaf_bytes(minimum(inner)), depth + m);
+    return ours > radix_byte(key, depth + m) ? minimum(inner) : nullptr;
+  }
+  depth += inner->prefix_len;
+  if (depth == key.size()) return minimum(inner);
+  unsigned char byte = radix_byte(key, depth);
+  if (RadixNode** child =
+          radix_find_child(const_cast<RadixInner*>(inner), byte)) {
+    if (const Leaf* found = lower_bound_in(*child, key, depth + 1)) {
+      return found;
+    }
+  }
+  RadixNode* after = radix_next_child(inner, byte, true);
+  return after ? minimum(after) : nullptr;
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+RadixLeafLinks* RT_CLASS::lower_bound_links(const Bytes& key) const {
+  const Leaf* found = root_ ? lower_bound_in(root_, key, 0) : nullptr;
+  return found ? links(found) : const_cast<RadixLeafLinks*>(&header_);
+}
+
+RT_TEMPLATE_PARAMS
+std::pair<RadixLeafLinks*, RadixLeafLinks*> RT_CLASS::prefix_links(
+    std::string_view prefix) const {
+  RadixLeafLinks* none = const_cast<RadixLeafLinks*>(&header_);
+  const RadixNode* node = root_;
+  std::size_t depth = 0;
+  while (node) {
+    if (node->is_leaf()) {
+      if (!leaf_bytes(node).starts_with(prefix)) break;
+      return {links(as_leaf(node)), links(as_leaf(node))->next};
+    }
+    auto* inner = static_cast<const RadixInner*>(node);
+    std::size_t m = prefix_mismatch(inner, prefix, depth);
+    if (depth + m == prefix.size()) {
+      return {links(minimum(inner)), links(maximum(inner))->next};
+    }
+    if (m < inner->prefix_len) break;
+    depth += inner->prefix_len;
+    RadixNode** child = radix_find_child(const_cast<RadixInner*>(inner),
+                                         radix_byte(prefix, depth));
+    if (!child) break;
+    node = *child;
+    ++depth;
+  }
+  return {none, none};
+}
+
+RT_TEMPLATE_PARAMS
+const typename RT_CLASS::Leaf* RT_CLASS::minimum(
+    const RadixNode* node) noexcept {
+  while (!node->is_leaf()) {
+    auto* inner = static_cast<const RadixInner*>(node);
+    node = inner->terminal ? inner->terminal
+                           : radix_next_child(inner, 0, false);
+  }
+  return as_leaf(node);
+}
+
+RT_TEMPLATE_PARAMS
+const typename RT_CLASS::Leaf* RT_CLASS::maximum(
+    const RadixNode* node) noexcept {
+  while (!node->is_leaf()) {
+    auto* inner = static_cast<const RadixInner*>(node);
+    node = inner->count ? radix_last_child(inner) : inner->terminal;
+  }
+  return as_leaf(node);
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+bool RT_CLASS::leaf_matches(const RadixNode* leaf, const Bytes& key) const {
+  auto bytes = leaf_bytes(leaf);
+  return std::equal(bytes.begin(), bytes.end(), key.begin(), key.end());
+}
+
+/*
+ * How many bytes of node's prefix match key from depth on, at most the
+ * prefix length (a full match) and at most what is left of key. Bytes past
+ * the inline ones are read from the node's smallest leaf.
+ */
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+std::size_t RT_CLASS::prefix_mismatch(const RadixInner* node,
+                                      const Bytes& key,
+                                      std::size_t depth) const {
+  std::size_t limit =
+      std::min<std::size_t>(node->prefix_len, key.size() - depth);
+  std::size_t inline_limit = std::min(limit, RadixInner::kMaxPrefix);
+  std::size_t i = 0;
+  for (; i < inline_limit; ++i) {
+    if (node->prefix[i] != radix_byte(key, depth + i)) return i;
+  }
+  if (i < limit) {
+    auto bytes = leaf_bytes(minimum(node));
+    for (; i < limit; ++i) {
+      if (radix_byte(bytes, depth + i) != radix_byte(key, depth + i)) return i;
+    }
+  }
+  return limit;
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+void RT_CLASS::set_prefix(RadixInner* node, const Bytes& bytes,
+                          std::size_t from, std::size_t length) noexcept {
+  node->prefix_len = static_cast<std::uint32_t>(length);
+  std::size_t kept = std::min(length, RadixInner::kMaxPrefix);
+  for (std::size_t i = 0; i < kept; ++i) {
+    node->prefix[i] = radix_byte(bytes, from + i);
+  }
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Bytes>
+void RT_CLASS::hang(RadixNode4* node, RadixNode* leaf, const Bytes& bytes,
+                    std::size_t at) noexcept {
+  if (at == bytes.size()) {
+    node->terminal = leaf;
+  } else {
+    radix_insert_sorted(node, radix_byte(bytes, at), leaf);
+  }
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::add_child(RadixNode*& ref, unsigned char byte,
+                         RadixNode* child) {
+  auto* node = static_cast<RadixInner*>(ref);
+  switch (node->kind) {
+    case RadixKind::kNode4:
+      if (node->count == RadixNode4::kCapacity) {
+        resize<RadixNode16>(ref);
+        break;
+      }
+      radix_insert_sorted(static_cast<RadixNode4*>(node), byte, child);
+      return;
+    case RadixKind::kNode16:
+      if (node->count == RadixNode16::kCapacity) {
+        resize<RadixNode48>(ref);
+        break;
+      }
+      radix_insert_sorted(static_cast<RadixNode16*>(node), byte, child);
+      return;
+    case RadixKind::kNode48:
+      if (node->count == RadixNode48::kCapacity) {
+        resize<RadixNode256>(ref);
+        break;
+      }
+      {
+        // erased children leave holes; take the first free slot
+        auto* n = static_cast<RadixNode48*>(node);
+        std::size_t slot = 0;
+        while (n->children[slot]) ++slot;
+        n->children[slot] = child;
+        n->index[byte] = static_cast<unsigned char>(slot + 1);
+        ++n->count;
+      }
+      return;
+    default:
+      static_cast<RadixNode256*>(node)->children[byte] = child;
+      ++node->count;
+      return;
+  }
+  add_child(ref, byte, child);
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::remove_child(RadixNode*& ref, unsigned char byte,
+                            std::size_t depth) noexcept {
+  auto* node = static_cast<RadixInner*>(ref);
+  switch (node->kind) {
+    case RadixKind::kNode4: {
+      auto* n = static_cast<RadixNode4*>(node);
+      radix_erase_sorted(n, radix_find_key(n->keys, n->count, byte));
+      break;
+    }
+    case RadixKind::kNode16: {
+      auto* n = static_cast<RadixNode16*>(node);
+      radix_erase_sorted(n, radix_find_key16(n->keys, n->count, byte));
+      break;
+    }
+    case RadixKind::kNode48: {
+      auto* n = static_cast<RadixNode48*>(node);
+      n->children[n->index[byte] - 1] = nullptr;
+      n->index[byte] = 0;
+      --n->count;
+      break;
+    }
+    default:
+      static_cast<RadixNode256*>(node)->children[byte] = nullptr;
+      --node->count;
+  }
+  compact(ref, depth);
+}
+
+/*
+ * After a removal: a node left with only its terminal is replaced by that
+ * leaf, and one left with a single child merges into it, the child taking
+ * over prefix + byte + its own prefix. This holds for every kind, since a
+ * node that failed to shrink earlier may still be a large one. Otherwise a
+ * node that has become much emptier than its size moves to the next
+ * smaller one (well below the size it grows at, so alternating inserts and
+ * erases do not resize every time). depth is where the node's prefix
+ * starts. A failed allocation only keeps the larger node.
+ */
+RT_TEMPLATE_PARAMS
+void RT_CLASS::compact(RadixNode*& ref, std::size_t depth) noexcept {
+  auto* node = static_cast<RadixInner*>(ref);
+  if (node->count == 0) {
+    ref = node->terminal;
+    destroy_inner(node);
+    return;
+  }
+  if (node->count == 1 && !node->terminal) {
+    RadixNode* child = radix_next_child(node, 0, false);
+    if (!child->is_leaf()) {
+      auto* inner = static_cast<RadixInner*>(child);
+      set_prefix(inner, leaf_bytes(minimum(inner)), depth,
+                 node->prefix_len + 1 + inner->prefix_len);
+    }
+    ref = child;
+    destroy_inner(node);
+    return;
+  }
+  try {
+    switch (node->kind) {
+      case RadixKind::kNode256:
+        if (node->count <= 37) resize<RadixNode48>(ref);
+        break;
+      case RadixKind::kNode48:
+        if (node->count <= 12) resize<RadixNode16>(ref);
+        break;
+      case RadixKind::kNode16:
+        if (node->count <= 3) resize<RadixNode4>(ref);
+        break;
+      default:
+        break;
+    }
+  } catch (...) {
+  }
+}
+
+RT_TEMPLATE_PARAMS
+template <typename To>
+void RT_CLASS::resize(RadixNode*& ref) {
+  auto* from = static_cast<RadixInner*>(ref);
+  To* to = create<To>();
+  to->prefix_len = from->prefix_len;
+  std::memcpy(to->prefix, from->prefix, RadixInner::kMaxPrefix);
+  to->terminal = from->terminal;
+  radix_for_each_child(from, [to](unsigned char byte, RadixNode* child) {
+    radix_append(to, byte, child);
+  });
+  destroy_inner(from);
+  ref = to;
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Node, typename... Args>
+Node* RT_CLASS::create(Args&&... args) {
+  using node_allocator =
+      typename std::allocator_traits<A>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  node_allocator alloc(allocator_);
+  Node* node = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+RT_TEMPLATE_PARAMS
+template <typename Node>
+void RT_CLASS::destroy(Node* node) noexcept {
+  using node_allocator =
+      typename std::allocator_traits<A>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  node_allocator alloc(allocator_);
+  node_traits::destroy(alloc, node);
+  node_traits::deallocate(alloc, node, 1);
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::destroy_inner(RadixInner* node) noexcept {
+  switch (node->kind) {
+    case RadixKind::kNode4:
+      destroy(static_cast<RadixNode4*>(node));
+      break;
+    case RadixKind::kNode16:
+      destroy(static_cast<RadixNode16*>(node));
+      break;
+    case RadixKind::kNode48:
+      destroy(static_cast<RadixNode48*>(node));
+      break;
+    default:
+      destroy(static_cast<RadixNode256*>(node));
+  }
+}
+
+RT_TEMPLATE_PARAMS
+void RT_CLASS::destroy_subtree(RadixNode* node) noexcept {
+  if (node->is_leaf()) {
+    destroy(as_leaf(node));
+    return;
+  }
+  auto* inner = static_cast<RadixInner*>(node);
+  if (inner->terminal) destroy_subtree(inner->terminal);
+  radix_for_each_child(inner, [this](unsigned char, RadixNode* child) {
+    destroy_subtree(child);
+  });
+  destroy_inner(inner);
+}
+
+// Copies in key order, so every copied leaf is appended to our list. On an
+// exception the part copied so far is freed.
+RT_TEMPLATE_PARAMS
+RadixNode* RT_CLASS::copy_subtree(const RadixNode* source) {
+  if (source->is_leaf()) {
+    Leaf* leaf = create<Leaf>(as_leaf(source)->value);
+    leaf->link_before(&header_);
+    return leaf;
+  }
+  auto* from = static_cast<const RadixInner*>(source);
+  RadixInner* copy;
+  switch (from->kind) {
+    case RadixKind::kNode4:
+      copy = create<RadixNode4>();
+      break;
+    case RadixKind::kNode16:
+      copy = create<RadixNode16>();
+      break;
+    case RadixKind::kNode48:
+      copy = create<RadixNode48>();
+      break;
+    default:
+      copy = create<RadixNode256>();
+  }
+  copy->prefix_len = from->prefix_len;
+  std::memcpy(copy->prefix, from->prefix, RadixInner::kMaxPrefix);
+  try {
+    if (from->terminal) copy->terminal = copy_subtree(from->terminal);
+    radix_for_each_child(
+        from, [this, copy](unsigned char byte, const RadixNode* child) {
+          radix_append(copy, byte, copy_subtree(child));
+        });
+  } catch (...) {
+    destroy_subtree(copy);
+    throw;
+  }
+  return copy;
+}
+
+#undef RT_TEMPLATE_PARAMS
+#undef RT_CLASS
+
+}  // namespace s21
+
+#endif  // S21_RADIX_TREE_TPP_
@@ -0,0 +1,249 @@
+#ifndef S21_BTREE_MAP_H_
+#define S21_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/*
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end: The sources accepted by the
+ *    range constructors and insert().
+ *
+ * From <memory>:
+ *  std::allocator: The default allocator; it is rebound to the tree's leaf
+ *    and internal node types.
+ *
+ * From <stdexcept>:
+ *  std::out_of_range: Thrown by 'at' when the key is not present.
+ *
+ * From <tuple>, <utility>:
+ *  std::piecewise_construct, std::forward_as_tuple: Build the key and the
+ *    mapped value of a new element in place (try_emplace, operator[]).
+ *  std::pair: The value_type and the result of the insertion methods.
+ */
+
+#include "btree/s21_btree.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+/*
+ * An ordered map with the interface of s21::map, stored in a B-tree (see
+ * BTree): many elements per node, so lookups and in-order walks touch far
+ * fewer cache lines than the one-element nodes of the red-black tree.
+ *
+ * Unlike s21::map, elements move between nodes when the tree changes:
+ * insert and erase invalidate all iterators and references, and there are
+ * no node handles.
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map {
+ private:
+  using tree_type = BTree<Key, std::pair<const Key, T>, MapTraits<Key, T>,
+                          Compare, Allocator>;
+  tree_type tree_;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = typename tree_type::size_type;
+
+  btree_map() : tree_() {}
+  explicit btree_map(const Compare& comp,
+                     const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  btree_map(std::initializer_list<value_type> const& items) : tree_() {
+    insert(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  btree_map(InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    insert(first, last);
+  }
+  template <container_compatible_range<value_type> R>
+  btree_map(from_range_t, R&& rg, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    insert(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+  btree_map(const btree_map& m) : tree_(m.tree_) {}
+  btree_map(btree_map&& m) noexcept : tree_(std::move(m.tree_)) {}
+  ~btree_map() = default;
+
+  btree_map& operator=(const btree_map& m) {
+    if (this != &m) {
+      tree_ = m.tree_;
+    }
+    return *this;
+  }
+
+  btree_map& operator=(btree_map&& m) noexcept {
+    if (this != &m) {
+      tree_ = std::move(m.tree_);
+    }
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    iterator it = tree_.find(key);
+    if (it == tree_.end()) {
+      throw std::out_of_range("btree_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator it = tree_.find(key);
+    if (it == tree_.end()) {
+      throw std::out_of_range("btree_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.cbegin(); }
+  const_iterator cend() const noexcept { return tree_.cend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() noexcept { tree_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.try_emplace(value.first, value);
+  }
+  // The hint is accepted for compatibility with s21::map; a B-tree descent
+  // is short enough that it is not used.
+  iterator insert(const_iterator, const value_type& value) {
+    return insert(value).first;
+  }
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return tree_.try_emplace(key, key, obj);
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) emplace(*first);
+  }
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    auto result = tree_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  // The key and the mapped value are only built when key is not present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  iterator erase(iterator pos) { return tree_.erase(pos); }
+  iterator erase(const_iterator pos) { return tree_.erase(pos); }
+  size_type erase(const Key& key) { return tree_.erase_key(key); }
+  void swap(btree_map& other) noexcept { tree_.swap(other.tree_); }
+  void merge(btree_map& other) { tree_.merge(other.tree_); }
+
+  iterator find(const Key& key) { return tree_.find(key); }
+  const_iterator find(const Key& key) const { return tree_.find(key); }
+  bool contains(const Key& key) const { return find(key) != end(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.upper_bound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator, Args&&... args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_BTREE_MAP_H_
@@ -0,0 +1,164 @@
+#ifndef S21_BTREE_SET_H_
+#define S21_BTREE_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+/*
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the set from a brace-enclosed list of keys.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end: The sources accepted by the
+ *    range constructors and insert().
+ *
+ * From <memory>:
+ *  std::allocator: The default allocator; it is rebound to the tree's leaf
+ *    and internal node types.
+ *
+ * From <utility>:
+ *  std::pair: The result of the insertion methods and equal_range().
+ */
+
+#include "btree/s21_btree.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+/*
+ * An ordered set with the interface of s21::set, stored in a B-tree (see
+ * BTree and btree_map). Keys are never modified through an iterator, so
+ * iterator and const_iterator are both read-only.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class btree_set {
+ private:
+  using tree_type = BTree<Key, Key, SetTraits<Key>, Compare, Allocator>;
+  tree_type tree_;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = typename tree_type::size_type;
+
+  btree_set() : tree_() {}
+  explicit btree_set(const Compare& comp,
+                     const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  btree_set(std::initializer_list<value_type> const& items) : tree_() {
+    insert(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  btree_set(InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    insert(first, last);
+  }
+  template <container_compatible_range<value_type> R>
+  btree_set(from_range_t, R&& rg, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    insert(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+  btree_set(const btree_set& s) : tree_(s.tree_) {}
+  btree_set(btree_set&& s) noexcept : tree_(std::move(s.tree_)) {}
+  ~btree_set() = default;
+
+  btree_set& operator=(const btree_set& s) {
+    if (this != &s) {
+      tree_ = s.tree_;
+    }
+    return *this;
+  }
+
+  btree_set& operator=(btree_set&& s) noexcept {
+    if (this != &s) {
+      tree_ = std::move(s.tree_);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.cbegin(); }
+  const_iterator cend() const noexcept { return tree_.cend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() noexcept { tree_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.try_emplace(value, value);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return tree_.try_emplace(value, std::move(value));
+  }
+  // The hint is accepted for compatibility with s21::set and not used.
+  iterator insert(const_iterator, const value_type& value) {
+    return insert(value).first;
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) emplace(*first);
+  }
+
+  iterator erase(const_iterator pos) { return tree_.erase(pos); }
+  size_type erase(const Key& key) { return tree_.erase_key(key); }
+  void swap(btree_set& other) noexcept { tree_.swap(other.tree_); }
+  void merge(btree_set& other) { tree_.merge(other.tree_); }
+
+  iterator find(const Key& key) const { return tree_.find(key); }
+  bool contains(const Key& key) const { return find(key) != end(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) const { return tree_.lower_bound(key); }
+  iterator upper_bound(const Key& key) const { return tree_.upper_bound(key); }
+  std::pair<iterator, iterator> equal_range(const Key& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator, Args&&... args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_BTREE_SET_H_
@@ -0,0 +1,287 @@
+#ifndef S21_CONCURRENT_MAP_H_
+#define S21_CONCURRENT_MAP_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <utility>
+
+/*
+ * From <algorithm>:
+ *  std::push_heap, std::pop_heap: The k-way merge of the shards in
+ *    for_each_ordered() keeps one cursor per shard in a min-heap.
+ *
+ * From <functional>:
+ *  std::hash, std::less: The default shard hash and key order.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <memory>:
+ *  std::allocator: The default 'Allocator'.
+ *
+ * From <mutex>, <shared_mutex>:
+ *  std::shared_mutex, std::shared_lock, std::unique_lock: One reader-writer
+ *    lock per shard; lookups share it, updates own it.
+ *
+ * From <optional>:
+ *  std::optional: find() returns a copy of the mapped value, or nothing.
+ *
+ * From <tuple>, <utility>:
+ *  std::piecewise_construct, std::forward_as_tuple: Build new elements in
+ *    place (try_emplace).
+ *  std::pair: The value_type.
+ */
+
+#include "hash/s21_hash_group.h"
+#include "s21_map.h"
+#include "tree/s21_red_black_tree.h"
+
+namespace s21 {
+
+/*
+ * A map that any number of threads may use at once without external
+ * locking. Keys are spread by hash over 'Shards' independent RedBlackTrees,
+ * each behind its own reader-writer lock, so threads working on different
+ * shards never wait for each other and readers of one shard run in
+ * parallel.
+ *
+ * Nothing hands out references or iterators into the trees: find() copies
+ * the mapped value out, and visit()/update()/for_each() run a callback
+ * while the shard is locked. Callbacks must not call back into the same
+ * map. for_each() locks one shard at a time; for_each_ordered() and
+ * snapshot() lock all shards for reading (in shard order, so they cannot
+ * deadlock with each other) and see one consistent state of the map.
+ *
+ * Every shard owns a default-constructed Allocator. With
+ * node_pool_allocator that means one pool per shard, guarded by the shard's
+ * lock.
+ *
+ *Key type,
+ *T mapped type,
+ *Shards number of trees, a power of two
+ *Hash functor that picks the shard, Compare functor that orders a shard
+ *Allocator class for memory handling
+ */
+template <typename Key, typename T, std::size_t Shards = 16,
+          typename Hash = std::hash<Key>, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_map {
+  static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0,
+                "concurrent_map: Shards must be a power of two");
+
+ private:
+  using tree_type = RedBlackTree<Key, std::pair<const Key, T>,
+                                 MapTraits<Key, T>, Compare, Allocator>;
+
+  // One cache line per lock, so taking one shard's lock does not bounce
+  // the line holding its neighbour's.
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    tree_type tree;
+  };
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_compare = Compare;
+  using snapshot_type = map<Key, T, Compare, Allocator>;
+
+  static constexpr size_type shard_count = Shards;
+
+  concurrent_map() = default;
+  explicit concurrent_map(const Hash& hash) : hasher_(hash) {}
+  concurrent_map(std::initializer_list<value_type> const& items) {
+    for (const value_type& item : items) insert(item);
+  }
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  // Must not run concurrently with any other member function.
+  ~concurrent_map() = default;
+
+  // Returns false and leaves the map unchanged when the key is present.
+  bool insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+  bool insert(const Key& key, const T& obj) { return try_emplace(key, obj); }
+  // The element is only built when key is not present.
+  template <typename... Args>
+  bool try_emplace(const Key& key, Args&&... args) {
+    Shard& shard = shard_for(key);
+    std::unique_lock lock(shard.mutex);
+    return shard.tree
+        .try_emplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...))
+        .second;
+  }
+  // Returns true when the key was inserted, false when it was assigned.
+  template <typename M>
+  bool insert_or_assign(const Key& key, M&& obj) {
+    Shard& shard = shard_for(key);
+    std::unique_lock lock(shard.mutex);
+    auto result = shard.tree.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result.second;
+  }
+
+  size_type erase(const Key& key) {
+    Shard& shard = shard_for(key);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.end()) return 0;
+    shard.tree.erase(it);
+    return 1;
+  }
+
+  std::optional<T> find(const Key& key) const {
+    const Shard& shard = shard_for(key);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.end()) return std::nullopt;
+    return it->second;
+  }
+  bool contains(const Key& key) const {
+    const Shard& shard = shard_for(key);
+    std::shared_lock lock(shard.mutex);
+    return shard.tree.contains(key);
+  }
+
+  // Calls fn(const value_type&) under the shard's read lock; false when the
+  // key is not present.
+  template <typename F>
+  bool visit(const Key& key, F&& fn) const {
+    const Shard& shard = shard_for(key);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.end()) return false;
+    fn(*it);
+    return true;
+  }
+  // Calls fn(value_type&) under the shard's write lock, so fn may change
+  // the mapped value; false when the key is not present.
+  template <typename F>
+  bool update(const Key& key, F&& fn) {
+    Shard& shard = shard_for(key);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.end()) return false;
+    fn(*it);
+    return true;
+  }
+
+  // Every element, shard by shard (each in key order, the shards one after
+  // another). Changes to shards not yet visited are seen.
+  template <typename F>
+  void for_each(F&& fn) const {
+    for (const Shard& shard : shards_) {
+      std::shared_lock lock(shard.mutex);
+      for (const value_type& value : shard.tree) fn(value);
+    }
+  }
+  // Every element in key order, merged from all shards while they are all
+  // read-locked.
+  template <typename F>
+  void for_each_ordered(F&& fn) const;
+  // An s21::map with the elements of one consistent state of the map.
+  snapshot_type snapshot() const {
+    snapshot_type result;
+    for_each_ordered([&result](const value_type& value) {
+      result.emplace_hint(result.end(), value);
+    });
+    return result;
+  }
+
+  // Exact only while no other thread modifies the map.
+  size_type size() const {
+    size_type total = 0;
+    for (const Shard& shard : shards_) {
+      std::shared_lock lock(shard.mutex);
+      total += shard.tree.size();
+    }
+    return total;
+  }
+  bool empty() const { return size() == 0; }
+  void clear() {
+    for (Shard& shard : shards_) {
+      std::unique_lock lock(shard.mutex);
+      shard.tree.clear();
+    }
+  }
+
+  hasher hash_function() const { return hasher_; }
+
+ private:
+  std::array<Shard, Shards> shards_;
+  [[no_unique_address]] Hash hasher_;
+  [[no_unique_address]] Compare key_compare_;
+
+  // The mixed hash, so that identity hashes of integers still spread
+  // consecutive keys over all shards.
+  size_type shard_index(const Key& key) const {
+    return hash_mix(static_cast<size_type>(hasher_(key))) & (Shards - 1);
+  }
+  Shard& shard_for(const Key& key) { return shards_[shard_index(key)]; }
+  const Shard& shard_for(const Key& key) const {
+    return shards_[shard_index(key)];
+  }
+};
+
+/*
+ * K-way merge: a min-heap holds the next element of every shard that has
+ * one, so each element costs O(log Shards) on top of the tree walks. The
+ * shards are read-locked in index order and released together at the end.
+ */
+template <typename Key, typename T, std::size_t Shards, typename Hash,
+          typename Compare, typename Allocator>
+template <typename F>
+void concurrent_map<Key, T, Shards, Hash, Compare, Allocator>::
+    for_each_ordered(F&& fn) const {
+  using cursor_iterator = typename tree_type::const_iterator;
+  struct Cursor {
+    cursor_iterator it;
+    cursor_iterator end;
+  };
+
+  std::array<std::shared_lock<std::shared_mutex>, Shards> locks;
+  for (size_type i = 0; i < Shards; ++i) {
+    locks[i] = std::shared_lock(shards_[i].mutex);
+  }
+  std::array<Cursor, Shards> heap;
+  size_type heap_size = 0;
+  // std heaps put the largest first: 'after' orders the smallest key on top
+  auto after = [this](const Cursor& a, const Cursor& b) {
+    return key_compare_(b.it->first, a.it->first);
+  };
+  for (const Shard& shard : shards_) {
+    if (shard.tree.empty()) continue;
+    heap[heap_size++] = Cursor{shard.tree.begin(), shard.tree.end()};
+    std::push_heap(heap.begin(), heap.begin() + heap_size, after);
+  }
+  while (heap_size > 0) {
+    std::pop_heap(heap.begin(), heap.begin() + heap_size, after);
+    Cursor& smallest = heap[heap_size - 1];
+    fn(*smallest.it);
+    if (++smallest.it == smallest.end) {
+      --heap_size;
+    } else {
+      std::push_heap(heap.begin(), heap.begin() + heap_size, after);
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_MAP_H_
@@ -0,0 +1,76 @@
+#ifndef S21_CONTAINER_TAGS_H_
+#define S21_CONTAINER_TAGS_H_
+
+#include <concepts>
+#include <ranges>
+#include <version>
+#if defined(__cpp_lib_flat_map)
+#include <flat_map>
+#endif
+
+/*
+ * From <concepts>:
+ *  std::convertible_to: Checks that the elements of a source range can be
+ *    stored in the target container.
+ *
+ * From <ranges>:
+ *  std::ranges::input_range, std::ranges::range_reference_t: Describe the
+ *    ranges accepted by the from_range constructors.
+ *
+ * From <version>, <flat_map>:
+ *  std::sorted_unique_t: The standard tag, when the library provides it.
+ */
+
+namespace s21 {
+
+/*
+ * Disambiguation tag for the constructors that take a whole range,
+ * e.g. s21::vector<int> v(s21::from_range, some_range). It is the standard
+ * tag when the library provides one (C++23), otherwise an equivalent.
+ */
+#if defined(__cpp_lib_containers_ranges)
+using std::from_range;
+using std::from_range_t;
+#else
+struct from_range_t {
+  explicit from_range_t() = default;
+};
+inline constexpr from_range_t from_range{};
+#endif
+
+/*
+ * Tag for constructors whose input is already sorted by the container's
+ * comparator and free of duplicates, e.g.
+ * s21::set<int> s(s21::sorted_unique, v.begin(), v.end()). The container
+ * then builds itself in linear time instead of inserting element by element.
+ */
+#if defined(__cpp_lib_flat_map)
+using std::sorted_unique;
+using std::sorted_unique_t;
+#else
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
+template <typename R, typename T>
+concept container_compatible_range =
+    std::ranges::input_range<R> &&
+    std::convertible_to<std::ranges::range_reference_t<R>, T>;
+
+// Comparators such as std::less<> that accept any key-like type.
+template <typename C>
+concept transparent_comparator = requires { typename C::is_transparent; };
+
+// Hash and equality pairs that both accept any key-like type, as for the
+// heterogeneous lookup of std::unordered_map.
+template <typename Hash, typename KeyEqual>
+concept transparent_hash = requires {
+  typename Hash::is_transparent;
+  typename KeyEqual::is_transparent;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINER_TAGS_H_
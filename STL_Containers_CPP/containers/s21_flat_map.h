@@ -0,0 +1,468 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+/*
+ * From <algorithm>:
+ *  std::min: max_size() is bounded by the smaller of the two arrays.
+ *
+ * From <functional>:
+ *  std::less: The default comparator.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end: The sources accepted by the
+ *    range constructors, insert() and insert_range().
+ *
+ * From <stdexcept>:
+ *  std::out_of_range: Thrown by 'at' when the key is not present.
+ *
+ * From <utility>:
+ *  std::pair: The value_type and the result of the insertion methods.
+ */
+
+#include "flat/s21_flat_map_iterator.h"
+#include "flat/s21_sorted_array.h"
+#include "s21_container_tags.h"
+#include "vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * An ordered map with the interface of s21::map, stored as two sorted
+ * s21::vectors: the keys, and the mapped values at the same positions.
+ * Lookups are a branchless binary search over the key array alone, and
+ * iteration is a linear walk, which makes it the fastest ordered map for
+ * data that is built once and then mostly read.
+ *
+ * Inserting or erasing a single element shifts everything behind it, so it
+ * is O(n); bulk input should go through the range constructors or
+ * insert_range(), which sort the new elements once and merge them in a
+ * single pass. Any insert or erase invalidates all iterators and
+ * references. Key and T must be default constructible (s21::vector
+ * allocates its storage as an array of T).
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using key_compare = Compare;
+  using iterator = FlatMapIterator<Key, T, false>;
+  using const_iterator = FlatMapIterator<Key, T, true>;
+  using reference = typename iterator::reference;
+  using const_reference = typename const_iterator::reference;
+  using size_type = std::size_t;
+  using key_container_type = vector<Key>;
+  using mapped_container_type = vector<T>;
+
+  flat_map() = default;
+  explicit flat_map(const Compare& comp) : comp_(comp) {}
+  flat_map(std::initializer_list<value_type> const& items) {
+    append_unsorted(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  flat_map(InputIt first, InputIt last, const Compare& comp = Compare())
+      : comp_(comp) {
+    append_unsorted(first, last);
+  }
+  template <container_compatible_range<value_type> R>
+  flat_map(from_range_t, R&& rg, const Compare& comp = Compare())
+      : comp_(comp) {
+    append_unsorted(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+  // Input already sorted and free of duplicates: copied as is, after one
+  // linear check (std::invalid_argument if it does not hold).
+  template <std::input_iterator InputIt>
+  flat_map(sorted_unique_t, InputIt first, InputIt last,
+           const Compare& comp = Compare())
+      : comp_(comp) {
+    for (; first != last; ++first) {
+      keys_.push_back((*first).first);
+      values_.push_back((*first).second);
+    }
+    check_sorted_unique(keys_, comp_);
+  }
+  // Adopts two arrays of the same length as they are.
+  flat_map(sorted_unique_t, key_container_type keys,
+           mapped_container_type values, const Compare& comp = Compare())
+      : keys_(std::move(keys)), values_(std::move(values)), comp_(comp) {
+    if (keys_.size() != values_.size()) {
+      throw std::invalid_argument("flat_map: key and value counts differ");
+    }
+    check_sorted_unique(keys_, comp_);
+  }
+  flat_map(const flat_map& m) = default;
+  flat_map(flat_map&& m) noexcept
+      : keys_(std::move(m.keys_)),
+        values_(std::move(m.values_)),
+        comp_(m.comp_) {}
+  ~flat_map() = default;
+
+  flat_map& operator=(const flat_map& m) {
+    if (this != &m) {
+      keys_ = m.keys_;
+      values_ = m.values_;
+      comp_ = m.comp_;
+    }
+    return *this;
+  }
+
+  flat_map& operator=(flat_map&& m) noexcept {
+    if (this != &m) {
+      keys_ = std::move(m.keys_);
+      values_ = std::move(m.values_);
+      comp_ = m.comp_;
+    }
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    size_type index = find_index(key);
+    if (index == size()) {
+      throw std::out_of_range("flat_map::at: key not found");
+    }
+    return values_.data()[index];
+  }
+
+  const T& at(const Key& key) const {
+    size_type index = find_index(key);
+    if (index == size()) {
+      throw std::out_of_range("flat_map::at: key not found");
+    }
+    return values_.data()[index];
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  iterator begin() noexcept { return make_iterator(0); }
+  const_iterator begin() const noexcept { return make_iterator(0); }
+  iterator end() noexcept { return make_iterator(size()); }
+  const_iterator end() const noexcept { return make_iterator(size()); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept {
+    return std::min(keys_.max_size(), values_.max_size());
+  }
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+
+  // The underlying arrays, for algorithms that only need one of them.
+  const key_container_type& keys() const noexcept { return keys_; }
+  const mapped_container_type& values() const noexcept { return values_; }
+  key_compare key_comp() const { return comp_; }
+
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+  // A hint that is right (the element goes just before it) saves the
+  // search; any other hint is ignored.
+  iterator insert(const_iterator hint, const value_type& value) {
+    size_type index = hint_index(hint, value.first);
+    if (index == kNoHint) return insert(value).first;
+    return insert_at(index, value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return try_emplace(key, obj);
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    flat_map batch(first, last, comp_);
+    merge_sorted(batch);
+  }
+  // Sorts the new elements once and merges them with the current ones in a
+  // single pass, O(n + m log m) instead of m shifting inserts. Keys that
+  // are already present keep their current value.
+  template <container_compatible_range<value_type> R>
+  void insert_range(R&& rg) {
+    flat_map batch(from_range, std::forward<R>(rg), comp_);
+    merge_sorted(batch);
+  }
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    size_type index = lower_bound_index(key);
+    if (index != size() && !comp_(key, keys_.data()[index])) {
+      values_.data()[index] = std::forward<M>(obj);
+      return {make_iterator(index), false};
+    }
+    return {insert_at(index, key, std::forward<M>(obj)), true};
+  }
+  // The key and the mapped value are only built when key is not present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    size_type index = lower_bound_index(key);
+    if (index != size() && !comp_(key, keys_.data()[index])) {
+      return {make_iterator(index), false};
+    }
+    return {insert_at(index, key, std::forward<Args>(args)...), true};
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    size_type index = lower_bound_index(key);
+    if (index != size() && !comp_(key, keys_.data()[index])) {
+      return {make_iterator(index), false};
+    }
+    return {insert_at(index, std::move(key), std::forward<Args>(args)...),
+            true};
+  }
+
+  iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+  iterator erase(const_iterator pos) {
+    size_type index = pos - cbegin();
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+    return make_iterator(index);
+  }
+  size_type erase(const Key& key) {
+    size_type index = find_index(key);
+    if (index == size()) return 0;
+    erase(make_iterator(index));
+    return 1;
+  }
+  void swap(flat_map& other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+  // Moves the elements of other whose keys are not here yet, in one pass
+  // over both maps; other keeps the rest.
+  void merge(flat_map& other) {
+    if (this == &other) return;
+    merge_sorted(other);
+  }
+
+  iterator find(const Key& key) { return make_iterator(find_index(key)); }
+  const_iterator find(const Key& key) const {
+    return make_iterator(find_index(key));
+  }
+  bool contains(const Key& key) const { return find_index(key) != size(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) {
+    return make_iterator(lower_bound_index(key));
+  }
+  const_iterator lower_bound(const Key& key) const {
+    return make_iterator(lower_bound_index(key));
+  }
+  iterator upper_bound(const Key& key) {
+    return make_iterator(upper_bound_index(key));
+  }
+  const_iterator upper_bound(const Key& key) const {
+    return make_iterator(upper_bound_index(key));
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    size_type index = lower_bound_index(key);
+    size_type last = index + (index != size() &&
+                              !comp_(key, keys_.data()[index]));
+    return {make_iterator(index), make_iterator(last)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    size_type index = lower_bound_index(key);
+    size_type last = index + (index != size() &&
+                              !comp_(key, keys_.data()[index]));
+    return {make_iterator(index), make_iterator(last)};
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) {
+    return make_iterator(find_index(key));
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const {
+    return make_iterator(find_index(key));
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return find_index(key) != size();
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) {
+    return make_iterator(lower_bound_index(key));
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return make_iterator(lower_bound_index(key));
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) {
+    return make_iterator(upper_bound_index(key));
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return make_iterator(upper_bound_index(key));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
+
+ private:
+  static constexpr size_type kNoHint = static_cast<size_type>(-1);
+
+  iterator make_iterator(size_type index) noexcept {
+    return iterator(keys_.data() + index, values_.data() + index);
+  }
+  const_iterator make_iterator(size_type index) const noexcept {
+    return const_iterator(keys_.data() + index, values_.data() + index);
+  }
+
+  template <typename K>
+  size_type lower_bound_index(const K& key) const {
+    return sorted_lower_bound(keys_.data(), size(), key, comp_);
+  }
+  template <typename K>
+  size_type upper_bound_index(const K& key) const {
+    return sorted_upper_bound(keys_.data(), size(), key, comp_);
+  }
+  // The position of key, or size() when it is not present.
+  template <typename K>
+  size_type find_index(const K& key) const {
+    size_type index = lower_bound_index(key);
+    if (index != size() && comp_(key, keys_.data()[index])) return size();
+    return index;
+  }
+
+  // The index the hint stands for when key belongs right before it and is
+  // not present, kNoHint otherwise.
+  size_type hint_index(const_iterator hint, const Key& key) const {
+    size_type index = hint - cbegin();
+    const Key* k = keys_.data();
+    if ((index == size() || comp_(key, k[index])) &&
+        (index == 0 || comp_(k[index - 1], key))) {
+      return index;
+    }
+    return kNoHint;
+  }
+
+  // Inserts at a position known to keep the order; if the mapped value
+  // cannot be stored, the key goes again and the map is unchanged.
+  template <typename K, typename... Args>
+  iterator insert_at(size_type index, K&& key, Args&&... args) {
+    T value(std::forward<Args>(args)...);
+    keys_.insert(keys_.begin() + index, Key(std::forward<K>(key)));
+    try {
+      values_.insert(values_.begin() + index, std::move(value));
+    } catch (...) {
+      keys_.erase(keys_.begin() + index);
+      throw;
+    }
+    return make_iterator(index);
+  }
+
+  template <typename It, typename Sent>
+  void append_unsorted(It first, Sent last) {
+    for (; first != last; ++first) {
+      keys_.push_back((*first).first);
+      values_.push_back((*first).second);
+    }
+    sort_unique(keys_, values_, comp_);
+  }
+
+  // One pass over this map and the sorted, duplicate-free other: the
+  // elements of other whose keys are missing here move over, the others
+  // stay in other. Elements that go past the current last key are simply
+  // appended.
+  void merge_sorted(flat_map& other) {
+    size_type n = size();
+    size_type m = other.size();
+    if (m == 0) return;
+    Key* ok = other.keys_.data();
+    T* ov = other.values_.data();
+    if (n == 0 || comp_(keys_.data()[n - 1], ok[0])) {
+      reserve(n + m);
+      for (size_type j = 0; j < m; ++j) {
+        keys_.push_back(std::move(ok[j]));
+        values_.push_back(std::move(ov[j]));
+      }
+      other.clear();
+      return;
+    }
+    key_container_type keys;
+    mapped_container_type values;
+    keys.reserve(n + m);
+    values.reserve(n + m);
+    // everything is reserved up front, so once the moves start nothing
+    // allocates and nothing can throw halfway
+    key_container_type rest_keys;
+    mapped_container_type rest_values;
+    rest_keys.reserve(m);
+    rest_values.reserve(m);
+    Key* k = keys_.data();
+    T* v = values_.data();
+    size_type i = 0;
+    size_type j = 0;
+    while (i < n && j < m) {
+      if (comp_(k[i], ok[j])) {
+        keys.push_back(std::move(k[i]));
+        values.push_back(std::move(v[i++]));
+      } else if (comp_(ok[j], k[i])) {
+        keys.push_back(std::move(ok[j]));
+        values.push_back(std::move(ov[j++]));
+      } else {
+        rest_keys.push_back(std::move(ok[j]));
+        rest_values.push_back(std::move(ov[j++]));
+      }
+    }
+    for (; i < n; ++i) {
+      keys.push_back(std::move(k[i]));
+      values.push_back(std::move(v[i]));
+    }
+    for (; j < m; ++j) {
+      keys.push_back(std::move(ok[j]));
+      values.push_back(std::move(ov[j]));
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+    other.keys_.swap(rest_keys);
+    other.values_.swap(rest_values);
+  }
+
+  key_container_type keys_;
+  mapped_container_type values_;
+  [[no_unique_address]] Compare comp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MAP_H_
@@ -0,0 +1,290 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+/*
+ * From <functional>:
+ *  std::less: The default comparator.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the set from a brace-enclosed list of keys.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end: The sources accepted by the
+ *    range constructors, insert() and insert_range().
+ *
+ * From <utility>:
+ *  std::pair: The result of the insertion methods and equal_range().
+ */
+
+#include "flat/s21_sorted_array.h"
+#include "s21_container_tags.h"
+#include "vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * An ordered set with the interface of s21::set, stored as one sorted
+ * s21::vector of keys (see flat_map for the trade-offs: branchless binary
+ * search and linear iteration, O(n) single-element insert and erase, bulk
+ * input sorted once and merged in a single pass). Iterators are plain
+ * pointers to const keys and are invalidated by any insert or erase.
+ */
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = const Key*;
+  using const_iterator = const Key*;
+  using size_type = std::size_t;
+  using container_type = vector<Key>;
+
+  flat_set() = default;
+  explicit flat_set(const Compare& comp) : comp_(comp) {}
+  flat_set(std::initializer_list<value_type> const& items)
+      : keys_(items) {
+    sort_unique(keys_, comp_);
+  }
+  template <std::input_iterator InputIt>
+  flat_set(InputIt first, InputIt last, const Compare& comp = Compare())
+      : keys_(first, last), comp_(comp) {
+    sort_unique(keys_, comp_);
+  }
+  template <container_compatible_range<value_type> R>
+  flat_set(from_range_t, R&& rg, const Compare& comp = Compare())
+      : keys_(from_range, std::forward<R>(rg)), comp_(comp) {
+    sort_unique(keys_, comp_);
+  }
+  // Input already sorted and free of duplicates: copied as is, after one
+  // linear check (std::invalid_argument if it does not hold).
+  template <std::input_iterator InputIt>
+  flat_set(sorted_unique_t, InputIt first, InputIt last,
+           const Compare& comp = Compare())
+      : keys_(first, last), comp_(comp) {
+    check_sorted_unique(keys_, comp_);
+  }
+  flat_set(sorted_unique_t, container_type keys,
+           const Compare& comp = Compare())
+      : keys_(std::move(keys)), comp_(comp) {
+    check_sorted_unique(keys_, comp_);
+  }
+  flat_set(const flat_set& s) = default;
+  flat_set(flat_set&& s) noexcept
+      : keys_(std::move(s.keys_)), comp_(s.comp_) {}
+  ~flat_set() = default;
+
+  flat_set& operator=(const flat_set& s) {
+    if (this != &s) {
+      keys_ = s.keys_;
+      comp_ = s.comp_;
+    }
+    return *this;
+  }
+
+  flat_set& operator=(flat_set&& s) noexcept {
+    if (this != &s) {
+      keys_ = std::move(s.keys_);
+      comp_ = s.comp_;
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return keys_.data(); }
+  iterator end() const noexcept { return keys_.data() + keys_.size(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return keys_.max_size(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+
+  // The underlying sorted array.
+  const container_type& keys() const noexcept { return keys_; }
+  key_compare key_comp() const { return comp_; }
+  value_compare value_comp() const { return comp_; }
+
+  void clear() noexcept { keys_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert(value_type(value));
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    size_type index = lower_bound_index(value);
+    if (index != size() && !comp_(value, keys_.data()[index])) {
+      return {begin() + index, false};
+    }
+    return {insert_at(index, std::move(value)), true};
+  }
+  // A hint that is right (the key goes just before it) saves the search;
+  // any other hint is ignored.
+  iterator insert(const_iterator hint, const value_type& value) {
+    size_type index = hint - begin();
+    const Key* k = keys_.data();
+    if ((index == size() || comp_(value, k[index])) &&
+        (index == 0 || comp_(k[index - 1], value))) {
+      return insert_at(index, value_type(value));
+    }
+    return insert(value).first;
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    flat_set batch(first, last, comp_);
+    merge_sorted(batch);
+  }
+  // Sorts the new keys once and merges them with the current ones in a
+  // single pass, O(n + m log m) instead of m shifting inserts.
+  template <container_compatible_range<value_type> R>
+  void insert_range(R&& rg) {
+    flat_set batch(from_range, std::forward<R>(rg), comp_);
+    merge_sorted(batch);
+  }
+
+  iterator erase(const_iterator pos) {
+    size_type index = pos - begin();
+    keys_.erase(keys_.begin() + index);
+    return begin() + index;
+  }
+  size_type erase(const Key& key) {
+    size_type index = find_index(key);
+    if (index == size()) return 0;
+    erase(begin() + index);
+    return 1;
+  }
+  void swap(flat_set& other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+  // Moves the keys of other that are not here yet, in one pass over both
+  // sets; other keeps the rest.
+  void merge(flat_set& other) {
+    if (this == &other) return;
+    merge_sorted(other);
+  }
+
+  iterator find(const Key& key) const { return begin() + find_index(key); }
+  bool contains(const Key& key) const { return find_index(key) != size(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const Key& key) const {
+    return begin() + lower_bound_index(key);
+  }
+  iterator upper_bound(const Key& key) const {
+    return begin() + upper_bound_index(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) const {
+    iterator first = find(key);
+    if (first == end()) {
+      first = lower_bound(key);
+      return {first, first};
+    }
+    return {first, first + 1};
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) const {
+    return begin() + find_index(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return find_index(key) != size();
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) const {
+    return begin() + lower_bound_index(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) const {
+    return begin() + upper_bound_index(key);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
+
+ private:
+  template <typename K>
+  size_type lower_bound_index(const K& key) const {
+    return sorted_lower_bound(keys_.data(), size(), key, comp_);
+  }
+  template <typename K>
+  size_type upper_bound_index(const K& key) const {
+    return sorted_upper_bound(keys_.data(), size(), key, comp_);
+  }
+  // The position of key, or size() when it is not present.
+  template <typename K>
+  size_type find_index(const K& key) const {
+    size_type index = lower_bound_index(key);
+    if (index != size() && comp_(key, keys_.data()[index])) return size();
+    return index;
+  }
+
+  iterator insert_at(size_type index, value_type&& value) {
+    keys_.insert(keys_.begin() + index, std::move(value));
+    return begin() + index;
+  }
+
+  // One pass over this set and the sorted, duplicate-free other: keys of
+  // other missing here move over, the others stay in other. Keys past the
+  // current last one are simply appended.
+  void merge_sorted(flat_set& other) {
+    size_type n = size();
+    size_type m = other.size();
+    if (m == 0) return;
+    Key* ok = other.keys_.data();
+    if (n == 0 || comp_(keys_.data()[n - 1], ok[0])) {
+      keys_.reserve(n + m);
+      for (size_type j = 0; j < m; ++j) keys_.push_back(std::move(ok[j]));
+      other.clear();
+      return;
+    }
+    // everything is reserved up front, so once the moves start nothing
+    // allocates and nothing can throw halfway
+    container_type keys;
+    container_type rest;
+    keys.reserve(n + m);
+    rest.reserve(m);
+    Key* k = keys_.data();
+    size_type i = 0;
+    size_type j = 0;
+    while (i < n && j < m) {
+      if (comp_(k[i], ok[j])) {
+        keys.push_back(std::move(k[i++]));
+      } else if (comp_(ok[j], k[i])) {
+        keys.push_back(std::move(ok[j++]));
+      } else {
+        rest.push_back(std::move(ok[j++]));
+      }
+    }
+    for (; i < n; ++i) keys.push_back(std::move(k[i]));
+    for (; j < m; ++j) keys.push_back(std::move(ok[j]));
+    keys_.swap(keys);
+    other.keys_.swap(rest);
+  }
+
+  container_type keys_;
+  [[no_unique_address]] Compare comp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H_
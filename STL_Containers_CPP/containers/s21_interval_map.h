@@ -0,0 +1,313 @@
+#ifndef S21_INTERVAL_MAP_H_
+#define S21_INTERVAL_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <cstddef>:
+ *  std::ptrdiff_t: The overlap iterator's difference_type.
+ *
+ * From <functional>:
+ *  std::less: The default order of the interval ends.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    interval-value pairs.
+ *
+ * From <iterator>, <ranges>:
+ *  std::forward_iterator_tag, std::default_sentinel_t: The overlap iterator
+ *    walks the tree lazily and ends at the default sentinel.
+ *  std::ranges::subrange: The views returned by find_overlapping() and
+ *    stab().
+ *
+ * From <memory>:
+ *  std::allocator: The default 'Allocator'.
+ *
+ * From <type_traits>:
+ *  std::conditional_t: Picks const or mutable node pointers and references
+ *    for the overlap iterator.
+ *
+ * From <utility>:
+ *  std::pair: The value_type.
+ *  std::move, std::forward: Pass trees and constructor arguments on without
+ *    copies.
+ */
+
+#include "s21_map.h"
+#include "tree/s21_red_black_tree.h"
+
+namespace s21 {
+
+// The half-open interval [lo, hi).
+template <typename K>
+struct interval {
+  K lo;
+  K hi;
+
+  bool operator==(const interval&) const = default;
+};
+
+// Orders intervals by start, then by end.
+template <typename K, typename Compare = std::less<K>>
+struct interval_less {
+  [[no_unique_address]] Compare comp;
+
+  bool operator()(const interval<K>& a, const interval<K>& b) const {
+    if (comp(a.lo, b.lo)) return true;
+    if (comp(b.lo, a.lo)) return false;
+    return comp(a.hi, b.hi);
+  }
+};
+
+/*
+ * A multimap from half-open intervals [lo, hi) to values that answers
+ * overlap queries: the RedBlackTree with MultiKeys, ordered by interval
+ * start, where every node also keeps the largest end in its subtree
+ * (SubtreeMaxEnd, recomputed on insert, erase and in rotations). A query
+ * skips every subtree whose largest end is not past the query's start and
+ * everything to the right of the first start past the query's end.
+ *
+ * find_overlapping() and stab() return lazy views in start order: finding
+ * the first overlap is O(log n), each further one O(log n) at worst and
+ * amortized O(1) while the overlaps are neighbours in start order, as in a
+ * plain in-order walk. Equal intervals are all kept.
+ *
+ * Compare must be stateless (the augmentation builds its own).
+ */
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const interval<K>, V>>>
+class interval_map {
+ private:
+  struct EndOf {
+    const K& operator()(const std::pair<const interval<K>, V>& value) const {
+      return value.first.hi;
+    }
+  };
+  using tree_type =
+      RedBlackTree<interval<K>, std::pair<const interval<K>, V>,
+                   MapTraits<interval<K>, V>, interval_less<K, Compare>,
+                   Allocator, SubtreeMaxEnd<K, EndOf, Compare>, PointerLinks,
+                   MultiKeys>;
+  using Node = typename tree_type::Node;
+  tree_type tree_;
+
+  // An element matches when it ends after the query's lo and starts before
+  // its hi (with 'closed', for stab(): not after it).
+  struct Query {
+    K lo;
+    K hi;
+    bool closed;
+    [[no_unique_address]] Compare comp;
+
+    bool ends_after_lo(const K& end) const { return comp(lo, end); }
+    bool starts_in(const Node* node) const {
+      const K& start = node->data.first.lo;
+      return closed ? !comp(hi, start) : comp(start, hi);
+    }
+    // Nothing in the subtree ends after lo.
+    bool prunes(const Node* node) const {
+      return !node || !ends_after_lo(node->augment.max_end);
+    }
+  };
+
+ public:
+  using key_type = interval<K>;
+  using mapped_type = V;
+  using value_type = std::pair<const interval<K>, V>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = typename tree_type::size_type;
+
+  // Steps through the elements that overlap one query, in start order.
+  template <bool IsConst>
+  class overlap_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = interval_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using reference =
+        std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    overlap_iterator() = default;
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    overlap_iterator& operator++() {
+      node_ = next(node_, header_, query_);
+      return *this;
+    }
+    overlap_iterator operator++(int) {
+      overlap_iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const overlap_iterator& other) const {
+      return node_ == other.node_;
+    }
+    bool operator==(std::default_sentinel_t) const { return !node_; }
+
+    // The same element as a tree iterator, e.g. for erase().
+    iterator base() const
+      requires(!IsConst)
+    {
+      return iterator(node_);
+    }
+    const_iterator base() const
+      requires IsConst
+    {
+      return const_iterator(node_);
+    }
+
+   private:
+    friend class interval_map;
+
+    overlap_iterator(Node* header, const Query& query)
+        : header_(header),
+          node_(first_in(header->parent, query)),
+          query_(query) {}
+
+    Node* header_ = nullptr;
+    Node* node_ = nullptr;
+    Query query_{};
+  };
+
+  using overlap_range =
+      std::ranges::subrange<overlap_iterator<false>, std::default_sentinel_t>;
+  using const_overlap_range =
+      std::ranges::subrange<overlap_iterator<true>, std::default_sentinel_t>;
+
+  interval_map() : tree_() {}
+  interval_map(std::initializer_list<value_type> const& items)
+      : tree_(items) {}
+  interval_map(const interval_map& other) : tree_(other.tree_) {}
+  interval_map(interval_map&& other) noexcept
+      : tree_(std::move(other.tree_)) {}
+  ~interval_map() = default;
+
+  interval_map& operator=(const interval_map& other) {
+    if (this != &other) {
+      tree_ = other.tree_;
+    }
+    return *this;
+  }
+
+  interval_map& operator=(interval_map&& other) noexcept {
+    if (this != &other) {
+      tree_ = std::move(other.tree_);
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  void clear() { tree_.clear(); }
+
+  // Always inserts, after the equal intervals.
+  iterator insert(const value_type& value) {
+    return tree_.insert(value).first;
+  }
+  iterator insert(const K& lo, const K& hi, const V& obj) {
+    return tree_.emplace(key_type{lo, hi}, obj).first;
+  }
+  template <typename... Args>
+  iterator emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...).first;
+  }
+
+  iterator erase(iterator pos) { return tree_.erase(pos); }
+  // Erases every element with exactly this interval; returns how many.
+  size_type erase(const key_type& key) { return tree_.erase(key); }
+
+  // The first element with exactly this interval.
+  iterator find(const key_type& key) { return tree_.find(key); }
+  const_iterator find(const key_type& key) const { return tree_.find(key); }
+  size_type count(const key_type& key) const { return tree_.count(key); }
+
+  // The elements whose interval shares a point with [lo, hi); nothing when
+  // the query is empty.
+  overlap_range find_overlapping(const K& lo, const K& hi) {
+    return make_range<false>(lo, hi, false);
+  }
+  const_overlap_range find_overlapping(const K& lo, const K& hi) const {
+    return make_range<true>(lo, hi, false);
+  }
+  // The elements whose interval contains point.
+  overlap_range stab(const K& point) {
+    return make_range<false>(point, point, true);
+  }
+  const_overlap_range stab(const K& point) const {
+    return make_range<true>(point, point, true);
+  }
+  bool overlaps(const K& lo, const K& hi) const {
+    return !find_overlapping(lo, hi).empty();
+  }
+
+ private:
+  template <bool IsConst>
+  std::ranges::subrange<overlap_iterator<IsConst>, std::default_sentinel_t>
+  make_range(const K& lo, const K& hi, bool closed) const {
+    Query query{lo, hi, closed, Compare{}};
+    Node* header = const_cast<Node*>(tree_.end().get_node());
+    if (!closed && !query.comp(lo, hi)) {
+      return {overlap_iterator<IsConst>(), std::default_sentinel};
+    }
+    return {overlap_iterator<IsConst>(header, query), std::default_sentinel};
+  }
+
+  /*
+   * The first match in node's subtree, or nullptr. Nodes to the left start
+   * no later, so once a node starts in the query every left subtree that
+   * is not pruned holds a match, and a node starting past the query ends
+   * the search after its left subtree: one root-to-leaf path, O(log n).
+   */
+  static Node* first_in(Node* node, const Query& query) {
+    while (!query.prunes(node)) {
+      if (Node* found = first_in(node->left, query)) return found;
+      if (!query.starts_in(node)) return nullptr;
+      if (query.ends_after_lo(node->data.first.hi)) return node;
+      node = node->right;
+    }
+    return nullptr;
+  }
+
+  /*
+   * The next match after node in start order: first in its right subtree,
+   * then at each ancestor reached from the left (the node itself, then its
+   * right subtree). A subtree that is not pruned but holds no match has an
+   * element starting past the query, and so does everything after it.
+   */
+  static Node* next(Node* node, Node* header, const Query& query) {
+    for (;;) {
+      if (Node* found = first_in(node->right, query)) return found;
+      if (!query.prunes(node->right)) return nullptr;
+      while (node->parent != header && node == node->parent->right) {
+        node = node->parent;
+      }
+      if (node->parent == header) return nullptr;
+      node = node->parent;
+      if (!query.starts_in(node)) return nullptr;
+      if (query.ends_after_lo(node->data.first.hi)) return node;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_INTERVAL_MAP_H_
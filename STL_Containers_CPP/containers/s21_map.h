@@ -2,8 +2,10 @@
 #define S21_MAP_H_
 
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
 
 /*
@@ -15,6 +17,8 @@
  * From <memory>:
  *  std::allocator: The default class for memory management (allocation and
  *    deallocation) of the map's elements (key-value pairs).
+ *    node_pool_allocator can be passed as 'Allocator' instead; it serves the
+ *    nodes from slabs and frees them all at once on clear() and destruction.
  *
  * From <stdexcept>:
  *  std::out_of_range: An exception type thrown by the 'at' method when the
@@ -38,6 +42,7 @@
  * acting as the default less-than comparator.
  */
 
+#include "memory/s21_node_pool_allocator.h"
 #include "tree/s21_red_black_tree.h"
 
 namespace s21 {
@@ -58,15 +63,41 @@ struct MapTraits {
  *   `Tr` = `MapTraits<std::string, double>`
  *   `Cmp` = `std::less<std::string>`
  *   `A` = `std::allocator<std::pair<const std::string, double>>`
+ *
+ * `s21::map<std::string, V, std::less<std::string>, A, PointerLinks,
+ * StringKeyPrefix<>>` caches the first 16 bytes of each key in its node, so
+ * lookups compare the heap-allocated keys only when those bytes tie (see
+ * StringKeyPrefix). 'Links' picks the node layout as for set.
  */
 template <typename Key, typename T, typename Compare = std::less<Key>,
-          typename Allocator = std::allocator<std::pair<const Key, T>>>
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          typename Links = PointerLinks, typename KeyPrefix = NoKeyPrefix>
 class map {
+ public:
+  using allocator_type =
+      links_allocator_t<Links, std::pair<const Key, T>, Allocator>;
+
  private:
-  using tree_type = RedBlackTree<Key, std::pair<const Key, T>,
-                                 MapTraits<Key, T>, Compare, Allocator>;
+  using tree_type =
+      RedBlackTree<Key, std::pair<const Key, T>, MapTraits<Key, T>, Compare,
+                   allocator_type, NoAugmentation, Links, UniqueKeys,
+                   KeyPrefix>;
   tree_type tree_;
 
+  explicit map(tree_type&& tree) : tree_(std::move(tree)) {}
+  template <typename K, typename M, typename C, typename A, typename L,
+            typename P>
+  friend map<K, M, C, A, L, P> set_union(
+      const map<K, M, C, A, L, P>& a, const map<K, M, C, A, L, P>& b);
+  template <typename K, typename M, typename C, typename A, typename L,
+            typename P>
+  friend map<K, M, C, A, L, P> set_intersection(
+      const map<K, M, C, A, L, P>& a, const map<K, M, C, A, L, P>& b);
+  template <typename K, typename M, typename C, typename A, typename L,
+            typename P>
+  friend map<K, M, C, A, L, P> set_difference(
+      const map<K, M, C, A, L, P>& a, const map<K, M, C, A, L, P>& b);
+
  public:
   using key_type = Key;
   using mapped_type = T;
@@ -76,12 +107,32 @@ class map {
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
   using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   map() : tree_() {}
-  explicit map(const Compare& comp, const Allocator& alloc = Allocator())
+  explicit map(const Compare& comp,
+               const allocator_type& alloc = allocator_type())
       : tree_(comp, alloc) {}
   map(std::initializer_list<value_type> const& items) : tree_(items) {}
+  template <std::input_iterator InputIt>
+  map(InputIt first, InputIt last, const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(first, last, comp, alloc) {}
+  template <container_compatible_range<value_type> R>
+  map(from_range_t, R&& rg, const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(from_range, std::forward<R>(rg), comp, alloc) {}
+  // [first, last) must be strictly ascending: built in O(n), see RedBlackTree
+  template <std::input_iterator InputIt>
+  map(sorted_unique_t, InputIt first, InputIt last,
+      const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(sorted_unique, first, last, comp, alloc) {}
   map(const map& m) : tree_(m.tree_) {}
+  // Copy on up to 'threads' threads (0: all hardware threads); large
+  // maps are copied subtree by subtree in parallel, see RedBlackTree.
+  map(const map& m, unsigned threads) : tree_(m.tree_, threads) {}
   map(map&& m) noexcept : tree_(std::move(m.tree_)) {}
   ~map() = default;
 
@@ -115,10 +166,9 @@ class map {
     return it->second;
   }
 
-  T& operator[](const Key& key) {
-    auto result_pair = tree_.emplace(
-        std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>());
-    return result_pair.first->second;
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
   }
 
   iterator begin() noexcept { return tree_.begin(); }
@@ -133,35 +183,189 @@ class map {
   size_type max_size() const noexcept { return tree_.max_size(); }
 
   void clear() { tree_.clear(); }
+  // O(1) for the caller: the old elements are destroyed on a background
+  // thread (see background_reclaimer).
+  void clear_deferred() { tree_.clear_deferred(); }
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.assign(first, last);
+  }
   std::pair<iterator, bool> insert(const value_type& value) {
     return tree_.insert(value);
   }
+  // O(1) amortized when the element belongs right before hint
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.insert(hint, value);
+  }
   std::pair<iterator, bool> insert(const Key& key, const T& obj) {
-    return tree_.emplace(key, obj);
+    return tree_.try_emplace(key, key, obj);
   }
-  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
-    iterator it = tree_.find(key);
-    if (it != tree_.end()) {
-      it->second = obj;
-      return {it, false};
-    } else {
-      return insert(key, obj);
+  // One descent: the found element is assigned, otherwise a node is linked
+  // where the search ended.
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    auto result = tree_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
     }
+    return result;
+  }
+  // The key and the mapped value are only built when key is not present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
   }
 
   iterator erase(iterator pos) { return tree_.erase(pos); }
+  // Node handles: the element keeps its node (and address) while it is
+  // moved between containers or rekeyed
+  node_type extract(const_iterator pos) { return tree_.extract(pos); }
+  node_type extract(const Key& key) { return tree_.extract(key); }
+  insert_return_type insert(node_type&& handle) {
+    return tree_.insert(std::move(handle));
+  }
+  iterator insert(const_iterator hint, node_type&& handle) {
+    return tree_.insert(hint, std::move(handle));
+  }
   void swap(map& other) noexcept { tree_.swap(other.tree_); }
   void merge(map& other) { tree_.merge(other.tree_); }
 
   iterator find(const Key& key) { return tree_.find(key); }
   const_iterator find(const Key& key) const { return tree_.find(key); }
   bool contains(const Key& key) const { return tree_.contains(key); }
+  size_type count(const Key& key) const { return tree_.count(key); }
+
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.upper_bound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return tree_.equal_range(key);
+  }
+  // Lazy view of the elements with lo <= key < hi
+  std::ranges::subrange<iterator> range(const Key& lo, const Key& hi) {
+    return tree_.range(lo, hi);
+  }
+  std::ranges::subrange<const_iterator> range(const Key& lo,
+                                              const Key& hi) const {
+    return tree_.range(lo, hi);
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return tree_.contains(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  size_type count(const K& key) const {
+    return tree_.count(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return tree_.equal_range(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return tree_.equal_range(key);
+  }
 
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args&&... args) {
     return tree_.emplace(std::forward<Args>(args)...);
   }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
 };
 
+/*
+ * Set algebra on whole containers, each O(n + m) through one ordered walk
+ * over both inputs. The result uses a's comparator; when both contain a
+ * key the element is taken from a.
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Links, typename KeyPrefix>
+map<Key, T, Compare, Allocator, Links, KeyPrefix> set_union(
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& a,
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& b) {
+  using Result = map<Key, T, Compare, Allocator, Links, KeyPrefix>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kUnion, a.tree_, b.tree_));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Links, typename KeyPrefix>
+map<Key, T, Compare, Allocator, Links, KeyPrefix> set_intersection(
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& a,
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& b) {
+  using Result = map<Key, T, Compare, Allocator, Links, KeyPrefix>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kIntersection, a.tree_, b.tree_));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Links, typename KeyPrefix>
+map<Key, T, Compare, Allocator, Links, KeyPrefix> set_difference(
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& a,
+    const map<Key, T, Compare, Allocator, Links, KeyPrefix>& b) {
+  using Result = map<Key, T, Compare, Allocator, Links, KeyPrefix>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kDifference, a.tree_, b.tree_));
+}
+
 }  // namespace s21
 #endif  // S21_MAP_H_
\ No newline at end of file
@@ -0,0 +1,204 @@
+#ifndef S21_MULTISET_H_
+#define S21_MULTISET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+/*
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the multiset from a brace-enclosed list of
+ *    keys; equal keys are all kept.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator: The sources accepted by the range constructors,
+ *    insert() and assign(). std::ranges::subrange: The view returned by
+ *    range().
+ *
+ * From <memory>:
+ *  std::allocator: The default 'Allocator'; node_pool_allocator can be
+ *    passed instead.
+ *
+ * From <utility>:
+ *  std::pair: The result of equal_range().
+ *  std::move, std::forward: Pass trees, node handles and constructor
+ *    arguments on without copies.
+ */
+
+#include "s21_set.h"
+#include "tree/s21_red_black_tree.h"
+
+namespace s21 {
+
+/*
+ * An ordered set that keeps equal keys, in the order they were inserted in
+ * (see multimap): the RedBlackTree with MultiKeys. erase(key) removes all
+ * of them and returns how many.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class multiset {
+ private:
+  using tree_type = RedBlackTree<Key, Key, SetTraits<Key>, Compare, Allocator,
+                                 NoAugmentation, PointerLinks, MultiKeys>;
+  tree_type tree_;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
+
+  multiset() : tree_() {}
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  multiset(std::initializer_list<value_type> const& items) : tree_(items) {}
+  template <std::input_iterator InputIt>
+  multiset(InputIt first, InputIt last, const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : tree_(first, last, comp, alloc) {}
+  template <container_compatible_range<value_type> R>
+  multiset(from_range_t, R&& rg, const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : tree_(from_range, std::forward<R>(rg), comp, alloc) {}
+  multiset(const multiset& m) : tree_(m.tree_) {}
+  multiset(multiset&& m) noexcept : tree_(std::move(m.tree_)) {}
+  ~multiset() = default;
+
+  multiset& operator=(const multiset& m) {
+    if (this != &m) {
+      tree_ = m.tree_;
+    }
+    return *this;
+  }
+
+  multiset& operator=(multiset&& m) noexcept {
+    if (this != &m) {
+      tree_ = std::move(m.tree_);
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.cbegin(); }
+  const_iterator cend() const noexcept { return tree_.cend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() { tree_.clear(); }
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.assign(first, last);
+  }
+  // Always inserts, after the elements with an equal key.
+  iterator insert(const value_type& value) {
+    return tree_.insert(value).first;
+  }
+  // O(1) amortized when the element belongs right before hint
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.insert(hint, value);
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) tree_.emplace_hint(tree_.end(), *first);
+  }
+  template <typename... Args>
+  iterator emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...).first;
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+  iterator erase(iterator pos) { return tree_.erase(pos); }
+  size_type erase(const Key& key) { return tree_.erase(key); }
+  node_type extract(const_iterator pos) { return tree_.extract(pos); }
+  node_type extract(const Key& key) { return tree_.extract(key); }
+  iterator insert(node_type&& handle) {
+    return tree_.insert(std::move(handle)).position;
+  }
+  iterator insert(const_iterator hint, node_type&& handle) {
+    return tree_.insert(hint, std::move(handle));
+  }
+  void swap(multiset& other) noexcept { tree_.swap(other.tree_); }
+  // Moves all of other's elements; they follow the equal ones already here.
+  void merge(multiset& other) { tree_.merge(other.tree_); }
+
+  iterator find(const Key& key) { return tree_.find(key); }
+  const_iterator find(const Key& key) const { return tree_.find(key); }
+  bool contains(const Key& key) const { return tree_.contains(key); }
+  // O(log n + count)
+  size_type count(const Key& key) const { return tree_.count(key); }
+
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.upper_bound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return tree_.equal_range(key);
+  }
+  // Lazy view of the elements with lo <= key < hi
+  std::ranges::subrange<iterator> range(const Key& lo, const Key& hi) {
+    return tree_.range(lo, hi);
+  }
+  std::ranges::subrange<const_iterator> range(const Key& lo,
+                                              const Key& hi) const {
+    return tree_.range(lo, hi);
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return tree_.contains(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  size_type count(const K& key) const {
+    return tree_.count(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return tree_.equal_range(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return tree_.equal_range(key);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_MULTISET_H_
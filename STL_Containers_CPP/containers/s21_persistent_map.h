@@ -0,0 +1,478 @@
+#ifndef S21_PERSISTENT_MAP_H_
+#define S21_PERSISTENT_MAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+/*
+ * From <array>:
+ *  std::array: The fixed stack of ancestors an iterator keeps, since the
+ *    nodes have no parent links.
+ *
+ * From <atomic>:
+ *  std::memory_order: The orderings of the reference count updates.
+ *
+ * From <functional>:
+ *  std::less: The default key order.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <iterator>:
+ *  std::forward_iterator_tag: The iterator category.
+ *
+ * From <stdexcept>:
+ *  std::out_of_range: Thrown by 'at' when the key is not present.
+ *
+ * From <utility>:
+ *  std::pair: The value_type. std::exchange, std::swap: Move and swap the
+ *    root.
+ */
+
+#include "tree/s21_tree_node.h"
+
+namespace s21 {
+
+/*
+ * An immutable ordered map: every update returns a new version and leaves
+ * the map it was called on as it was. Versions share all the nodes they
+ * have in common; an update copies only the O(log n) nodes on the path to
+ * the changed key (path copying), and copying a map, i.e. taking a
+ * snapshot, is O(1).
+ *
+ * The tree is a functional red-black tree (Okasaki's insertion, Kahrs'
+ * deletion) of TreeNodes with PersistentLinks: nodes never change once a
+ * version holds them and are freed by an atomic reference count when the
+ * last version using them goes away. So a version can be read by any
+ * number of threads without locks, and versions sharing nodes may be
+ * created and destroyed on different threads. As with any value, one
+ * persistent_map object that is assigned to while others read it needs
+ * synchronisation; copying it out under a lock is O(1).
+ *
+ *Key type,
+ *T mapped type,
+ *Compare functor std::less and others
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map {
+ private:
+  using Node = TreeNode<std::pair<const Key, T>, NoAugmentation,
+                        PersistentLinks>;
+
+  static constexpr TreeNodeColor kRed = TreeNodeColor::RED;
+  static constexpr TreeNodeColor kBlack = TreeNodeColor::BLACK;
+  // A red-black tree is at most twice as high as a perfect one, and fewer
+  // than 2^64 nodes fit in memory.
+  static constexpr std::size_t kMaxHeight = 128;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  /*
+   * In-order position in one version: the path of nodes still to visit,
+   * the current one on top. Iterators stay valid as long as any version
+   * holding their nodes exists.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = persistent_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() = default;
+
+    reference operator*() const { return stack_[depth_ - 1]->data; }
+    pointer operator->() const { return &stack_[depth_ - 1]->data; }
+
+    const_iterator& operator++() {
+      const Node* node = stack_[--depth_];
+      push_left_spine(node->right);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return depth_ == 0 ? other.depth_ == 0
+                         : other.depth_ != 0 &&
+                               stack_[depth_ - 1] ==
+                                   other.stack_[other.depth_ - 1];
+    }
+
+   private:
+    friend class persistent_map;
+
+    void push(const Node* node) { stack_[depth_++] = node; }
+    void push_left_spine(const Node* node) {
+      for (; node; node = node->left) push(node);
+    }
+
+    std::array<const Node*, kMaxHeight> stack_;
+    std::size_t depth_ = 0;
+  };
+
+  using iterator = const_iterator;
+
+  persistent_map() = default;
+  explicit persistent_map(const Compare& comp) : key_compare_(comp) {}
+  persistent_map(std::initializer_list<value_type> const& items) {
+    for (const value_type& item : items) *this = insert(item);
+  }
+  persistent_map(const persistent_map& other)
+      : root_(retain(other.root_)),
+        size_(other.size_),
+        key_compare_(other.key_compare_) {}
+  persistent_map(persistent_map&& other) noexcept
+      : root_(std::exchange(other.root_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        key_compare_(std::move(other.key_compare_)) {}
+  ~persistent_map() { release(root_); }
+
+  persistent_map& operator=(const persistent_map& other) {
+    if (this != &other) {
+      persistent_map temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  persistent_map& operator=(persistent_map&& other) noexcept {
+    if (this != &other) {
+      persistent_map temp(std::move(other));
+      swap(temp);
+    }
+    return *this;
+  }
+
+  const_iterator begin() const {
+    const_iterator it;
+    it.push_left_spine(root_);
+    return it;
+  }
+  const_iterator end() const { return const_iterator(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  const T& at(const Key& key) const {
+    const Node* node = find_node(key);
+    if (!node) {
+      throw std::out_of_range("persistent_map::at: key not found");
+    }
+    return node->data.second;
+  }
+  const_iterator find(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return it != end() && !key_compare_(key, it->first) ? it : end();
+  }
+  // The first element whose key is not less than key.
+  const_iterator lower_bound(const Key& key) const {
+    const_iterator it;
+    for (const Node* node = root_; node;) {
+      if (key_compare_(node->data.first, key)) {
+        node = node->right;
+      } else {
+        it.push(node);
+        node = node->left;
+      }
+    }
+    return it;
+  }
+  bool contains(const Key& key) const { return find_node(key) != nullptr; }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  // New versions, O(log n) time and new nodes each. insert() returns this
+  // version unchanged when key is present, set() replaces its value.
+  [[nodiscard]] persistent_map insert(const value_type& value) const {
+    if (contains(value.first)) return *this;
+    return with_root(insert_root(value), size_ + 1);
+  }
+  [[nodiscard]] persistent_map insert(const Key& key, const T& obj) const {
+    return insert(value_type(key, obj));
+  }
+  [[nodiscard]] persistent_map set(const Key& key, const T& obj) const {
+    bool present = contains(key);
+    return with_root(insert_root(value_type(key, obj)),
+                     present ? size_ : size_ + 1);
+  }
+  [[nodiscard]] persistent_map erase(const Key& key) const {
+    if (!contains(key)) return *this;
+    Ref root = erase_from(root_, key);
+    return with_root(make_root_black(std::move(root)), size_ - 1);
+  }
+
+  void swap(persistent_map& other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(key_compare_, other.key_compare_);
+  }
+
+ private:
+  Node* root_ = nullptr;
+  size_type size_ = 0;
+  [[no_unique_address]] Compare key_compare_;
+
+  static Node* retain(Node* node) noexcept {
+    if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  // Frees the node and, in turn, the children nobody else holds. The
+  // recursion only follows nodes being freed, so it is O(height) deep.
+  static void release(Node* node) noexcept {
+    if (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      release(node->left);
+      release(node->right);
+      delete node;
+    }
+  }
+
+  // An owned reference to a node, released when it goes out of scope, so
+  // an exception thrown while copying an element frees the partial result.
+  class Ref {
+   public:
+    Ref() = default;
+    explicit Ref(Node* node) noexcept : node_(node) {}
+    Ref(Ref&& other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+    Ref& operator=(Ref&& other) noexcept {
+      std::swap(node_, other.node_);
+      return *this;
+    }
+    ~Ref() { release(node_); }
+
+    Node* get() const noexcept { return node_; }
+    Node* operator->() const noexcept { return node_; }
+    Node* take() noexcept { return std::exchange(node_, nullptr); }
+
+   private:
+    Node* node_ = nullptr;
+  };
+
+  static Ref share(Node* node) noexcept { return Ref(retain(node)); }
+  static bool is_red(const Node* node) noexcept {
+    return node && node->is_red();
+  }
+  static bool is_black(const Node* node) noexcept {
+    return node && node->is_black();
+  }
+
+  static Ref make(TreeNodeColor color, Ref left, const value_type& value,
+                  Ref right) {
+    Node* node = new Node(value);
+    node->set_color(color);
+    node->left = left.take();
+    node->right = right.take();
+    return Ref(node);
+  }
+  // The same node in another color.
+  static Ref paint(TreeNodeColor color, const Node* node) {
+    return make(color, share(node->left), node->data, share(node->right));
+  }
+
+  persistent_map with_root(Ref root, size_type size) const {
+    persistent_map result(key_compare_);
+    result.root_ = root.take();
+    result.size_ = size;
+    return result;
+  }
+
+  const Node* find_node(const Key& key) const {
+    const Node* node = root_;
+    while (node) {
+      if (key_compare_(key, node->data.first)) {
+        node = node->left;
+      } else if (key_compare_(node->data.first, key)) {
+        node = node->right;
+      } else {
+        break;
+      }
+    }
+    return node;
+  }
+
+  Ref insert_root(const value_type& value) const {
+    Ref root = insert_into(root_, value);
+    // the root is always a node this update created, nobody else sees it
+    root->set_black();
+    return root;
+  }
+  Ref make_root_black(Ref root) const {
+    if (!is_red(root.get())) return root;
+    if (root->refs.load(std::memory_order_acquire) == 1) {
+      root->set_black();
+      return root;
+    }
+    return paint(kBlack, root.get());
+  }
+
+  // Okasaki's insertion; the element replaces an equal one.
+  Ref insert_into(const Node* node, const value_type& value) const {
+    if (!node) return make(kRed, Ref(), value, Ref());
+    if (key_compare_(value.first, node->data.first)) {
+      Ref left = insert_into(node->left, value);
+      if (node->is_black()) {
+        return balance(std::move(left), node->data, share(node->right));
+      }
+      return make(kRed, std::move(left), node->data, share(node->right));
+    }
+    if (key_compare_(node->data.first, value.first)) {
+      Ref right = insert_into(node->right, value);
+      if (node->is_black()) {
+        return balance(share(node->left), node->data, std::move(right));
+      }
+      return make(kRed, share(node->left), node->data, std::move(right));
+    }
+    return make(node->get_color(), share(node->left), value,
+                share(node->right));
+  }
+
+  /*
+   * Kahrs' deletion: descending into a black child takes a black level out
+   * of that side, which balance_left/balance_right make up for; the erased
+   * node's children are joined by append(). key must be present.
+   */
+  Ref erase_from(const Node* node, const Key& key) const {
+    if (key_compare_(key, node->data.first)) {
+      Ref left = erase_from(node->left, key);
+      if (is_black(node->left)) {
+        return balance_left(std::move(left), node->data, share(node->right));
+      }
+      return make(kRed, std::move(left), node->data, share(node->right));
+    }
+    if (key_compare_(node->data.first, key)) {
+      Ref right = erase_from(node->right, key);
+      if (is_black(node->right)) {
+        return balance_right(share(node->left), node->data, std::move(right));
+      }
+      return make(kRed, share(node->left), node->data, std::move(right));
+    }
+    return append(share(node->left), share(node->right));
+  }
+
+  // A black node over left and right, with a red-red violation on either
+  // side rotated into a red node with two black children.
+  static Ref balance(Ref left, const value_type& value, Ref right) {
+    const Node* l = left.get();
+    const Node* r = right.get();
+    if (is_red(l) && is_red(r)) {
+      return make(kRed, paint(kBlack, l), value, paint(kBlack, r));
+    }
+    if (is_red(l) && is_red(l->left)) {
+      Ref new_right = make(kBlack, share(l->right), value, std::move(right));
+      return make(kRed, paint(kBlack, l->left), l->data, std::move(new_right));
+    }
+    if (is_red(l) && is_red(l->right)) {
+      const Node* lr = l->right;
+      Ref new_left = make(kBlack, share(l->left), l->data, share(lr->left));
+      Ref new_right = make(kBlack, share(lr->right), value, std::move(right));
+      return make(kRed, std::move(new_left), lr->data, std::move(new_right));
+    }
+    if (is_red(r) && is_red(r->right)) {
+      Ref new_left = make(kBlack, std::move(left), value, share(r->left));
+      return make(kRed, std::move(new_left), r->data, paint(kBlack, r->right));
+    }
+    if (is_red(r) && is_red(r->left)) {
+      const Node* rl = r->left;
+      Ref new_left = make(kBlack, std::move(left), value, share(rl->left));
+      Ref new_right = make(kBlack, share(rl->right), r->data, share(r->right));
+      return make(kRed, std::move(new_left), rl->data, std::move(new_right));
+    }
+    return make(kBlack, std::move(left), value, std::move(right));
+  }
+
+  // left has one black level less than right.
+  static Ref balance_left(Ref left, const value_type& value, Ref right) {
+    const Node* r = right.get();
+    if (is_red(left.get())) {
+      return make(kRed, paint(kBlack, left.get()), value, std::move(right));
+    }
+    if (is_black(r)) {
+      return balance(std::move(left), value, paint(kRed, r));
+    }
+    // r is red with a black left child
+    const Node* rl = r->left;
+    Ref new_left = make(kBlack, std::move(left), value, share(rl->left));
+    Ref new_right =
+        balance(share(rl->right), r->data, paint(kRed, r->right));
+    return make(kRed, std::move(new_left), rl->data, std::move(new_right));
+  }
+
+  // right has one black level less than left.
+  static Ref balance_right(Ref left, const value_type& value, Ref right) {
+    const Node* l = left.get();
+    if (is_red(right.get())) {
+      return make(kRed, std::move(left), value, paint(kBlack, right.get()));
+    }
+    if (is_black(l)) {
+      return balance(paint(kRed, l), value, std::move(right));
+    }
+    // l is red with a black right child
+    const Node* lr = l->right;
+    Ref new_left = balance(paint(kRed, l->left), l->data, share(lr->left));
+    Ref new_right = make(kBlack, share(lr->right), value, std::move(right));
+    return make(kRed, std::move(new_left), lr->data, std::move(new_right));
+  }
+
+  // Joins two trees of the same black height whose keys are all ordered
+  // left before right.
+  static Ref append(Ref left, Ref right) {
+    if (!left.get()) return right;
+    if (!right.get()) return left;
+    const Node* l = left.get();
+    const Node* r = right.get();
+    if (is_red(l) && is_red(r)) {
+      Ref middle = append(share(l->right), share(r->left));
+      if (is_red(middle.get())) {
+        const Node* m = middle.get();
+        Ref new_left = make(kRed, share(l->left), l->data, share(m->left));
+        Ref new_right = make(kRed, share(m->right), r->data, share(r->right));
+        return make(kRed, std::move(new_left), m->data, std::move(new_right));
+      }
+      Ref new_right = make(kRed, std::move(middle), r->data, share(r->right));
+      return make(kRed, share(l->left), l->data, std::move(new_right));
+    }
+    if (is_black(l) && is_black(r)) {
+      Ref middle = append(share(l->right), share(r->left));
+      if (is_red(middle.get())) {
+        const Node* m = middle.get();
+        Ref new_left = make(kBlack, share(l->left), l->data, share(m->left));
+        Ref new_right =
+            make(kBlack, share(m->right), r->data, share(r->right));
+        return make(kRed, std::move(new_left), m->data, std::move(new_right));
+      }
+      Ref new_right =
+          make(kBlack, std::move(middle), r->data, share(r->right));
+      return balance_left(share(l->left), l->data, std::move(new_right));
+    }
+    if (is_red(r)) {
+      Ref new_left = append(std::move(left), share(r->left));
+      return make(kRed, std::move(new_left), r->data, share(r->right));
+    }
+    Ref new_right = append(share(l->right), std::move(right));
+    return make(kRed, share(l->left), l->data, std::move(new_right));
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_PERSISTENT_MAP_H_
@@ -0,0 +1,204 @@
+#ifndef S21_RADIX_MAP_H_
+#define S21_RADIX_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+/*
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator: The sources accepted by the range constructor and
+ *    insert(). std::ranges::subrange: The view returned by prefix().
+ *
+ * From <memory>:
+ *  std::allocator: The default allocator; it is rebound to the leaf and
+ *    inner node types.
+ *
+ * From <stdexcept>:
+ *  std::out_of_range: Thrown by 'at' when the key is not present.
+ *
+ * From <string_view>:
+ *  std::string_view: The prefix of prefix scans.
+ *
+ * From <tuple>, <utility>:
+ *  std::piecewise_construct, std::forward_as_tuple: Build the key and the
+ *    mapped value of a new element in place (try_emplace, operator[]).
+ *  std::pair: The value_type and the result of the insertion methods.
+ */
+
+#include "radix/s21_radix_tree.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+/*
+ * An ordered map with the interface of s21::map, stored in an adaptive
+ * radix tree (see RadixTree): a lookup walks the key's bytes instead of
+ * comparing whole keys at every level, which pays off for dense integer
+ * ids and for string keys with long shared prefixes (URLs, paths).
+ *
+ * Keys are integers or std::string (see radix_key), ordered like
+ * std::less: integers by value, strings bytewise. prefix() gives all keys
+ * starting with a prefix in O(prefix length). Like s21::map, iterators stay
+ * valid until their element is erased.
+ */
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class radix_map {
+ private:
+  using tree_type =
+      RadixTree<Key, std::pair<const Key, T>, MapTraits<Key, T>, Allocator>;
+  tree_type tree_;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = typename tree_type::size_type;
+  using node_counts_type = typename tree_type::NodeCounts;
+
+  radix_map() : tree_() {}
+  explicit radix_map(const Allocator& alloc) : tree_(alloc) {}
+  radix_map(std::initializer_list<value_type> const& items) : tree_() {
+    insert(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  radix_map(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : tree_(alloc) {
+    insert(first, last);
+  }
+  radix_map(const radix_map& m) : tree_(m.tree_) {}
+  radix_map(radix_map&& m) noexcept : tree_(std::move(m.tree_)) {}
+  ~radix_map() = default;
+
+  radix_map& operator=(const radix_map& m) {
+    if (this != &m) {
+      tree_ = m.tree_;
+    }
+    return *this;
+  }
+
+  radix_map& operator=(radix_map&& m) noexcept {
+    if (this != &m) {
+      tree_ = std::move(m.tree_);
+    }
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    iterator it = tree_.find(key);
+    if (it == tree_.end()) {
+      throw std::out_of_range("radix_map::at: key not found");
+    }
+    return it->second;
+  }
+  const T& at(const Key& key) const {
+    const_iterator it = tree_.find(key);
+    if (it == tree_.end()) {
+      throw std::out_of_range("radix_map::at: key not found");
+    }
+    return it->second;
+  }
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.cbegin(); }
+  const_iterator cend() const noexcept { return tree_.cend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+  // How many inner nodes of each size the tree uses.
+  node_counts_type node_counts() const noexcept { return tree_.node_counts(); }
+
+  void clear() noexcept { tree_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.try_emplace(value.first, value);
+  }
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return tree_.try_emplace(key, key, obj);
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) emplace(*first);
+  }
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    auto result = tree_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+
+  iterator erase(iterator pos) { return tree_.erase(pos); }
+  iterator erase(const_iterator pos) { return tree_.erase(pos); }
+  size_type erase(const Key& key) { return tree_.erase_key(key); }
+  void swap(radix_map& other) noexcept { tree_.swap(other.tree_); }
+
+  iterator find(const Key& key) { return tree_.find(key); }
+  const_iterator find(const Key& key) const { return tree_.find(key); }
+  bool contains(const Key& key) const { return find(key) != end(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.upper_bound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Lazy view of the elements whose key starts with prefix, in key order;
+  // only for string keys
+  std::ranges::subrange<iterator> prefix(std::string_view key_prefix)
+    requires(!tree_type::kFixedLength)
+  {
+    auto [first, last] = tree_.prefix_range(key_prefix);
+    return {first, last};
+  }
+  std::ranges::subrange<const_iterator> prefix(
+      std::string_view key_prefix) const
+    requires(!tree_type::kFixedLength)
+  {
+    auto [first, last] = tree_.prefix_range(key_prefix);
+    return {first, last};
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_RADIX_MAP_H_
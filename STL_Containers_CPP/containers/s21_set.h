@@ -2,6 +2,7 @@
 #define S21_SET_H_
 
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -12,7 +13,9 @@
  *
  * From <memory>:
  *  std::allocator: The default class for memory management (allocation and
- *    deallocation) of the set's elements (the keys).
+ *    deallocation) of the set's elements (the keys). node_pool_allocator can
+ *    be passed as 'Allocator' instead; it serves the nodes from slabs and
+ *    frees them all at once on clear() and destruction.
  *
  * From <utility>:
  *  std::pair: The return type for the insert and emplace methods, used to
@@ -26,6 +29,7 @@
  * acting as the default less-than comparator for ordering keys in the set.
  */
 
+#include "memory/s21_node_pool_allocator.h"
 #include "tree/s21_red_black_tree.h"
 
 namespace s21 {
@@ -44,14 +48,35 @@ struct SetTraits {
  *   `Tr` = `SetTraits<int>`
  *   `Cmp` = `std::less<int>`
  *   `A` = `std::allocator<int>`
+ *
+ * `s21::set<int, std::less<int>, std::allocator<int>, ArenaIndexLinks>`
+ * links its nodes with 32-bit arena indices, 16 bytes per node; the default
+ * std::allocator is then replaced by the layout's node_arena_allocator
+ * (include tree/s21_tree_node_arena_links.h, see ArenaIndexLinks).
  * */
 template <typename Key, typename Compare = std::less<Key>,
-          typename Allocator = std::allocator<Key>>
+          typename Allocator = std::allocator<Key>,
+          typename Links = PointerLinks>
 class set {
+ public:
+  using allocator_type = links_allocator_t<Links, Key, Allocator>;
+
  private:
-  using tree_type = RedBlackTree<Key, Key, SetTraits<Key>, Compare, Allocator>;
+  using tree_type = RedBlackTree<Key, Key, SetTraits<Key>, Compare,
+                                 allocator_type, NoAugmentation, Links>;
   tree_type tree_;
 
+  explicit set(tree_type&& tree) : tree_(std::move(tree)) {}
+  template <typename K, typename C, typename A, typename L>
+  friend set<K, C, A, L> set_union(const set<K, C, A, L>& a,
+                                   const set<K, C, A, L>& b);
+  template <typename K, typename C, typename A, typename L>
+  friend set<K, C, A, L> set_intersection(const set<K, C, A, L>& a,
+                                          const set<K, C, A, L>& b);
+  template <typename K, typename C, typename A, typename L>
+  friend set<K, C, A, L> set_difference(const set<K, C, A, L>& a,
+                                        const set<K, C, A, L>& b);
+
  public:
   using key_type = Key;
   using value_type = Key;
@@ -60,12 +85,32 @@ class set {
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
   using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   set() : tree_() {}
-  explicit set(const Compare& comp, const Allocator& alloc = Allocator())
+  explicit set(const Compare& comp,
+               const allocator_type& alloc = allocator_type())
       : tree_(comp, alloc) {}
   set(std::initializer_list<value_type> const& items) : tree_(items) {}
+  template <std::input_iterator InputIt>
+  set(InputIt first, InputIt last, const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(first, last, comp, alloc) {}
+  template <container_compatible_range<value_type> R>
+  set(from_range_t, R&& rg, const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(from_range, std::forward<R>(rg), comp, alloc) {}
+  // [first, last) must be strictly ascending: built in O(n), see RedBlackTree
+  template <std::input_iterator InputIt>
+  set(sorted_unique_t, InputIt first, InputIt last,
+      const Compare& comp = Compare(),
+      const allocator_type& alloc = allocator_type())
+      : tree_(sorted_unique, first, last, comp, alloc) {}
   set(const set& s) : tree_(s.tree_) {}
+  // Copy on up to 'threads' threads (0: all hardware threads); large
+  // sets are copied subtree by subtree in parallel, see RedBlackTree.
+  set(const set& s, unsigned threads) : tree_(s.tree_, threads) {}
   set(set&& s) noexcept : tree_(std::move(s.tree_)) {}
   ~set() = default;
 
@@ -95,21 +140,158 @@ class set {
   size_type max_size() const noexcept { return tree_.max_size(); }
 
   void clear() { tree_.clear(); }
+  // O(1) for the caller: the old elements are destroyed on a background
+  // thread (see background_reclaimer).
+  void clear_deferred() { tree_.clear_deferred(); }
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.assign(first, last);
+  }
   std::pair<iterator, bool> insert(const value_type& value) {
     return tree_.insert(value);
   }
+  // O(1) amortized when the element belongs right before hint
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.insert(hint, value);
+  }
   iterator erase(iterator pos) { return tree_.erase(pos); }
+  // Node handles: the element keeps its node (and address) while it is
+  // moved between containers or rekeyed
+  node_type extract(const_iterator pos) { return tree_.extract(pos); }
+  node_type extract(const Key& key) { return tree_.extract(key); }
+  insert_return_type insert(node_type&& handle) {
+    return tree_.insert(std::move(handle));
+  }
+  iterator insert(const_iterator hint, node_type&& handle) {
+    return tree_.insert(hint, std::move(handle));
+  }
   void swap(set& other) noexcept { tree_.swap(other.tree_); }
   void merge(set& other) { tree_.merge(other.tree_); }
 
   iterator find(const Key& key) { return tree_.find(key); }
   bool contains(const Key& key) const { return tree_.contains(key); }
+  size_type count(const Key& key) const { return tree_.count(key); }
+
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.upper_bound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return tree_.equal_range(key);
+  }
+  // Lazy view of the elements with lo <= key < hi
+  std::ranges::subrange<iterator> range(const Key& lo, const Key& hi) {
+    return tree_.range(lo, hi);
+  }
+  std::ranges::subrange<const_iterator> range(const Key& lo,
+                                              const Key& hi) const {
+    return tree_.range(lo, hi);
+  }
+
+  // Lookup by any type the comparator accepts, only for transparent
+  // comparators such as std::less<> (no temporary Key is built)
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const {
+    return tree_.contains(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  size_type count(const K& key) const {
+    return tree_.count(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return tree_.equal_range(key);
+  }
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return tree_.equal_range(key);
+  }
 
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args&&... args) {
     return tree_.emplace(std::forward<Args>(args)...);
   }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
 };
 
+/*
+ * Set algebra on whole containers, each O(n + m) through one ordered walk
+ * over both inputs. The result uses a's comparator; when both contain a
+ * key the element is taken from a.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Links>
+set<Key, Compare, Allocator, Links> set_union(
+    const set<Key, Compare, Allocator, Links>& a,
+    const set<Key, Compare, Allocator, Links>& b) {
+  using Result = set<Key, Compare, Allocator, Links>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kUnion, a.tree_, b.tree_));
+}
+
+template <typename Key, typename Compare, typename Allocator, typename Links>
+set<Key, Compare, Allocator, Links> set_intersection(
+    const set<Key, Compare, Allocator, Links>& a,
+    const set<Key, Compare, Allocator, Links>& b) {
+  using Result = set<Key, Compare, Allocator, Links>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kIntersection, a.tree_, b.tree_));
+}
+
+template <typename Key, typename Compare, typename Allocator, typename Links>
+set<Key, Compare, Allocator, Links> set_difference(
+    const set<Key, Compare, Allocator, Links>& a,
+    const set<Key, Compare, Allocator, Links>& b) {
+  using Result = set<Key, Compare, Allocator, Links>;
+  using Op = typename Result::tree_type::SetOperation;
+  return Result(
+      Result::tree_type::set_operation(Op::kDifference, a.tree_, b.tree_));
+}
+
 }  // namespace s21
 #endif  // S21_SET_H_
\ No newline at end of file
@@ -0,0 +1,262 @@
+#ifndef S21_UNORDERED_MAP_H_
+#define S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/*
+ * From <functional>:
+ *  std::hash, std::equal_to: The default hash function and key equality.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the map from a brace-enclosed list of
+ *    key-value pairs.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end/distance: The sources
+ *    accepted by the range constructors, insert() and insert_range().
+ *
+ * From <memory>:
+ *  std::allocator: The default allocator; it is rebound to the table's
+ *    slot and control byte types.
+ *
+ * From <stdexcept>:
+ *  std::out_of_range: Thrown by 'at' when the key is not present.
+ *
+ * From <tuple>, <utility>:
+ *  std::piecewise_construct, std::forward_as_tuple: Build the key and the
+ *    mapped value of a new element in place (try_emplace, operator[]).
+ *  std::pair: The value_type and the result of the insertion methods.
+ */
+
+#include "hash/s21_swiss_table.h"
+#include "s21_container_tags.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+/*
+ * A hash map with the interface of std::unordered_map, stored in an
+ * open-addressing Swiss table (see SwissTable): expected O(1) lookups that
+ * compare a group of candidates per SIMD instruction, where s21::map pays
+ * O(log n) scattered node visits.
+ *
+ * Elements live in one flat array: inserting invalidates all iterators and
+ * references when the table grows, and erasing may move the elements that
+ * follow the erased one (see SwissTable::erase). There are no buckets to
+ * inspect beyond bucket_count(), and no node handles.
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+ private:
+  using table_type = SwissTable<Key, std::pair<const Key, T>,
+                                MapTraits<Key, T>, Hash, KeyEqual, Allocator>;
+  table_type table_;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = typename table_type::size_type;
+
+  unordered_map() : table_() {}
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {}
+  unordered_map(std::initializer_list<value_type> const& items) : table_() {
+    table_.reserve(items.size());
+    insert(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  unordered_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {
+    insert(first, last);
+  }
+  template <container_compatible_range<value_type> R>
+  unordered_map(from_range_t, R&& rg, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {
+    insert_range(std::forward<R>(rg));
+  }
+  unordered_map(const unordered_map& m) : table_(m.table_) {}
+  unordered_map(unordered_map&& m) noexcept : table_(std::move(m.table_)) {}
+  ~unordered_map() = default;
+
+  unordered_map& operator=(const unordered_map& m) {
+    if (this != &m) {
+      table_ = m.table_;
+    }
+    return *this;
+  }
+
+  unordered_map& operator=(unordered_map&& m) noexcept {
+    if (this != &m) {
+      table_ = std::move(m.table_);
+    }
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    iterator it = table_.find(key);
+    if (it == table_.end()) {
+      throw std::out_of_range("unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator it = table_.find(key);
+    if (it == table_.end()) {
+      throw std::out_of_range("unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  iterator begin() noexcept { return table_.begin(); }
+  const_iterator begin() const noexcept { return table_.begin(); }
+  iterator end() noexcept { return table_.end(); }
+  const_iterator end() const noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return table_.cbegin(); }
+  const_iterator cend() const noexcept { return table_.cend(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.try_emplace(value.first, value);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.emplace(std::move(value));
+  }
+  // The hint is accepted for compatibility with std::unordered_map; a hash
+  // table has no use for it.
+  iterator insert(const_iterator, const value_type& value) {
+    return insert(value).first;
+  }
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return table_.try_emplace(key, key, obj);
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) emplace(*first);
+  }
+  // Grows the table once up front when the size of the range is known.
+  template <container_compatible_range<value_type> R>
+  void insert_range(R&& rg) {
+    if constexpr (std::ranges::sized_range<R>) {
+      table_.reserve(size() + std::ranges::size(rg));
+    }
+    insert(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    auto result = table_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  // The key and the mapped value are only built when key is not present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  iterator erase(iterator pos) { return table_.erase(pos); }
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const Key& key) { return table_.erase_key(key); }
+  void swap(unordered_map& other) noexcept { table_.swap(other.table_); }
+  void merge(unordered_map& other) { table_.merge(other.table_); }
+
+  iterator find(const Key& key) { return table_.find(key); }
+  const_iterator find(const Key& key) const { return table_.find(key); }
+  bool contains(const Key& key) const { return find(key) != end(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    iterator it = find(key);
+    return {it, it == end() ? it : std::next(it)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    const_iterator it = find(key);
+    return {it, it == end() ? it : std::next(it)};
+  }
+
+  // Lookup by any type the hash and equality accept, only when both are
+  // transparent (no temporary Key is built)
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) {
+    return table_.find(key);
+  }
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  const_iterator find(const K& key) const {
+    return table_.find(key);
+  }
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator, Args&&... args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+
+  // Hash policy (see SwissTable)
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type count) { table_.rehash(count); }
+  void reserve(size_type count) { table_.reserve(count); }
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MAP_H_
@@ -0,0 +1,189 @@
+#ifndef S21_UNORDERED_SET_H_
+#define S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+/*
+ * From <functional>:
+ *  std::hash, std::equal_to: The default hash function and key equality.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: Builds the set from a brace-enclosed list of keys.
+ *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end/size: The sources accepted by
+ *    the range constructors, insert() and insert_range().
+ *
+ * From <memory>:
+ *  std::allocator: The default allocator; it is rebound to the table's
+ *    slot and control byte types.
+ *
+ * From <utility>:
+ *  std::pair: The result of the insertion methods and equal_range().
+ */
+
+#include "hash/s21_swiss_table.h"
+#include "s21_container_tags.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+/*
+ * A hash set with the interface of std::unordered_set, stored in a Swiss
+ * table (see SwissTable and unordered_map). Keys are never modified through
+ * an iterator, so iterator and const_iterator are both read-only.
+ */
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set {
+ private:
+  using table_type =
+      SwissTable<Key, Key, SetTraits<Key>, Hash, KeyEqual, Allocator>;
+  table_type table_;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = typename table_type::size_type;
+
+  unordered_set() : table_() {}
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {}
+  unordered_set(std::initializer_list<value_type> const& items) : table_() {
+    table_.reserve(items.size());
+    insert(items.begin(), items.end());
+  }
+  template <std::input_iterator InputIt>
+  unordered_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {
+    insert(first, last);
+  }
+  template <container_compatible_range<value_type> R>
+  unordered_set(from_range_t, R&& rg, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {
+    insert_range(std::forward<R>(rg));
+  }
+  unordered_set(const unordered_set& s) : table_(s.table_) {}
+  unordered_set(unordered_set&& s) noexcept : table_(std::move(s.table_)) {}
+  ~unordered_set() = default;
+
+  unordered_set& operator=(const unordered_set& s) {
+    if (this != &s) {
+      table_ = s.table_;
+    }
+    return *this;
+  }
+
+  unordered_set& operator=(unordered_set&& s) noexcept {
+    if (this != &s) {
+      table_ = std::move(s.table_);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return table_.begin(); }
+  iterator end() const noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return table_.cbegin(); }
+  const_iterator cend() const noexcept { return table_.cend(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.try_emplace(value, value);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.try_emplace(value, std::move(value));
+  }
+  // The hint is accepted for compatibility with std::unordered_set and not
+  // used.
+  iterator insert(const_iterator, const value_type& value) {
+    return insert(value).first;
+  }
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) emplace(*first);
+  }
+  // Grows the table once up front when the size of the range is known.
+  template <container_compatible_range<value_type> R>
+  void insert_range(R&& rg) {
+    if constexpr (std::ranges::sized_range<R>) {
+      table_.reserve(size() + std::ranges::size(rg));
+    }
+    insert(std::ranges::begin(rg), std::ranges::end(rg));
+  }
+
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const Key& key) { return table_.erase_key(key); }
+  void swap(unordered_set& other) noexcept { table_.swap(other.table_); }
+  void merge(unordered_set& other) { table_.merge(other.table_); }
+
+  iterator find(const Key& key) const { return table_.find(key); }
+  bool contains(const Key& key) const { return find(key) != end(); }
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+  std::pair<iterator, iterator> equal_range(const Key& key) const {
+    iterator it = find(key);
+    return {it, it == end() ? it : std::next(it)};
+  }
+
+  // Lookup by any type the hash and equality accept, only when both are
+  // transparent (no temporary Key is built)
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) const {
+    return table_.find(key);
+  }
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+  template <typename K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator, Args&&... args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+
+  // Hash policy (see SwissTable)
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type count) { table_.rehash(count); }
+  void reserve(size_type count) { table_.reserve(count); }
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H_
@@ -3,8 +3,12 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <ranges>
 #include <stdexcept>
 
+#include "../s21_container_tags.h"
+
 namespace s21 {
 template <typename T>
 class stack {  // Last In First Out только pushfront и popfront (то есть
@@ -35,9 +39,19 @@ class stack {  // Last In First Out только pushfront и popfront (то е
 
   stack(std::initializer_list<value_type> const& items)
       : head(nullptr), tail(nullptr), stack_size(0) {
-    for (const auto& item : items) {
-      push(item);
-    }
+    push_range(items.begin(), items.end());
+  }
+
+  // elements are pushed in order, so *(last - 1) ends up on top
+  template <std::input_iterator InputIt>
+  stack(InputIt first, InputIt last)
+      : head(nullptr), tail(nullptr), stack_size(0) {
+    push_range(first, last);
+  }
+
+  template <container_compatible_range<T> R>
+  stack(from_range_t, R&& rg) : head(nullptr), tail(nullptr), stack_size(0) {
+    push_range(std::ranges::begin(rg), std::ranges::end(rg));
   }
 
   stack(const stack& s) : head(nullptr), tail(nullptr), stack_size(0) {
@@ -135,6 +149,12 @@ class stack {  // Last In First Out только pushfront и popfront (то е
     stack_size--;
   }
 
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    stack fresh(first, last);
+    swap(fresh);
+  }
+
   void swap(stack& other) {
     Node* temp_head = head;
     Node* temp_tail = tail;
@@ -146,6 +166,44 @@ class stack {  // Last In First Out только pushfront и popfront (то е
     other.tail = temp_tail;
     other.stack_size = temp_size;
   }
+
+ private:
+  // builds a detached chain with the last element at its head, so a
+  // throwing copy leaves the stack unchanged, then puts it on top
+  template <typename It, typename Sent>
+  void push_range(It first, Sent last) {
+    Node* chain_head = nullptr;
+    Node* chain_tail = nullptr;
+    size_type count = 0;
+    try {
+      for (; first != last; ++first, ++count) {
+        Node* node = new Node(*first);
+        node->next = chain_head;
+        if (chain_head) {
+          chain_head->prev = node;
+        } else {
+          chain_tail = node;
+        }
+        chain_head = node;
+      }
+    } catch (...) {
+      while (chain_head) {
+        Node* temp = chain_head;
+        chain_head = chain_head->next;
+        delete temp;
+      }
+      throw;
+    }
+    if (!chain_head) return;
+    chain_tail->next = head;
+    if (head) {
+      head->prev = chain_tail;
+    } else {
+      tail = chain_tail;
+    }
+    head = chain_head;
+    stack_size += count;
+  }
 };
 }  // namespace s21
 
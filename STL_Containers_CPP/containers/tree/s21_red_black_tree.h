@@ -1,13 +1,20 @@
 #ifndef S21_RED_BLACK_TREE_H_
 #define S21_RED_BLACK_TREE_H_
 
+#include <concepts>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <ranges>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 /*
+ * From <concepts>:
+ *  std::convertible_to: Used by the releasable_allocator concept.
+ *
  * From <functional>:
  *  std::less: A function object for performing less-than comparisons. It is the
  *    default comparator for ordering keys in the tree.
@@ -16,6 +23,11 @@
  *  std::initializer_list: Represents a list of elements, used to construct
  *    the tree from a brace-enclosed list of values (e.g., {1, 2, 3}).
  *
+ * From <iterator>, <ranges>:
+ *  std::input_iterator, std::ranges::begin/end: Describe the sources accepted
+ *    by the range constructors and assign().
+ *  std::ranges::subrange: The lazy view of [lo, hi) returned by range().
+ *
  * From <memory>:
  *  std::allocator: The default class for memory management (allocation and
  *    deallocation) of the tree's nodes.
@@ -27,7 +39,11 @@
  *  This header provides standard exception classes. While not directly visible
  *  in the function signatures, it is included to allow for the throwing of
  *  exceptions like std::bad_alloc on allocation failure or other potential
- *  runtime errors.
+ *  runtime errors. std::invalid_argument is thrown by the sorted_unique_t
+ *  constructor when its order check fails, std::out_of_range by select().
+ *
+ * From <type_traits>:
+ *  std::is_same_v: Skips all augmentation bookkeeping for NoAugmentation.
  *
  * From <utility>:
  *  std::pair: A template that holds two values, used here as the return type
@@ -40,38 +56,111 @@
  *    used to implement the tree's swap member function efficiently.
  */
 
+#include "../memory/s21_background_reclaimer.h"
+#include "../s21_container_tags.h"
+#include "s21_tree_augment.h"
 #include "s21_tree_iterator.h"
+#include "s21_tree_key_prefix.h"
+#include "s21_tree_node_handle.h"
 #include "s21_tree_node.h"
 
 namespace s21 {
+
+// Allocators that can drop every node at once (see node_pool_allocator).
+template <typename A>
+concept releasable_allocator = requires(A& a, const A& ca) {
+  { ca.can_release() } -> std::convertible_to<bool>;
+  a.release();
+};
+
+// Whether A may allocate nodes for a layout that names its own allocator
+// (Links::allocator<Node>, e.g. ArenaIndexLinks); any A fits the others.
+template <typename Links, typename Node, typename A>
+constexpr bool links_allocator_fits = true;
+template <typename Links, typename Node, typename A>
+  requires requires { typename Links::template allocator<Node>; }
+constexpr bool links_allocator_fits<Links, Node, A> =
+    std::is_same_v<A, typename Links::template allocator<Node>>;
+
+// The allocator a container of T with these Links uses when given A: the
+// layout's own (Links::allocator) in place of the default std::allocator,
+// otherwise A itself.
+template <typename Links, typename T, typename A>
+struct links_allocator {
+  using type = A;
+};
+template <typename Links, typename T>
+  requires requires { typename Links::template allocator<T>; }
+struct links_allocator<Links, T, std::allocator<T>> {
+  using type = typename Links::template allocator<T>;
+};
+template <typename Links, typename T, typename A>
+using links_allocator_t = typename links_allocator<Links, T, A>::type;
+
+// Key policies: UniqueKeys drops an element whose key is already present
+// (map, set); MultiKeys keeps it after the equal ones, so equal keys stay
+// in insertion order (multimap, multiset).
+struct UniqueKeys {};
+struct MultiKeys {};
+
 /*Key type,
  *Value type,
  *Traits functor get key from value: SetTraits, MapTraits.
  *Compare functor std::less and others
  *Allocator class for memory handling
+ *Augment per-subtree data kept in the nodes (see s21_tree_augment.h)
+ *Links node layout: PointerLinks, TaggedPointerLinks or ArenaIndexLinks
+ *  (s21_tree_node_arena_links.h)
+ *Keys UniqueKeys or MultiKeys
+ *KeyPrefix key start cached in the nodes (see s21_tree_key_prefix.h)
  */
 template <typename Key, typename T, typename Traits,
           typename Compare = std::less<Key>,
-          typename Allocator = std::allocator<T>>
+          typename Allocator = std::allocator<T>,
+          typename Augment = NoAugmentation, typename Links = PointerLinks,
+          typename Keys = UniqueKeys, typename KeyPrefix = NoKeyPrefix>
 class RedBlackTree {
  public:
   using key_type = Key;
   using value_type = T;
   using size_type = std::size_t;
 
-  using Node = TreeNode<value_type>;
+  using Node = TreeNode<value_type, Augment, Links, KeyPrefix>;
   using iterator = TreeIterator<Node, false>;
   using const_iterator = TreeIterator<Node, true>;
   using node_allocator_type =
       typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
   using alloc_traits = std::allocator_traits<node_allocator_type>;
+  using node_type = TreeNodeHandle<Key, T, Node, node_allocator_type>;
+  using insert_return_type = TreeInsertReturn<iterator, node_type>;
+
+  static constexpr bool kMultiKeys = std::is_same_v<Keys, MultiKeys>;
+
+  static_assert(links_allocator_fits<Links, Node, node_allocator_type>,
+                "these Links need nodes from Links::allocator<Node>");
+  static_assert(KeyPrefix::template kOrdersLike<Key, Compare>,
+                "KeyPrefix must order keys like Compare");
 
   explicit RedBlackTree(const Allocator& alloc = Allocator());
   explicit RedBlackTree(const Compare& comp,
                         const Allocator& alloc = Allocator());
   RedBlackTree(std::initializer_list<value_type> const& items,
                const Allocator& alloc = Allocator());
+  template <std::input_iterator InputIt>
+  RedBlackTree(InputIt first, InputIt last, const Compare& comp = Compare(),
+               const Allocator& alloc = Allocator());
+  template <container_compatible_range<T> R>
+  RedBlackTree(from_range_t, R&& rg, const Compare& comp = Compare(),
+               const Allocator& alloc = Allocator());
+  template <std::input_iterator InputIt>
+  RedBlackTree(sorted_unique_t, InputIt first, InputIt last,
+               const Compare& comp = Compare(),
+               const Allocator& alloc = Allocator());
   RedBlackTree(const RedBlackTree& other);
+  // Copies with up to 'threads' threads (0: one per hardware thread). Large
+  // subtrees go to worker threads when the allocator allows it (stateless,
+  // or able to absorb a worker's pool); otherwise this is the plain copy.
+  RedBlackTree(const RedBlackTree& other, unsigned threads);
   RedBlackTree(RedBlackTree&& other) noexcept;
   ~RedBlackTree();
 
@@ -92,16 +181,105 @@ class RedBlackTree {
   }
 
   void clear();
+  // Empties the tree in O(1) and destroys the old nodes on the
+  // background_reclaimer thread, so element destructors run there. Falls
+  // back to clear() when the allocator cannot be handed over.
+  void clear_deferred();
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last);
   std::pair<iterator, bool> insert(const value_type& value);
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args&&... args);
+  iterator insert(const_iterator hint, const value_type& value);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+  // Descends with key first and builds the element from args only when no
+  // equivalent key is present; args must produce an element with that key.
+  // With MultiKeys it always inserts, after the elements with equal keys.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args);
   iterator erase(iterator pos);
+  // Erases every element with an equivalent key; returns how many.
+  size_type erase(const key_type& key);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);
+  insert_return_type insert(node_type&& handle);
+  iterator insert(const_iterator hint, node_type&& handle);
   void swap(RedBlackTree& other) noexcept;
   void merge(RedBlackTree& other);
 
+  enum class SetOperation { kUnion, kIntersection, kDifference };
+  static RedBlackTree set_operation(SetOperation op, const RedBlackTree& a,
+                                    const RedBlackTree& b);
+
   iterator find(const key_type& key);
   const_iterator find(const key_type& key) const;
   bool contains(const key_type& key) const;
+  size_type count(const key_type& key) const;
+
+  iterator lower_bound(const key_type& key);
+  const_iterator lower_bound(const key_type& key) const;
+  iterator upper_bound(const key_type& key);
+  const_iterator upper_bound(const key_type& key) const;
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const;
+  std::ranges::subrange<iterator> range(const key_type& lo,
+                                        const key_type& hi);
+  std::ranges::subrange<const_iterator> range(const key_type& lo,
+                                              const key_type& hi) const;
+
+  // Heterogeneous lookup: with a transparent comparator any type comparable
+  // with the keys (e.g. std::string_view for std::string) is accepted
+  // without building a key_type.
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator find(const K& key);
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator find(const K& key) const;
+  template <typename K>
+    requires transparent_comparator<Compare>
+  bool contains(const K& key) const;
+  template <typename K>
+    requires transparent_comparator<Compare>
+  size_type count(const K& key) const;
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator lower_bound(const K& key);
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator lower_bound(const K& key) const;
+  template <typename K>
+    requires transparent_comparator<Compare>
+  iterator upper_bound(const K& key);
+  template <typename K>
+    requires transparent_comparator<Compare>
+  const_iterator upper_bound(const K& key) const;
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  template <typename K>
+    requires transparent_comparator<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const;
+
+  // Order statistics, O(log n); need an Augment that keeps subtree sizes.
+  // rank(key) is the number of elements with a smaller key, select(k) the
+  // k-th smallest key (0-based, std::out_of_range past the end) and nth(k)
+  // the iterator to that element (end() past the end).
+  size_type rank(const key_type& key) const
+    requires counting_augmentation<Augment>;
+  const key_type& select(size_type k) const
+    requires counting_augmentation<Augment>;
+  iterator nth(size_type k)
+    requires counting_augmentation<Augment>;
+  const_iterator nth(size_type k) const
+    requires counting_augmentation<Augment>;
+
+  // The monoid folded over the elements with keys in [lo, hi), in key
+  // order, O(log n); needs a SubtreeAggregate augmentation.
+  auto aggregate(const key_type& lo, const key_type& hi) const
+    requires aggregating_augmentation<Augment>;
 
  private:
   Node* header_;
@@ -111,11 +289,106 @@ class RedBlackTree {
   Compare key_compare_;
 
   void init_header();
+  void reset_header() noexcept;
   template <typename... Args>
-  Node* create_node(Args&&... args);
-  void destroy_node(Node* node);
-  void destroy_tree(Node* node);
-  Node* copy_tree(Node* other_node, Node* parent);
+  static Node* allocate_node(node_allocator_type& alloc, Args&&... args);
+  static void free_node(node_allocator_type& alloc, Node* node);
+  template <typename... Args>
+  Node* create_node(Args&&... args) {
+    return allocate_node(node_allocator_, std::forward<Args>(args)...);
+  }
+  void destroy_node(Node* node) { free_node(node_allocator_, node); }
+  // Subtrees at least this large may be copied by a worker thread.
+  static constexpr size_type kParallelCopyGrain = size_type{1} << 14;
+
+  static void destroy_tree(node_allocator_type& alloc, Node* node,
+                           bool free_memory = true);
+  bool release_nodes();
+  static Node* copy_tree(node_allocator_type& alloc, const Node* source,
+                         Node* parent);
+  Node* copy_tree_parallel(const Node* source, size_type count,
+                           unsigned threads);
+
+  // Nodes linked through 'right' in input order, see make_chain().
+  struct NodeChain {
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    size_type count = 0;
+    bool sorted = true;
+  };
+
+  // Where a key would be linked, or the node that already holds it.
+  struct InsertPosition {
+    Node* parent;
+    bool as_left;
+    Node* existing;
+  };
+
+  template <typename K>
+  InsertPosition find_insert_position(const K& key) const;
+  std::pair<iterator, bool> insert_node(Node* node);
+  std::pair<iterator, bool> insert_node(const_iterator hint, Node* node);
+  void link_node(Node* node, Node* parent, bool as_left);
+  template <typename It, typename Sent>
+  void assign_range(It first, Sent last);
+  template <typename It, typename Sent>
+  void assign_sorted(It first, Sent last);
+  template <typename It, typename Sent>
+  NodeChain make_chain(It first, Sent last, bool check_order);
+  void destroy_chain(Node* head);
+  void link_sorted_chain(const NodeChain& chain);
+  NodeChain detach_all();
+  bool adopt_allocator(const node_allocator_type& other) const;
+  Node* unlink_node(Node* node);
+  Node* build_balanced(Node*& cursor, size_type n, size_type depth,
+                       size_type red_depth);
+  Node* nth_node(size_type k) const
+    requires counting_augmentation<Augment>;
+
+  static constexpr bool kAugmented = !std::is_same_v<Augment, NoAugmentation>;
+  static void update_node(Node* node) {
+    if constexpr (kAugmented) Augment::update(node);
+  }
+  void update_path(Node* node) {
+    if constexpr (kAugmented) {
+      for (; node != header_; node = node->parent) Augment::update(node);
+    }
+  }
+
+  // The descents compare the cached key prefixes first, see KeyPrefix.
+  static constexpr bool kKeyPrefix = !std::is_same_v<KeyPrefix, NoKeyPrefix>;
+  using key_prefix_type = typename KeyPrefix::node_data;
+  template <typename Lookup>
+  static key_prefix_type make_prefix(const Lookup& key) noexcept {
+    if constexpr (kKeyPrefix) {
+      return KeyPrefix::make(key);
+    } else {
+      return {};
+    }
+  }
+  static void set_key_prefix(Node* node) noexcept {
+    if constexpr (kKeyPrefix) {
+      node->key_prefix = KeyPrefix::make(Traits{}(node->data));
+    }
+  }
+  // Whether key, whose prefix is 'prefix', sorts before the node's key and
+  // the reverse; the prefixes decide unless they tie.
+  template <typename Lookup>
+  bool key_less(const Lookup& key, const key_prefix_type& prefix,
+                const Node* node) const {
+    if constexpr (kKeyPrefix) {
+      if (int c = KeyPrefix::compare(prefix, node->key_prefix)) return c < 0;
+    }
+    return key_compare_(key, get_key(node->data));
+  }
+  template <typename Lookup>
+  bool node_less(const Node* node, const Lookup& key,
+                 const key_prefix_type& prefix) const {
+    if constexpr (kKeyPrefix) {
+      if (int c = KeyPrefix::compare(node->key_prefix, prefix)) return c < 0;
+    }
+    return key_compare_(get_key(node->data), key);
+  }
 
   Node* get_root() const noexcept { return header_->parent; }
   void set_root(Node* node) noexcept {
@@ -123,6 +396,13 @@ class RedBlackTree {
     if (node) node->parent = header_;
   }
 
+  template <typename K>
+  Node* find_node(const K& key) const;
+  template <typename K>
+  Node* lower_bound_node(const K& key) const;
+  template <typename K>
+  Node* upper_bound_node(const K& key) const;
+
   void rotate_left(Node* node);
   void rotate_right(Node* node);
   void fix_insertion(Node* node);
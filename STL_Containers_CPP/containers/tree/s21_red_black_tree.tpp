@@ -1,11 +1,44 @@
 #ifndef S21_RED_BLACK_TREE_TPP_
 #define S21_RED_BLACK_TREE_TPP_
 
+#include <algorithm>
+#include <bit>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 /*
  * Functions/types used from included standard library headers:
  *
+ * From <algorithm>:
+ *  std::min: Caps the number of copy threads by the size of the tree.
+ *
+ * From <bit>:
+ *  std::bit_width: Depth of the last level of a balanced tree built from
+ * sorted input, which is the only level colored red.
+ *
+ * From <exception>:
+ *  std::exception_ptr, std::current_exception, std::rethrow_exception: Carry
+ * an exception out of a copy worker to the constructing thread.
+ *
+ * From <functional>:
+ *  std::function: The teardown job clear_deferred() queues; std::ref passes
+ * each copy worker its allocator.
+ *
+ * From <thread>:
+ *  std::jthread, std::thread::hardware_concurrency: The copy workers.
+ *
+ * From <type_traits>:
+ *  std::is_trivially_destructible_v: Lets release_nodes() skip the walk over
+ * the nodes when destroying them would do nothing. std::is_same_v,
+ * std::remove_cvref_t: Detect an emplace() of a ready value_type.
+ *
+ * From <vector>:
+ *  std::vector: The subtrees handed to copy workers and their allocators.
+ *
  * From <utility>:
  *  std::exchange: Replaces the value of an object with a new one and returns
  * the object's old value. It is used in the move constructor/assignment to
@@ -25,9 +58,10 @@
 
 namespace s21 {
 
-#define RBT_TEMPLATE_PARAMS \
-  template <typename K, typename T, typename Tr, typename Cmp, typename A>
-#define RBT_CLASS RedBlackTree<K, T, Tr, Cmp, A>
+#define RBT_TEMPLATE_PARAMS                                               \
+  template <typename K, typename T, typename Tr, typename Cmp, typename A, \
+            typename Aug, typename L, typename Ks, typename P>
+#define RBT_CLASS RedBlackTree<K, T, Tr, Cmp, A, Aug, L, Ks, P>
 
 RBT_TEMPLATE_PARAMS
 RBT_CLASS::RedBlackTree(const A& alloc)
@@ -45,9 +79,35 @@ RBT_TEMPLATE_PARAMS
 RBT_CLASS::RedBlackTree(std::initializer_list<value_type> const& items,
                         const A& alloc)
     : RedBlackTree(alloc) {
-  for (const auto& item : items) {
-    insert(item);
-  }
+  assign_range(items.begin(), items.end());
+}
+
+RBT_TEMPLATE_PARAMS
+template <std::input_iterator InputIt>
+RBT_CLASS::RedBlackTree(InputIt first, InputIt last, const Cmp& comp,
+                        const A& alloc)
+    : RedBlackTree(comp, alloc) {
+  assign_range(first, last);
+}
+
+RBT_TEMPLATE_PARAMS
+template <container_compatible_range<T> R>
+RBT_CLASS::RedBlackTree(from_range_t, R&& rg, const Cmp& comp, const A& alloc)
+    : RedBlackTree(comp, alloc) {
+  assign_range(std::ranges::begin(rg), std::ranges::end(rg));
+}
+
+/*
+ * Trusts that [first, last) is strictly ascending and builds the tree in
+ * O(n) without comparing keys. Builds without NDEBUG still verify the order
+ * (n - 1 comparisons) and throw std::invalid_argument when it is violated.
+ */
+RBT_TEMPLATE_PARAMS
+template <std::input_iterator InputIt>
+RBT_CLASS::RedBlackTree(sorted_unique_t, InputIt first, InputIt last,
+                        const Cmp& comp, const A& alloc)
+    : RedBlackTree(comp, alloc) {
+  assign_sorted(first, last);
 }
 
 RBT_TEMPLATE_PARAMS
@@ -59,7 +119,33 @@ RBT_CLASS::RedBlackTree(const RBT_CLASS& other)
       key_compare_(other.key_compare_) {
   init_header();
   if (other.get_root()) {
-    set_root(copy_tree(other.get_root(), header_));
+    try {
+      set_root(copy_tree(node_allocator_, other.get_root(), header_));
+    } catch (...) {
+      destroy_node(header_);
+      throw;
+    }
+    size_ = other.size_;
+    header_->left = get_root()->minimum();
+    header_->right = get_root()->maximum();
+  }
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_CLASS::RedBlackTree(const RBT_CLASS& other, unsigned threads)
+    : size_(0),
+      node_allocator_(alloc_traits::select_on_container_copy_construction(
+          other.node_allocator_)),
+      key_extractor_(other.key_extractor_),
+      key_compare_(other.key_compare_) {
+  init_header();
+  if (other.get_root()) {
+    try {
+      set_root(copy_tree_parallel(other.get_root(), other.size_, threads));
+    } catch (...) {
+      destroy_node(header_);
+      throw;
+    }
     size_ = other.size_;
     header_->left = get_root()->minimum();
     header_->right = get_root()->maximum();
@@ -83,8 +169,10 @@ RBT_CLASS::RedBlackTree(RBT_CLASS&& other) noexcept
 
 RBT_TEMPLATE_PARAMS
 RBT_CLASS::~RedBlackTree() {
-  clear();
-  destroy_node(header_);
+  if (!release_nodes()) {
+    clear();
+    destroy_node(header_);
+  }
 }
 
 RBT_TEMPLATE_PARAMS
@@ -149,8 +237,13 @@ typename RBT_CLASS::const_iterator RBT_CLASS::cend() const noexcept {
 
 RBT_TEMPLATE_PARAMS
 void RBT_CLASS::clear() {
+  if (get_root() && release_nodes()) {
+    size_ = 0;
+    init_header();
+    return;
+  }
   if (get_root()) {
-    destroy_tree(get_root());
+    destroy_tree(node_allocator_, get_root());
   }
   size_ = 0;
   set_root(nullptr);
@@ -158,50 +251,270 @@ void RBT_CLASS::clear() {
   header_->right = header_;
 }
 
+/*
+ * With a stateless allocator the detached nodes are simply freed by the
+ * reclaimer. A pool allocator goes to the reclaimer along with the nodes
+ * (if no one else shares the pool) and the tree continues on a fresh one;
+ * the reclaimer then only destroys the elements and releases the pool.
+ */
+RBT_TEMPLATE_PARAMS
+void RBT_CLASS::clear_deferred() {
+  if (empty()) return;
+  if constexpr (alloc_traits::is_always_equal::value) {
+    std::function<void()> job = [alloc = node_allocator_,
+                                 root = get_root()]() mutable {
+      destroy_tree(alloc, root);
+    };
+    set_root(nullptr);
+    header_->left = header_;
+    header_->right = header_;
+    size_ = 0;
+    background_reclaimer::instance().submit(std::move(job));
+    return;
+  } else if constexpr (releasable_allocator<node_allocator_type>) {
+    if (node_allocator_.can_release()) {
+      // everything that can throw happens before the tree is touched
+      node_allocator_type fresh =
+          alloc_traits::select_on_container_copy_construction(
+              node_allocator_);
+      Node* header = allocate_node(fresh);
+      std::function<void()> job;
+      try {
+        job = [alloc = node_allocator_, old = header_]() mutable {
+          if constexpr (!std::is_trivially_destructible_v<Node>) {
+            destroy_tree(alloc, old->parent, false);
+            alloc_traits::destroy(alloc, old);
+          }
+          alloc.release();
+        };
+      } catch (...) {
+        free_node(fresh, header);
+        throw;
+      }
+      node_allocator_ = std::move(fresh);
+      header_ = header;
+      reset_header();
+      size_ = 0;
+      background_reclaimer::instance().submit(std::move(job));
+      return;
+    }
+  }
+  clear();
+}
+
+RBT_TEMPLATE_PARAMS
+template <std::input_iterator InputIt>
+void RBT_CLASS::assign(InputIt first, InputIt last) {
+  clear();
+  assign_range(first, last);
+}
+
 RBT_TEMPLATE_PARAMS
 std::pair<typename RBT_CLASS::iterator, bool> RBT_CLASS::insert(
     const value_type& value) {
-  return emplace(value);
+  return try_emplace(get_key(value), value);
 }
 
 RBT_TEMPLATE_PARAMS
 template <typename... Args>
 std::pair<typename RBT_CLASS::iterator, bool> RBT_CLASS::emplace(
     Args&&... args) {
+  // a ready element already carries its key: no node unless it is new
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same_v<std::remove_cvref_t<Args>, value_type> &&
+                 ...)) {
+    return try_emplace(get_key(args)..., std::forward<Args>(args)...);
+  } else {
+    Node* new_node = create_node(std::forward<Args>(args)...);
+    std::pair<iterator, bool> result = insert_node(new_node);
+    if (!result.second) {
+      destroy_node(new_node);
+    }
+    return result;
+  }
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::iterator RBT_CLASS::insert(const_iterator hint,
+                                               const value_type& value) {
+  return emplace_hint(hint, value);
+}
+
+RBT_TEMPLATE_PARAMS
+template <typename... Args>
+typename RBT_CLASS::iterator RBT_CLASS::emplace_hint(const_iterator hint,
+                                                     Args&&... args) {
   Node* new_node = create_node(std::forward<Args>(args)...);
+  std::pair<iterator, bool> result = insert_node(hint, new_node);
+  if (!result.second) {
+    destroy_node(new_node);
+  }
+  return result.first;
+}
+
+RBT_TEMPLATE_PARAMS
+template <typename Lookup, typename... Args>
+std::pair<typename RBT_CLASS::iterator, bool> RBT_CLASS::try_emplace(
+    const Lookup& key, Args&&... args) {
+  InsertPosition pos = find_insert_position(key);
+  if (pos.existing) {
+    return {iterator(pos.existing), false};
+  }
+  Node* new_node = create_node(std::forward<Args>(args)...);
+  link_node(new_node, pos.parent, pos.as_left);
+  return {iterator(new_node), true};
+}
+
+// Links an already constructed node; a duplicate key is left unlinked.
+RBT_TEMPLATE_PARAMS
+std::pair<typename RBT_CLASS::iterator, bool> RBT_CLASS::insert_node(
+    Node* new_node) {
+  InsertPosition pos = find_insert_position(get_key(new_node->data));
+  if (pos.existing) {
+    return {iterator(pos.existing), false};
+  }
+  link_node(new_node, pos.parent, pos.as_left);
+  return {iterator(new_node), true};
+}
+
+// Single descent; parent is header_ when the tree is empty. With MultiKeys
+// there is never an existing node: the descent ends past the equal keys.
+RBT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename RBT_CLASS::InsertPosition RBT_CLASS::find_insert_position(
+    const Lookup& key) const {
+  Node* current = get_root();
+  InsertPosition pos{header_, false, nullptr};
+  const key_prefix_type prefix = make_prefix(key);
+  while (current) {
+    pos.parent = current;
+    if constexpr (kMultiKeys) {
+      pos.as_left = key_less(key, prefix, current);
+      current = pos.as_left ? current->left : current->right;
+    } else if (key_less(key, prefix, current)) {
+      current = current->left;
+      pos.as_left = true;
+    } else if (node_less(current, key, prefix)) {
+      current = current->right;
+      pos.as_left = false;
+    } else {
+      pos.existing = current;
+      return pos;
+    }
+  }
+  return pos;
+}
+
+/*
+ * Hinted insertion: the node belongs right before 'hint'. When that holds
+ * (checked against hint and its predecessor, at most two comparisons) the
+ * node is linked next to hint without descending from the root, so a run
+ * of inserts at the right place costs amortized O(1) each. The common
+ * "append after the maximum" case with hint == end() is a single
+ * comparison against header_->right. A wrong hint falls back to the
+ * regular descent.
+ */
+RBT_TEMPLATE_PARAMS
+std::pair<typename RBT_CLASS::iterator, bool> RBT_CLASS::insert_node(
+    const_iterator hint, Node* new_node) {
+  Node* pos = const_cast<Node*>(hint.get_node());
   const key_type& key = get_key(new_node->data);
-  iterator result_it(new_node);
 
-  if (empty()) {
-    set_root(new_node);
-    size_++;
-    get_root()->set_black();
-  } else {
-    Node* current = get_root();
-    Node* parent = header_;
-    while (current) {
-      parent = current;
-      if (key_compare_(key, get_key(current->data))) {
-        current = current->left;
-      } else if (key_compare_(get_key(current->data), key)) {
-        current = current->right;
+  if constexpr (kMultiKeys) {
+    // equal keys may sit on either side: hint fits when the node's key is
+    // neither below its predecessor's nor above its own
+    if (pos == header_) {
+      if (!empty() && !key_compare_(key, get_key(header_->right->data))) {
+        link_node(new_node, header_->right, false);
+        return {iterator(new_node), true};
+      }
+      return insert_node(new_node);
+    }
+    if (key_compare_(get_key(pos->data), key)) return insert_node(new_node);
+    if (pos != header_->left) {
+      Node* before = pos->predecessor();
+      if (key_compare_(key, get_key(before->data))) {
+        return insert_node(new_node);
+      }
+      if (before->right == nullptr) {
+        link_node(new_node, before, false);
+        return {iterator(new_node), true};
+      }
+    }
+    link_node(new_node, pos, true);
+    return {iterator(new_node), true};
+  }
+
+  if (pos == header_) {
+    if (!empty() && key_compare_(get_key(header_->right->data), key)) {
+      link_node(new_node, header_->right, false);
+      return {iterator(new_node), true};
+    }
+    return insert_node(new_node);
+  }
+
+  if (key_compare_(key, get_key(pos->data))) {
+    if (pos == header_->left) {
+      link_node(new_node, pos, true);
+      return {iterator(new_node), true};
+    }
+    Node* before = pos->predecessor();
+    if (key_compare_(get_key(before->data), key)) {
+      // pos is the leftmost node of before's right subtree, if there is one
+      if (before->right == nullptr) {
+        link_node(new_node, before, false);
       } else {
-        destroy_node(new_node);
-        return {iterator(current), false};
+        link_node(new_node, pos, true);
       }
+      return {iterator(new_node), true};
     }
-    new_node->parent = parent;
-    if (key_compare_(key, get_key(parent->data))) {
-      parent->left = new_node;
-    } else {
-      parent->right = new_node;
+    return insert_node(new_node);
+  }
+
+  if (key_compare_(get_key(pos->data), key)) {
+    if (pos == header_->right) {
+      link_node(new_node, pos, false);
+      return {iterator(new_node), true};
     }
+    Node* after = pos->successor();
+    if (key_compare_(key, get_key(after->data))) {
+      if (pos->right == nullptr) {
+        link_node(new_node, pos, false);
+      } else {
+        link_node(new_node, after, true);
+      }
+      return {iterator(new_node), true};
+    }
+    return insert_node(new_node);
+  }
+
+  return {iterator(pos), false};
+}
+
+// Hangs a fresh red node under parent's empty slot (or makes it the root
+// of an empty tree when parent is header_) and rebalances.
+RBT_TEMPLATE_PARAMS
+void RBT_CLASS::link_node(Node* node, Node* parent, bool as_left) {
+  update_node(node);
+  if (parent == header_) {
+    set_root(node);
+    header_->left = node;
+    header_->right = node;
     size_++;
-    fix_insertion(new_node);
+    node->set_black();
+    return;
   }
-  header_->left = get_root()->minimum();
-  header_->right = get_root()->maximum();
-  return {result_it, true};
+  node->parent = parent;
+  if (as_left) {
+    parent->left = node;
+    if (parent == header_->left) header_->left = node;
+  } else {
+    parent->right = node;
+    if (parent == header_->right) header_->right = node;
+  }
+  size_++;
+  update_path(parent);
+  fix_insertion(node);
 }
 
 RBT_TEMPLATE_PARAMS
@@ -209,15 +522,98 @@ typename RBT_CLASS::iterator RBT_CLASS::erase(iterator pos) {
   if (pos == end() || empty()) {
     return end();
   }
+  Node* z = pos.get_node();
+  Node* next = unlink_node(z);
+  destroy_node(z);
+  return iterator(next);
+}
 
-  iterator next_it(pos);
-  ++next_it;
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::size_type RBT_CLASS::erase(const key_type& key) {
+  size_type erased = 0;
+  for (iterator it = find(key);
+       it != end() && !key_compare_(key, get_key(*it)); ++erased) {
+    it = erase(it);
+  }
+  return erased;
+}
 
-  Node* z = pos.get_node();
+// Unlinks the node and hands it over without touching the element.
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::node_type RBT_CLASS::extract(const_iterator pos) {
+  Node* node = const_cast<Node*>(pos.get_node());
+  unlink_node(node);
+  node->parent = nullptr;
+  node->left = nullptr;
+  node->right = nullptr;
+  return node_type(node, node_allocator_);
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::node_type RBT_CLASS::extract(const key_type& key) {
+  Node* node = find_node(key);
+  if (node == header_) return node_type();
+  return extract(const_iterator(node));
+}
+
+/*
+ * Links the handle's node when its key is new; otherwise the handle is
+ * returned untouched in the result. A node from an allocator this tree
+ * cannot free (see adopt_allocator) is not linked: its element is moved
+ * into a node of our own and the old node is freed by the handle. Any two
+ * trees on std::allocator pass nodes this way; trees on
+ * node_pool_allocator only when they share one pool, and then they must be
+ * used under one lock.
+ */
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::insert_return_type RBT_CLASS::insert(node_type&& handle) {
+  if (handle.empty()) return {end(), false, node_type()};
+  InsertPosition pos = find_insert_position(get_key(handle.node_->data));
+  if (pos.existing) {
+    return {iterator(pos.existing), false, std::move(handle)};
+  }
+  Node* node;
+  if (adopt_allocator(*handle.alloc_)) {
+    node = handle.release();
+    node->set_red();
+    set_key_prefix(node);  // key() may have been rewritten
+  } else {
+    node = create_node(std::move_if_noexcept(handle.node_->data));
+    handle.reset();
+  }
+  link_node(node, pos.parent, pos.as_left);
+  return {iterator(node), true, node_type()};
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::iterator RBT_CLASS::insert(const_iterator hint,
+                                               node_type&& handle) {
+  if (handle.empty()) return end();
+  if (!adopt_allocator(*handle.alloc_)) {
+    insert_return_type result = insert(std::move(handle));
+    if (!result.inserted) handle = std::move(result.node);
+    return result.position;
+  }
+  handle.node_->set_red();
+  set_key_prefix(handle.node_);
+  std::pair<iterator, bool> result = insert_node(hint, handle.node_);
+  if (result.second) handle.release();
+  return result.first;
+}
+
+// Takes z out of the tree and rebalances; z itself is left untouched.
+// Returns z's successor.
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::Node* RBT_CLASS::unlink_node(Node* z) {
+  Node* next = z->successor();
   Node* y = z;
   Node* x = nullptr;
   Node* x_parent = nullptr;
-  TreeNodeColor y_original_color = y->color;
+  TreeNodeColor y_original_color = y->get_color();
+
+  // the cached extremes move to z's in-order neighbours, which stay linked
+  if (z == header_->left) header_->left = next;
+  if (z == header_->right) header_->right = z->predecessor();
 
   if (z->left == nullptr) {
     x = z->right;
@@ -228,8 +624,8 @@ typename RBT_CLASS::iterator RBT_CLASS::erase(iterator pos) {
     x_parent = z->parent;
     transplant(z, z->left);
   } else {
-    y = z->right->minimum();
-    y_original_color = y->color;
+    y = next;  // the minimum of z's right subtree
+    y_original_color = y->get_color();
     x = y->right;
     if (y->parent == z) {
       x_parent = y;
@@ -242,24 +638,17 @@ typename RBT_CLASS::iterator RBT_CLASS::erase(iterator pos) {
     transplant(z, y);
     y->left = z->left;
     y->left->parent = y;
-    y->color = z->color;
+    y->set_color(z->get_color());
   }
 
-  destroy_node(z);
   size_--;
+  update_path(x_parent);
 
   if (y_original_color == TreeNodeColor::BLACK) {
     fix_deletion(x, x_parent);
   }
 
-  if (size_ > 0) {
-    header_->left = get_root()->minimum();
-    header_->right = get_root()->maximum();
-  } else {
-    header_->left = header_;
-    header_->right = header_;
-  }
-  return next_it;
+  return next;
 }
 
 RBT_TEMPLATE_PARAMS
@@ -273,57 +662,511 @@ void RBT_CLASS::swap(RBT_CLASS& other) noexcept {
   std::swap(key_compare_, other.key_compare_);
 }
 
+/*
+ * Moves every element of other whose key is not present here (every element
+ * with MultiKeys); the rest stay in other. Nodes are relinked, not copied,
+ * when the allocators are equal (see adopt_allocator). With m =
+ * other.size() much smaller than n the nodes are relinked one by one in
+ * O(m log n); otherwise both trees are flattened, merged as sorted chains
+ * and rebuilt balanced in O(n + m). With different allocators the values
+ * are moved into new nodes, in O(m log n).
+ */
 RBT_TEMPLATE_PARAMS
 void RBT_CLASS::merge(RBT_CLASS& other) {
-  if (this == &other) return;
-  for (auto it = other.begin(); it != other.end();) {
-    if (!contains(get_key(*it))) {
-      insert(*it);
-      it = other.erase(it);
+  if (this == &other || other.empty()) return;
+
+  if (!adopt_allocator(other.node_allocator_)) {
+    // nodes cannot change owner: move the values into new nodes
+    for (Node* node = other.header_->left; node != other.header_;) {
+      InsertPosition pos = find_insert_position(get_key(node->data));
+      if (pos.existing) {
+        node = node->successor();
+      } else {
+        Node* copy = create_node(std::move_if_noexcept(node->data));
+        Node* next = other.unlink_node(node);
+        other.destroy_node(node);
+        link_node(copy, pos.parent, pos.as_left);
+        node = next;
+      }
+    }
+    return;
+  }
+
+  size_type n = size_;
+  size_type m = other.size_;
+  if (m * static_cast<size_type>(std::bit_width(n + 1)) < n + m) {
+    for (Node* node = other.header_->left; node != other.header_;) {
+      InsertPosition pos = find_insert_position(get_key(node->data));
+      if (pos.existing) {
+        node = node->successor();
+      } else {
+        Node* next = other.unlink_node(node);
+        node->left = nullptr;
+        node->right = nullptr;
+        node->set_red();
+        link_node(node, pos.parent, pos.as_left);
+        node = next;
+      }
+    }
+    return;
+  }
+
+  NodeChain mine = detach_all();
+  NodeChain theirs = other.detach_all();
+  NodeChain kept;
+  NodeChain rejected;
+  auto append = [](NodeChain& chain, Node* node) {
+    if (chain.tail) {
+      chain.tail->right = node;
+    } else {
+      chain.head = node;
+    }
+    chain.tail = node;
+    ++chain.count;
+  };
+  Node* a = mine.head;
+  Node* b = theirs.head;
+  while (a && b) {
+    if (key_compare_(get_key(a->data), get_key(b->data))) {
+      append(kept, std::exchange(a, a->right));
+    } else if (key_compare_(get_key(b->data), get_key(a->data))) {
+      append(kept, std::exchange(b, b->right));
+    } else if constexpr (kMultiKeys) {
+      // ours first: other's elements go after the equal ones already here
+      append(kept, std::exchange(a, a->right));
+    } else {
+      append(kept, std::exchange(a, a->right));
+      append(rejected, std::exchange(b, b->right));
+    }
+  }
+  for (; a; a = a->right) append(kept, a);
+  for (; b; b = b->right) append(kept, b);
+  link_sorted_chain(kept);
+  other.link_sorted_chain(rejected);
+}
+
+/*
+ * The elements of a and b as a new tree with a's comparator, in O(n + m):
+ * one simultaneous in-order walk selects the elements (taken from a when
+ * both have the key) into a sorted chain of copies that is then built into
+ * a balanced tree.
+ */
+RBT_TEMPLATE_PARAMS
+RBT_CLASS RBT_CLASS::set_operation(SetOperation op, const RBT_CLASS& a,
+                                   const RBT_CLASS& b) {
+  RBT_CLASS result(a.key_compare_,
+                   alloc_traits::select_on_container_copy_construction(
+                       a.node_allocator_));
+  NodeChain chain;
+  try {
+    auto append = [&result, &chain](const value_type& value) {
+      Node* node = result.create_node(value);
+      if (chain.tail) {
+        chain.tail->right = node;
+      } else {
+        chain.head = node;
+      }
+      chain.tail = node;
+      ++chain.count;
+    };
+    const_iterator i = a.begin();
+    const_iterator j = b.begin();
+    const Cmp& compare = a.key_compare_;
+    while (i != a.end() && j != b.end()) {
+      if (compare(a.get_key(*i), a.get_key(*j))) {
+        if (op != SetOperation::kIntersection) append(*i);
+        ++i;
+      } else if (compare(a.get_key(*j), a.get_key(*i))) {
+        if (op == SetOperation::kUnion) append(*j);
+        ++j;
+      } else {
+        if (op != SetOperation::kDifference) append(*i);
+        ++i;
+        ++j;
+      }
+    }
+    if (op != SetOperation::kIntersection) {
+      for (; i != a.end(); ++i) append(*i);
+    }
+    if (op == SetOperation::kUnion) {
+      for (; j != b.end(); ++j) append(*j);
+    }
+  } catch (...) {
+    result.destroy_chain(chain.head);
+    throw;
+  }
+  result.link_sorted_chain(chain);
+  return result;
+}
+
+/*
+ * Whether nodes allocated by other can be freed by this tree's allocator,
+ * i.e. whether the allocators are equal. Taking over the memory of a live
+ * container's pool (node_pool_allocator::absorb) is not an option: that
+ * container keeps its header and its other nodes in the memory it gave up.
+ */
+RBT_TEMPLATE_PARAMS
+bool RBT_CLASS::adopt_allocator(const node_allocator_type& other) const {
+  if constexpr (alloc_traits::is_always_equal::value) {
+    return true;
+  } else {
+    return node_allocator_ == other;
+  }
+}
+
+// Empties the tree and returns its nodes as a sorted chain. Right
+// rotations turn the tree into a vine, so no recursion or stack is needed.
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::NodeChain RBT_CLASS::detach_all() {
+  NodeChain chain;
+  Node* node = get_root();
+  while (node) {
+    if (node->left) {
+      Node* left = node->left;
+      node->left = left->right;
+      left->right = node;
+      node = left;
     } else {
-      ++it;
+      if (chain.tail) {
+        chain.tail->right = node;
+      } else {
+        chain.head = node;
+      }
+      chain.tail = node;
+      ++chain.count;
+      node = node->right;
     }
   }
+  if (chain.tail) chain.tail->right = nullptr;
+  set_root(nullptr);
+  header_->left = header_;
+  header_->right = header_;
+  size_ = 0;
+  return chain;
 }
 
 RBT_TEMPLATE_PARAMS
 typename RBT_CLASS::iterator RBT_CLASS::find(const key_type& key) {
+  return iterator(find_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::const_iterator RBT_CLASS::find(const key_type& key) const {
+  return const_iterator(find_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+bool RBT_CLASS::contains(const key_type& key) const {
+  return find_node(key) != header_;
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::size_type RBT_CLASS::count(const key_type& key) const {
+  if constexpr (kMultiKeys) {
+    auto [first, last] = equal_range(key);
+    return static_cast<size_type>(std::distance(first, last));
+  }
+  return contains(key) ? 1 : 0;
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::iterator RBT_CLASS::lower_bound(const key_type& key) {
+  return iterator(lower_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::const_iterator RBT_CLASS::lower_bound(
+    const key_type& key) const {
+  return const_iterator(lower_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::iterator RBT_CLASS::upper_bound(const key_type& key) {
+  return iterator(upper_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::const_iterator RBT_CLASS::upper_bound(
+    const key_type& key) const {
+  return const_iterator(upper_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+std::pair<typename RBT_CLASS::iterator, typename RBT_CLASS::iterator>
+RBT_CLASS::equal_range(const key_type& key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+RBT_TEMPLATE_PARAMS
+std::pair<typename RBT_CLASS::const_iterator,
+          typename RBT_CLASS::const_iterator>
+RBT_CLASS::equal_range(const key_type& key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+/*
+ * Elements with lo <= key < hi as a view over the tree's own iterators:
+ * two O(log n) descents, then each step of the iteration is an ordinary
+ * iterator increment. Empty when hi is not greater than lo.
+ */
+RBT_TEMPLATE_PARAMS
+std::ranges::subrange<typename RBT_CLASS::iterator> RBT_CLASS::range(
+    const key_type& lo, const key_type& hi) {
+  iterator first = lower_bound(lo);
+  if (!key_compare_(lo, hi)) return {first, first};
+  return {first, lower_bound(hi)};
+}
+
+RBT_TEMPLATE_PARAMS
+std::ranges::subrange<typename RBT_CLASS::const_iterator> RBT_CLASS::range(
+    const key_type& lo, const key_type& hi) const {
+  const_iterator first = lower_bound(lo);
+  if (!key_compare_(lo, hi)) return {first, first};
+  return {first, lower_bound(hi)};
+}
+
+#define RBT_TRANSPARENT  \
+  template <typename Lookup> \
+    requires transparent_comparator<Cmp>
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::iterator RBT_CLASS::find(const Lookup& key) {
+  return iterator(find_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::const_iterator RBT_CLASS::find(const Lookup& key) const {
+  return const_iterator(find_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+bool RBT_CLASS::contains(const Lookup& key) const {
+  return find_node(key) != header_;
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::size_type RBT_CLASS::count(const Lookup& key) const {
+  if constexpr (kMultiKeys) {
+    auto [first, last] = equal_range(key);
+    return static_cast<size_type>(std::distance(first, last));
+  }
+  return contains(key) ? 1 : 0;
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::iterator RBT_CLASS::lower_bound(const Lookup& key) {
+  return iterator(lower_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::const_iterator RBT_CLASS::lower_bound(
+    const Lookup& key) const {
+  return const_iterator(lower_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::iterator RBT_CLASS::upper_bound(const Lookup& key) {
+  return iterator(upper_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+typename RBT_CLASS::const_iterator RBT_CLASS::upper_bound(
+    const Lookup& key) const {
+  return const_iterator(upper_bound_node(key));
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+std::pair<typename RBT_CLASS::iterator, typename RBT_CLASS::iterator>
+RBT_CLASS::equal_range(const Lookup& key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+RBT_TEMPLATE_PARAMS
+RBT_TRANSPARENT
+std::pair<typename RBT_CLASS::const_iterator,
+          typename RBT_CLASS::const_iterator>
+RBT_CLASS::equal_range(const Lookup& key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+#undef RBT_TRANSPARENT
+
+// --- ORDER STATISTICS ---
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::size_type RBT_CLASS::rank(const key_type& key) const
+  requires counting_augmentation<Aug>
+{
+  size_type rank = 0;
+  for (Node* node = get_root(); node;) {
+    if (key_compare_(get_key(node->data), key)) {
+      rank += Aug::size(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return rank;
+}
+
+RBT_TEMPLATE_PARAMS
+const typename RBT_CLASS::key_type& RBT_CLASS::select(size_type k) const
+  requires counting_augmentation<Aug>
+{
+  if (k >= size_) {
+    throw std::out_of_range("RedBlackTree::select: index out of range");
+  }
+  return get_key(nth_node(k)->data);
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::iterator RBT_CLASS::nth(size_type k)
+  requires counting_augmentation<Aug>
+{
+  return iterator(nth_node(k));
+}
+
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::const_iterator RBT_CLASS::nth(size_type k) const
+  requires counting_augmentation<Aug>
+{
+  return const_iterator(nth_node(k));
+}
+
+// The k-th smallest node (0-based), header_ when k >= size_.
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::Node* RBT_CLASS::nth_node(size_type k) const
+  requires counting_augmentation<Aug>
+{
+  if (k >= size_) return header_;
+  Node* node = get_root();
+  while (true) {
+    size_type left_size = Aug::size(node->left);
+    if (k < left_size) {
+      node = node->left;
+    } else if (k == left_size) {
+      return node;
+    } else {
+      k -= left_size + 1;
+      node = node->right;
+    }
+  }
+}
+
+/*
+ * Descends to the highest node inside [lo, hi), then walks down both of its
+ * sides: every node on the left path with a key >= lo contributes itself
+ * and its whole right subtree, every node on the right path with a key < hi
+ * contributes its whole left subtree and itself. Both walks prepend or
+ * append in key order, so the monoid need not be commutative.
+ */
+RBT_TEMPLATE_PARAMS
+auto RBT_CLASS::aggregate(const key_type& lo, const key_type& hi) const
+  requires aggregating_augmentation<Aug>
+{
+  using Monoid = typename Aug::monoid_type;
+  typename Aug::result_type result = Monoid::identity();
+  if (!key_compare_(lo, hi)) return result;
+
+  Node* split = get_root();
+  while (split) {
+    if (key_compare_(get_key(split->data), lo)) {
+      split = split->right;
+    } else if (!key_compare_(get_key(split->data), hi)) {
+      split = split->left;
+    } else {
+      break;
+    }
+  }
+  if (!split) return result;
+
+  for (Node* node = split->left; node;) {
+    if (key_compare_(get_key(node->data), lo)) {
+      node = node->right;
+    } else {
+      result = Monoid::combine(
+          Monoid::combine(Monoid::lift(node->data), Aug::value(node->right)),
+          result);
+      node = node->left;
+    }
+  }
+  result = Monoid::combine(result, Monoid::lift(split->data));
+  for (Node* node = split->right; node;) {
+    if (key_compare_(get_key(node->data), hi)) {
+      result = Monoid::combine(
+          result,
+          Monoid::combine(Aug::value(node->left), Monoid::lift(node->data)));
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+// The node holding an equivalent key, header_ if there is none.
+RBT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename RBT_CLASS::Node* RBT_CLASS::find_node(const Lookup& key) const {
+  Node* node = lower_bound_node(key);
+  if (node != header_ && key_compare_(key, get_key(node->data))) {
+    return header_;
+  }
+  return node;
+}
+
+// First node whose key is not less than key, header_ if there is none.
+RBT_TEMPLATE_PARAMS
+template <typename Lookup>
+typename RBT_CLASS::Node* RBT_CLASS::lower_bound_node(const Lookup& key) const {
   Node* current = get_root();
+  Node* result = header_;
+  const key_prefix_type prefix = make_prefix(key);
   while (current) {
-    if (key_compare_(key, get_key(current->data))) {
-      current = current->left;
-    } else if (key_compare_(get_key(current->data), key)) {
+    if (node_less(current, key, prefix)) {
       current = current->right;
     } else {
-      return iterator(current);
+      result = current;
+      current = current->left;
     }
   }
-  return end();
+  return result;
 }
 
+// First node whose key is greater than key, header_ if there is none.
 RBT_TEMPLATE_PARAMS
-typename RBT_CLASS::const_iterator RBT_CLASS::find(const key_type& key) const {
+template <typename Lookup>
+typename RBT_CLASS::Node* RBT_CLASS::upper_bound_node(const Lookup& key) const {
   Node* current = get_root();
+  Node* result = header_;
+  const key_prefix_type prefix = make_prefix(key);
   while (current) {
-    if (key_compare_(key, get_key(current->data))) {
+    if (key_less(key, prefix, current)) {
+      result = current;
       current = current->left;
-    } else if (key_compare_(get_key(current->data), key)) {
-      current = current->right;
     } else {
-      return const_iterator(current);
+      current = current->right;
     }
   }
-  return end();
+  return result;
 }
 
 RBT_TEMPLATE_PARAMS
-bool RBT_CLASS::contains(const key_type& key) const {
-  return find(key) != end();
+void RBT_CLASS::init_header() {
+  header_ = create_node();
+  reset_header();
 }
 
 RBT_TEMPLATE_PARAMS
-void RBT_CLASS::init_header() {
-  header_ = create_node();
+void RBT_CLASS::reset_header() noexcept {
   header_->parent = nullptr;
   header_->left = header_;
   header_->right = header_;
@@ -331,43 +1174,367 @@ void RBT_CLASS::init_header() {
 
 RBT_TEMPLATE_PARAMS
 template <typename... Args>
-typename RBT_CLASS::Node* RBT_CLASS::create_node(Args&&... args) {
-  Node* node = alloc_traits::allocate(node_allocator_, 1);
+typename RBT_CLASS::Node* RBT_CLASS::allocate_node(node_allocator_type& alloc,
+                                                   Args&&... args) {
+  Node* node = alloc_traits::allocate(alloc, 1);
   try {
-    alloc_traits::construct(node_allocator_, node, std::forward<Args>(args)...);
+    alloc_traits::construct(alloc, node, std::forward<Args>(args)...);
   } catch (...) {
-    alloc_traits::deallocate(node_allocator_, node, 1);
+    alloc_traits::deallocate(alloc, node, 1);
     throw;
   }
+  set_key_prefix(node);
   return node;
 }
 
 RBT_TEMPLATE_PARAMS
-void RBT_CLASS::destroy_node(Node* node) {
+void RBT_CLASS::free_node(node_allocator_type& alloc, Node* node) {
   if (node) {
-    alloc_traits::destroy(node_allocator_, node);
-    alloc_traits::deallocate(node_allocator_, node, 1);
+    alloc_traits::destroy(alloc, node);
+    alloc_traits::deallocate(alloc, node, 1);
   }
 }
 
+/*
+ * Destroys (and without free_memory only destroys, leaving the memory to a
+ * pool release) every node of the subtree. Right rotations flatten it into
+ * a vine while it is consumed: no recursion, no stack, and no destroyed
+ * node is ever read again.
+ */
 RBT_TEMPLATE_PARAMS
-void RBT_CLASS::destroy_tree(Node* node) {
-  if (node) {
-    destroy_tree(node->left);
-    destroy_tree(node->right);
-    destroy_node(node);
+void RBT_CLASS::destroy_tree(node_allocator_type& alloc, Node* node,
+                             bool free_memory) {
+  while (node) {
+    if (node->left) {
+      Node* left = node->left;
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      Node* next = node->right;
+      if (free_memory) {
+        free_node(alloc, node);
+      } else {
+        alloc_traits::destroy(alloc, node);
+      }
+      node = next;
+    }
   }
 }
 
+/*
+ * Drops all nodes, the header included, by releasing the allocator's pool
+ * instead of deallocating node by node. Only possible when the allocator
+ * supports it and no one else shares its pool; values are still destroyed
+ * unless that is a no-op. Returns false (and changes nothing) otherwise.
+ * The caller must reset header_ if the tree stays alive.
+ */
 RBT_TEMPLATE_PARAMS
-typename RBT_CLASS::Node* RBT_CLASS::copy_tree(Node* other_node, Node* parent) {
-  if (!other_node) return nullptr;
-  Node* new_node = create_node(other_node->data);
-  new_node->color = other_node->color;
-  new_node->parent = parent;
-  new_node->left = copy_tree(other_node->left, new_node);
-  new_node->right = copy_tree(other_node->right, new_node);
-  return new_node;
+bool RBT_CLASS::release_nodes() {
+  if constexpr (releasable_allocator<node_allocator_type>) {
+    if (!node_allocator_.can_release()) return false;
+    if constexpr (!std::is_trivially_destructible_v<Node>) {
+      destroy_tree(node_allocator_, get_root(), false);
+      alloc_traits::destroy(node_allocator_, header_);
+    }
+    node_allocator_.release();
+    header_ = nullptr;
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/*
+ * Copies the subtree in preorder without recursion: the walk climbs back
+ * through the parent links of both trees in step. A child slot of the copy
+ * that is still empty while the source has a child there is the next place
+ * to descend. On an exception the partial copy (always a valid tree) is
+ * freed again.
+ */
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::Node* RBT_CLASS::copy_tree(node_allocator_type& alloc,
+                                               const Node* source,
+                                               Node* parent) {
+  if (!source) return nullptr;
+  auto clone = [&alloc](const Node* from, Node* to_parent) {
+    Node* node = allocate_node(alloc, from->data);
+    node->set_color(from->get_color());
+    node->augment = from->augment;
+    node->parent = to_parent;
+    return node;
+  };
+  Node* root = clone(source, parent);
+  try {
+    const Node* from = source;
+    Node* to = root;
+    while (true) {
+      if (from->left && !to->left) {
+        to->left = clone(from->left, to);
+        from = from->left;
+        to = to->left;
+      } else if (from->right && !to->right) {
+        to->right = clone(from->right, to);
+        from = from->right;
+        to = to->right;
+      } else if (from == source) {
+        break;
+      } else {
+        from = from->parent;
+        to = to->parent;
+      }
+    }
+  } catch (...) {
+    destroy_tree(alloc, root);
+    throw;
+  }
+  return root;
+}
+
+/*
+ * The top levels of the source are copied here until there are at least
+ * as many subtrees below them as threads; those subtrees are dealt out to
+ * the threads round-robin. Every worker allocates from its own fresh
+ * allocator, which the tree's allocator absorbs after the join (a stateless
+ * allocator needs nothing). A worker's subtree that cannot be absorbed is
+ * freed and copied again here.
+ */
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::Node* RBT_CLASS::copy_tree_parallel(const Node* source,
+                                                        size_type count,
+                                                        unsigned threads) {
+  constexpr bool kCanFork =
+      alloc_traits::is_always_equal::value ||
+      requires(node_allocator_type& a) { a.absorb(a); };
+  if (threads == 0) threads = std::thread::hardware_concurrency();
+  size_type tasks = std::min<size_type>(threads, count / kParallelCopyGrain);
+  if (!kCanFork || tasks <= 1) {
+    return copy_tree(node_allocator_, source, header_);
+  }
+
+  struct Slot {
+    const Node* source;
+    Node* parent;
+    bool as_left;
+    Node* copy = nullptr;
+    node_allocator_type* owner = nullptr;  // allocated 'copy'
+  };
+  size_type depth = std::bit_width(tasks - 1);
+  Node* root = nullptr;
+  std::vector<Slot> slots;
+  std::vector<node_allocator_type> allocators;
+  auto release_all = [&] {
+    for (const Slot& slot : slots) {
+      if (slot.copy) destroy_tree(*slot.owner, slot.copy);
+    }
+    destroy_tree(node_allocator_, root);
+  };
+
+  try {
+    // breadth-first copy of the levels above 'depth'
+    root = allocate_node(node_allocator_, source->data);
+    root->set_color(source->get_color());
+    root->augment = source->augment;
+    root->parent = header_;
+    std::vector<std::pair<const Node*, Node*>> level = {{source, root}};
+    for (size_type d = 1; d <= depth; ++d) {
+      std::vector<std::pair<const Node*, Node*>> next;
+      for (auto [from, to] : level) {
+        for (bool as_left : {true, false}) {
+          const Node* child = as_left ? from->left : from->right;
+          if (!child) continue;
+          if (d == depth) {
+            slots.push_back({child, to, as_left});
+            continue;
+          }
+          Node* node = allocate_node(node_allocator_, child->data);
+          node->set_color(child->get_color());
+          node->augment = child->augment;
+          node->parent = to;
+          (as_left ? to->left : to->right) = node;
+          next.emplace_back(child, node);
+        }
+      }
+      level = std::move(next);
+    }
+
+    for (size_type i = 1; i < tasks; ++i) {
+      allocators.push_back(
+          alloc_traits::select_on_container_copy_construction(
+              node_allocator_));
+    }
+    std::vector<std::exception_ptr> errors(tasks);
+    auto work = [&slots, &errors, tasks](size_type t,
+                                         node_allocator_type& alloc) {
+      try {
+        for (size_type i = t; i < slots.size(); i += tasks) {
+          slots[i].copy = copy_tree(alloc, slots[i].source, slots[i].parent);
+          slots[i].owner = &alloc;
+        }
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    };
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(tasks - 1);
+      for (size_type t = 1; t < tasks; ++t) {
+        workers.emplace_back(work, t, std::ref(allocators[t - 1]));
+      }
+      work(0, node_allocator_);
+    }
+    for (const std::exception_ptr& error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+
+    if constexpr (!alloc_traits::is_always_equal::value) {
+      for (size_type t = 1; t < tasks; ++t) {
+        if (node_allocator_.absorb(allocators[t - 1])) {
+          // the worker's nodes now belong to the tree's allocator
+          for (size_type i = t; i < slots.size(); i += tasks) {
+            slots[i].owner = &node_allocator_;
+          }
+          continue;
+        }
+        for (size_type i = t; i < slots.size(); i += tasks) {
+          destroy_tree(allocators[t - 1], slots[i].copy);
+          slots[i].copy = nullptr;
+          slots[i].copy =
+              copy_tree(node_allocator_, slots[i].source, slots[i].parent);
+          slots[i].owner = &node_allocator_;
+        }
+      }
+    }
+  } catch (...) {
+    release_all();
+    throw;
+  }
+  for (const Slot& slot : slots) {
+    (slot.as_left ? slot.parent->left : slot.parent->right) = slot.copy;
+  }
+  return root;
+}
+
+/*
+ * Fills an empty tree from [first, last) in a single pass. Every element
+ * becomes a node in a chain linked through 'right' while the keys are
+ * checked for strictly ascending order (ascending with MultiKeys). Sorted
+ * input is then turned into a balanced tree in O(n) without any rotations;
+ * otherwise the chained nodes are inserted one by one (no second
+ * allocation) and duplicates dropped.
+ */
+RBT_TEMPLATE_PARAMS
+template <typename It, typename Sent>
+void RBT_CLASS::assign_range(It first, Sent last) {
+  NodeChain chain = make_chain(first, last, true);
+  if (chain.sorted) {
+    link_sorted_chain(chain);
+  } else {
+    Node* node = chain.head;
+    while (node) {
+      Node* next = node->right;
+      node->right = nullptr;
+      if (!insert_node(node).second) {
+        destroy_node(node);
+      }
+      node = next;
+    }
+  }
+}
+
+RBT_TEMPLATE_PARAMS
+template <typename It, typename Sent>
+void RBT_CLASS::assign_sorted(It first, Sent last) {
+#ifdef NDEBUG
+  NodeChain chain = make_chain(first, last, false);
+#else
+  NodeChain chain = make_chain(first, last, true);
+  if (!chain.sorted) {
+    destroy_chain(chain.head);
+    throw std::invalid_argument(
+        "RedBlackTree: sorted_unique input is not strictly ascending");
+  }
+#endif
+  link_sorted_chain(chain);
+}
+
+// Creates a node per element; on an exception the partial chain is freed.
+RBT_TEMPLATE_PARAMS
+template <typename It, typename Sent>
+typename RBT_CLASS::NodeChain RBT_CLASS::make_chain(It first, Sent last,
+                                                    bool check_order) {
+  NodeChain chain;
+  try {
+    for (; first != last; ++first, ++chain.count) {
+      Node* node = create_node(*first);
+      if (chain.tail) {
+        if (check_order && chain.sorted) {
+          if constexpr (kMultiKeys) {
+            chain.sorted = !key_compare_(get_key(node->data),
+                                         get_key(chain.tail->data));
+          } else {
+            chain.sorted = key_compare_(get_key(chain.tail->data),
+                                        get_key(node->data));
+          }
+        }
+        chain.tail->right = node;
+      } else {
+        chain.head = node;
+      }
+      chain.tail = node;
+    }
+  } catch (...) {
+    destroy_chain(chain.head);
+    throw;
+  }
+  return chain;
+}
+
+RBT_TEMPLATE_PARAMS
+void RBT_CLASS::destroy_chain(Node* head) {
+  while (head) {
+    Node* next = head->right;
+    destroy_node(head);
+    head = next;
+  }
+}
+
+// Turns an ascending chain (strictly, unless MultiKeys) into the whole
+// (empty) tree.
+RBT_TEMPLATE_PARAMS
+void RBT_CLASS::link_sorted_chain(const NodeChain& chain) {
+  if (chain.count == 0) return;
+  Node* cursor = chain.head;
+  // the last, incomplete level is red, everything above it black
+  size_type red_depth = std::bit_width(chain.count + 1) - 1;
+  set_root(build_balanced(cursor, chain.count, 0, red_depth));
+  size_ = chain.count;
+  header_->left = chain.head;
+  header_->right = chain.tail;
+}
+
+// Consumes n nodes of the chain in order and returns the subtree root.
+RBT_TEMPLATE_PARAMS
+typename RBT_CLASS::Node* RBT_CLASS::build_balanced(Node*& cursor, size_type n,
+                                                    size_type depth,
+                                                    size_type red_depth) {
+  if (n == 0) return nullptr;
+  size_type left_size = (n - 1) / 2;
+  Node* left = build_balanced(cursor, left_size, depth + 1, red_depth);
+  Node* node = cursor;
+  cursor = cursor->right;
+  node->left = left;
+  if (left) left->parent = node;
+  Node* right = build_balanced(cursor, n - 1 - left_size, depth + 1, red_depth);
+  node->right = right;
+  if (right) right->parent = node;
+  update_node(node);
+  if (depth == red_depth) {
+    node->set_red();
+  } else {
+    node->set_black();
+  }
+  return node;
 }
 
 RBT_TEMPLATE_PARAMS
@@ -385,6 +1552,8 @@ void RBT_CLASS::rotate_left(Node* x) {
   }
   y->left = x;
   x->parent = y;
+  update_node(x);
+  update_node(y);
 }
 
 /*
@@ -431,6 +1600,8 @@ void RBT_CLASS::rotate_right(Node* y) {
   }
   x->right = y;
   y->parent = x;
+  update_node(y);
+  update_node(x);
 }
 
 RBT_TEMPLATE_PARAMS
@@ -506,7 +1677,7 @@ void RBT_CLASS::fix_deletion(Node* x, Node* x_parent) {
           rotate_right(w);
           w = x_parent->right;
         }
-        w->color = x_parent->color;
+        w->set_color(x_parent->get_color());
         x_parent->set_black();
         if (w->right) w->right->set_black();
         rotate_left(x_parent);
@@ -532,7 +1703,7 @@ void RBT_CLASS::fix_deletion(Node* x, Node* x_parent) {
           rotate_left(w);
           w = x_parent->left;
         }
-        w->color = x_parent->color;
+        w->set_color(x_parent->get_color());
         x_parent->set_black();
         if (w->left) w->left->set_black();
         rotate_right(x_parent);
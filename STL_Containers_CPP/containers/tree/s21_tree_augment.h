@@ -0,0 +1,141 @@
+#ifndef S21_TREE_AUGMENT_H_
+#define S21_TREE_AUGMENT_H_
+
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+
+/*
+ * From <concepts>:
+ *  std::convertible_to: Used by the counting_augmentation concept.
+ *  std::same_as: SubtreeMaxEnd requires EndOf to return a const End&.
+ *
+ * From <cstddef>:
+ *  std::size_t: The type of the subtree sizes.
+ *
+ * From <initializer_list>:
+ *  std::initializer_list: SubtreeMaxEnd loops over both children.
+ */
+
+namespace s21 {
+
+/*
+ * Augmentation policies for RedBlackTree. A policy decides what every node
+ * stores about its own subtree ('node_data', kept in TreeNode::augment) and
+ * how update(node) recomputes it from the node's element and its children.
+ * The tree calls update() bottom-up wherever a subtree changes shape: on
+ * the path above a linked or unlinked node, in rotations and while building
+ * from sorted input. Recolorings do not touch it.
+ */
+
+// The default: no extra storage and no bookkeeping.
+struct NoAugmentation {
+  struct node_data {};
+
+  template <typename Node>
+  static void update(Node*) noexcept {}
+};
+
+// Subtree sizes; enables rank(), select() and nth() in O(log n).
+struct SubtreeSize {
+  struct node_data {
+    std::size_t size = 1;
+  };
+
+  template <typename Node>
+  static std::size_t size(const Node* node) noexcept {
+    return node ? node->augment.size : 0;
+  }
+
+  template <typename Node>
+  static void update(Node* node) noexcept {
+    node->augment.size = 1 + size(node->left) + size(node->right);
+  }
+};
+
+/*
+ * Subtree sizes plus a monoid folded over each subtree in key order;
+ * enables aggregate(lo, hi) in O(log n) on top of SubtreeSize's queries.
+ * The monoid does not need to be commutative. It provides:
+ *
+ *   using result_type = ...;
+ *   static result_type identity();
+ *   static result_type combine(const result_type& a, const result_type& b);
+ *   static result_type lift(const value_type& element);
+ *
+ * where value_type is the tree's element (a pair for maps).
+ */
+template <typename Monoid>
+struct SubtreeAggregate {
+  using monoid_type = Monoid;
+  using result_type = typename Monoid::result_type;
+
+  struct node_data {
+    std::size_t size = 1;
+    result_type value = Monoid::identity();
+  };
+
+  template <typename Node>
+  static std::size_t size(const Node* node) noexcept {
+    return node ? node->augment.size : 0;
+  }
+
+  template <typename Node>
+  static result_type value(const Node* node) {
+    return node ? node->augment.value : Monoid::identity();
+  }
+
+  template <typename Node>
+  static void update(Node* node) {
+    node->augment.size = 1 + size(node->left) + size(node->right);
+    node->augment.value = Monoid::combine(
+        Monoid::combine(value(node->left), Monoid::lift(node->data)),
+        value(node->right));
+  }
+};
+
+/*
+ * The largest interval end in each subtree, for trees of intervals ordered
+ * by their start (see interval_map): a subtree whose max_end is not past a
+ * query's start holds nothing that overlaps it. EndOf is a stateless
+ * functor that returns a const End& to an end stored in the element (not
+ * a computed temporary: update() keeps a pointer to it while it scans the
+ * children); Compare orders the ends.
+ */
+template <typename End, typename EndOf, typename Compare>
+struct SubtreeMaxEnd {
+  using end_type = End;
+
+  struct node_data {
+    End max_end{};
+  };
+
+  template <typename Node>
+    requires requires(const Node& n) {
+      { EndOf{}(n.data) } -> std::same_as<const End&>;
+    }
+  static void update(Node* node) {
+    const End* max_end = &EndOf{}(node->data);
+    for (const Node* child : {node->left, node->right}) {
+      if (child && Compare{}(*max_end, child->augment.max_end)) {
+        max_end = &child->augment.max_end;
+      }
+    }
+    node->augment.max_end = *max_end;
+  }
+};
+
+// Policies that keep subtree sizes.
+template <typename A>
+concept counting_augmentation = requires(typename A::node_data d) {
+  { d.size } -> std::convertible_to<std::size_t>;
+};
+
+// Policies that keep a monoid aggregate.
+template <typename A>
+concept aggregating_augmentation =
+    counting_augmentation<A> && requires { typename A::monoid_type; };
+
+}  // namespace s21
+
+#endif  // S21_TREE_AUGMENT_H_
@@ -0,0 +1,105 @@
+#ifndef S21_TREE_KEY_PREFIX_H_
+#define S21_TREE_KEY_PREFIX_H_
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * From <algorithm>:
+ *  std::min: The number of key bytes that fit in the prefix.
+ *
+ * From <bit>:
+ *  std::endian: Whether the words must be byte-swapped to big-endian.
+ *
+ * From <concepts>, <type_traits>:
+ *  std::convertible_to, std::is_same_v: Which keys and comparators the
+ *    prefix orders like (kOrdersLike).
+ *
+ * From <cstddef>:
+ *  std::size_t: The prefix width.
+ *
+ * From <cstdint>, <cstring>:
+ *  std::uint64_t, std::memcpy: The prefix is loaded as 64-bit words.
+ *
+ * From <functional>:
+ *  std::less: The only comparators the prefix agrees with.
+ *
+ * From <string_view>:
+ *  std::string_view: Every key and lookup is read through one.
+ */
+
+namespace s21 {
+
+/*
+ * Key prefix policies for RedBlackTree. A policy decides what every node
+ * caches about its own key ('node_data', kept in TreeNode::key_prefix, set
+ * once when the node is created) and how make()/compare() order two keys
+ * by that cache alone. The lookup descents (find, lower_bound, upper_bound
+ * and the insert position) compute the prefix of the key they look for
+ * once and only compare full keys when the prefixes tie.
+ */
+
+// The default: no extra storage, every comparison uses the full keys.
+struct NoKeyPrefix {
+  struct node_data {};
+
+  template <typename Key, typename Compare>
+  static constexpr bool kOrdersLike = true;
+};
+
+/*
+ * The first Bytes bytes of a string key, zero-padded and stored as
+ * big-endian 64-bit words, so that comparing the words compares the bytes.
+ * The zero padding sorts a short key before the longer keys it starts, so
+ * two keys whose prefixes differ order like their prefixes, and the tree
+ * only reads the node's string, usually a heap buffer, on a tie:
+ * keys that share their first Bytes bytes or differ only in trailing NULs.
+ * Valid for std::less over string-like keys.
+ */
+template <std::size_t Bytes = 16>
+  requires(Bytes == 8 || Bytes == 16)
+struct StringKeyPrefix {
+  static constexpr std::size_t kWords = Bytes / 8;
+
+  struct node_data {
+    std::uint64_t words[kWords] = {};
+  };
+
+  template <typename Key, typename Compare>
+  static constexpr bool kOrdersLike =
+      std::convertible_to<const Key&, std::string_view> &&
+      (std::is_same_v<Compare, std::less<Key>> ||
+       std::is_same_v<Compare, std::less<>>);
+
+  static node_data make(std::string_view key) noexcept {
+    unsigned char bytes[Bytes] = {};
+    std::memcpy(bytes, key.data(), std::min(key.size(), Bytes));
+    node_data prefix;
+    for (std::size_t i = 0; i < kWords; ++i) {
+      std::memcpy(&prefix.words[i], bytes + i * 8, 8);
+      if constexpr (std::endian::native == std::endian::little) {
+        prefix.words[i] = __builtin_bswap64(prefix.words[i]);
+      }
+    }
+    return prefix;
+  }
+
+  // Negative, zero (a tie: the full keys decide) or positive.
+  static int compare(const node_data& a, const node_data& b) noexcept {
+    for (std::size_t i = 0; i < kWords; ++i) {
+      if (a.words[i] != b.words[i]) return a.words[i] < b.words[i] ? -1 : 1;
+    }
+    return 0;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_TREE_KEY_PREFIX_H_
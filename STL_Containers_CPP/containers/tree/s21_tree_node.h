@@ -4,6 +4,10 @@
 #include <type_traits>  // Used for compile-time type checking.
 #include <utility>      // Used for utility functions.
 
+#include "s21_tree_augment.h"
+#include "s21_tree_key_prefix.h"
+#include "s21_tree_node_links.h"
+
 /*
  * Functions used from <type_traits>:
  * std::is_same_v: Checks if two types are the same.
@@ -21,39 +25,55 @@
 
 namespace s21 {
 
-enum class TreeNodeColor { RED, BLACK };
-
-template <typename T>
-struct TreeNode {
+// Augment adds per-subtree data (see s21_tree_augment.h); the default
+// NoAugmentation takes no space. Links picks how parent/left/right and the
+// color are stored (see s21_tree_node_links.h). KeyPrefix caches the start
+// of the key next to the links (see s21_tree_key_prefix.h); the default
+// NoKeyPrefix takes no space.
+template <typename T, typename Augment = NoAugmentation,
+          typename Links = PointerLinks, typename KeyPrefix = NoKeyPrefix>
+struct TreeNode
+    : TreeNodeLinks<TreeNode<T, Augment, Links, KeyPrefix>, Links> {
   using value_type = T;
   using pointer = TreeNode*;
   using const_pointer = const TreeNode*;
-
-  pointer parent = nullptr;
-  pointer left = nullptr;
-  pointer right = nullptr;
-  TreeNodeColor color = TreeNodeColor::RED;
+  using links_type = TreeNodeLinks<TreeNode, Links>;
+  using links_type::get_color;
+  using links_type::left;
+  using links_type::parent;
+  using links_type::right;
+  using links_type::set_color;
+
+  [[no_unique_address]] typename KeyPrefix::node_data key_prefix;
   value_type data;
+  [[no_unique_address]] typename Augment::node_data augment;
 
   template <typename... Args>
     requires((sizeof...(Args) == 0) ||
              (!std::is_same_v<
                   std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>,
-                  TreeNode<T>> &&
+                  TreeNode> &&
               std::is_constructible_v<value_type, Args...>))
   explicit TreeNode(Args&&... args) noexcept(
       std::is_nothrow_constructible_v<value_type, Args...>)
       : data(std::forward<Args>(args)...) {}
 
-  TreeNode(const TreeNode& other) : color(other.color), data(other.data) {}
+  TreeNode(const TreeNode& other)
+      : key_prefix(other.key_prefix),
+        data(other.data),
+        augment(other.augment) {
+    set_color(other.get_color());
+  }
 
   ~TreeNode() = default;
 
-  bool is_red() const noexcept { return color == TreeNodeColor::RED; }
-  bool is_black() const noexcept { return color == TreeNodeColor::BLACK; }
+  bool is_red() const noexcept { return get_color() == TreeNodeColor::RED; }
+  bool is_black() const noexcept {
+    return get_color() == TreeNodeColor::BLACK;
+  }
 
-  void set_red() noexcept { color = TreeNodeColor::RED; }
-  void set_black() noexcept { color = TreeNodeColor::BLACK; }
+  void set_red() noexcept { set_color(TreeNodeColor::RED); }
+  void set_black() noexcept { set_color(TreeNodeColor::BLACK); }
 
   bool is_left_child() const noexcept { return parent && this == parent->left; }
   bool is_right_child() const noexcept {
@@ -102,7 +122,9 @@ struct TreeNode {
   }
 
   const_pointer predecessor() const noexcept {
-    if (parent && parent->parent == this) {
+    // the header (red, its parent's parent is itself) steps back to the
+    // maximum; the black root has the same parent relation
+    if (is_red() && parent && parent->parent == this) {
       return right;
     }
     if (left) {
@@ -0,0 +1,76 @@
+#ifndef S21_TREE_NODE_ARENA_LINKS_H_
+#define S21_TREE_NODE_ARENA_LINKS_H_
+
+#include <cstdint>
+
+/*
+ * From <cstdint>:
+ *  std::uint32_t: The packed representation of a link.
+ */
+
+#include "../memory/s21_node_arena.h"
+#include "s21_tree_node_links.h"
+
+namespace s21 {
+
+/*
+ * TreeNode layout with three 32-bit indices into node_arena<Node> and the
+ * color in the top bit of 'parent'. Kept apart from the other layouts
+ * because the arena reserves its memory with POSIX mmap; only code that
+ * opts into this layout includes it.
+ *
+ * The nodes must come from node_arena_allocator (RedBlackTree checks
+ * this through 'allocator').
+ */
+struct ArenaIndexLinks {
+  template <typename Node>
+  using allocator = node_arena_allocator<Node>;
+};
+
+// A 31-bit index into node_arena<Node> plus a flag in the top bit.
+template <typename Node>
+class ArenaNodeIndex {
+ public:
+  ArenaNodeIndex() noexcept = default;
+  ArenaNodeIndex(const ArenaNodeIndex&) = delete;
+
+  operator Node*() const noexcept {
+    return node_arena<Node>::pointer(bits_ & kIndexMask);
+  }
+  Node* operator->() const noexcept { return *this; }
+  ArenaNodeIndex& operator=(Node* node) noexcept {
+    bits_ = node_arena<Node>::index(node) | (bits_ & ~kIndexMask);
+    return *this;
+  }
+  ArenaNodeIndex& operator=(const ArenaNodeIndex& other) noexcept {
+    return *this = static_cast<Node*>(other);
+  }
+
+  bool flag() const noexcept { return bits_ & ~kIndexMask; }
+  void set_flag(bool flag) noexcept {
+    bits_ = (bits_ & kIndexMask) | (flag ? ~kIndexMask : 0);
+  }
+
+ private:
+  static constexpr std::uint32_t kIndexMask = 0x7fffffff;
+
+  std::uint32_t bits_ = 0;
+};
+
+template <typename Node>
+struct TreeNodeLinks<Node, ArenaIndexLinks> {
+  ArenaNodeIndex<Node> parent;  // flag set: black
+  ArenaNodeIndex<Node> left;
+  ArenaNodeIndex<Node> right;
+
+  TreeNodeColor get_color() const noexcept {
+    return parent.flag() ? TreeNodeColor::BLACK : TreeNodeColor::RED;
+  }
+  void set_color(TreeNodeColor c) noexcept {
+    parent.set_flag(c == TreeNodeColor::BLACK);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_TREE_NODE_ARENA_LINKS_H_
@@ -0,0 +1,126 @@
+#ifndef S21_TREE_NODE_HANDLE_H_
+#define S21_TREE_NODE_HANDLE_H_
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/*
+ * From <memory>:
+ *  std::allocator_traits: Destroys and frees a node the handle still owns.
+ *
+ * From <optional>:
+ *  std::optional: An empty handle carries no allocator at all.
+ *
+ * From <type_traits>:
+ *  std::is_same_v: Tells map nodes (key/mapped) from set nodes (value).
+ */
+
+namespace s21 {
+
+template <typename Key, typename T, typename Traits, typename Compare,
+          typename Allocator, typename Augment, typename Links, typename Keys,
+          typename KeyPrefix>
+class RedBlackTree;
+
+/*
+ * Owns one node taken out of a tree by extract(). The element stays where
+ * it is in memory; insert(node_type&&) links the same node into a tree
+ * again. For maps key() is writable, so an entry can be rekeyed without
+ * reallocating: extract, change key(), insert.
+ *
+ * The handle keeps a copy of the tree's node allocator; a handle that still
+ * owns its node destroys and frees it with that allocator.
+ */
+template <typename Key, typename T, typename Node, typename NodeAllocator>
+class TreeNodeHandle {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using allocator_type = NodeAllocator;
+
+  TreeNodeHandle() noexcept = default;
+  TreeNodeHandle(TreeNodeHandle&& other) noexcept
+      : node_(std::exchange(other.node_, nullptr)),
+        alloc_(std::move(other.alloc_)) {
+    other.alloc_.reset();
+  }
+  TreeNodeHandle& operator=(TreeNodeHandle&& other) noexcept {
+    if (this != &other) {
+      reset();
+      node_ = std::exchange(other.node_, nullptr);
+      alloc_ = std::move(other.alloc_);
+      other.alloc_.reset();
+    }
+    return *this;
+  }
+  ~TreeNodeHandle() { reset(); }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+  allocator_type get_allocator() const { return *alloc_; }
+
+  // set nodes
+  value_type& value() const
+    requires std::is_same_v<Key, T>
+  {
+    return node_->data;
+  }
+
+  // map nodes; key() is writable as long as the node is outside a tree
+  key_type& key() const
+    requires(!std::is_same_v<Key, T>)
+  {
+    return const_cast<key_type&>(node_->data.first);
+  }
+  auto& mapped() const
+    requires(!std::is_same_v<Key, T>)
+  {
+    return node_->data.second;
+  }
+
+  void swap(TreeNodeHandle& other) noexcept {
+    std::swap(node_, other.node_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+ private:
+  template <typename, typename, typename, typename, typename, typename,
+            typename, typename, typename>
+  friend class RedBlackTree;
+
+  using alloc_traits = std::allocator_traits<NodeAllocator>;
+
+  TreeNodeHandle(Node* node, const NodeAllocator& alloc)
+      : node_(node), alloc_(alloc) {}
+
+  Node* release() noexcept {
+    alloc_.reset();
+    return std::exchange(node_, nullptr);
+  }
+
+  void reset() noexcept {
+    if (node_) {
+      alloc_traits::destroy(*alloc_, node_);
+      alloc_traits::deallocate(*alloc_, node_, 1);
+      node_ = nullptr;
+    }
+    alloc_.reset();
+  }
+
+  Node* node_ = nullptr;
+  std::optional<NodeAllocator> alloc_;
+};
+
+// Result of insert(node_type&&): on failure the handle comes back in 'node'.
+template <typename Iterator, typename NodeType>
+struct TreeInsertReturn {
+  Iterator position;
+  bool inserted;
+  NodeType node;
+};
+
+}  // namespace s21
+
+#endif  // S21_TREE_NODE_HANDLE_H_
@@ -0,0 +1,119 @@
+#ifndef S21_TREE_NODE_LINKS_H_
+#define S21_TREE_NODE_LINKS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * From <atomic>:
+ *  std::atomic: The reference count of a PersistentLinks node, which
+ *    versions on several threads share.
+ *
+ * From <cstdint>:
+ *  std::uintptr_t, std::uint32_t: The packed representations of a link.
+ */
+
+namespace s21 {
+
+enum class TreeNodeColor { RED, BLACK };
+
+/*
+ * Link layouts for TreeNode, chosen by its Links template parameter:
+ *
+ *  PointerLinks        three pointers and a color field (the default)
+ *  TaggedPointerLinks  three pointers, the color in the low bit of 'parent'
+ *  ArenaIndexLinks     three 32-bit indices into node_arena<Node>, the
+ *                      color in the top bit of 'parent'; opt-in, defined
+ *                      in s21_tree_node_arena_links.h
+ *  PersistentLinks     'left', 'right', the color and a reference count,
+ *                      no parent: the immutable nodes of persistent_map,
+ *                      shared by many versions (not for RedBlackTree)
+ *
+ * In the packed layouts 'parent', 'left' and 'right' are small link
+ * objects that read and assign like Node*, so the tree code is the same
+ * for every layout; the color is only reachable through get_color() and
+ * set_color(). A layout whose nodes need a particular allocator names it
+ * as Links::allocator<Node>.
+ */
+struct PointerLinks {};
+struct TaggedPointerLinks {};
+struct PersistentLinks {};
+
+template <typename Node, typename Links>
+struct TreeNodeLinks;
+
+template <typename Node>
+struct TreeNodeLinks<Node, PointerLinks> {
+  Node* parent = nullptr;
+  Node* left = nullptr;
+  Node* right = nullptr;
+  TreeNodeColor color = TreeNodeColor::RED;
+
+  TreeNodeColor get_color() const noexcept { return color; }
+  void set_color(TreeNodeColor c) noexcept { color = c; }
+};
+
+// A Node* whose low bit (free, nodes are pointer-aligned) holds a flag.
+template <typename Node>
+class TaggedNodePointer {
+ public:
+  TaggedNodePointer() noexcept = default;
+  TaggedNodePointer(const TaggedNodePointer&) = delete;
+
+  operator Node*() const noexcept {
+    return reinterpret_cast<Node*>(bits_ & ~std::uintptr_t{1});
+  }
+  Node* operator->() const noexcept { return *this; }
+  // assigning a link only ever replaces the pointer, never the flag
+  TaggedNodePointer& operator=(Node* node) noexcept {
+    bits_ = reinterpret_cast<std::uintptr_t>(node) | (bits_ & 1);
+    return *this;
+  }
+  TaggedNodePointer& operator=(const TaggedNodePointer& other) noexcept {
+    return *this = static_cast<Node*>(other);
+  }
+
+  bool flag() const noexcept { return bits_ & 1; }
+  void set_flag(bool flag) noexcept {
+    bits_ = (bits_ & ~std::uintptr_t{1}) | flag;
+  }
+
+ private:
+  std::uintptr_t bits_ = 0;
+};
+
+template <typename Node>
+struct TreeNodeLinks<Node, TaggedPointerLinks> {
+  TaggedNodePointer<Node> parent;  // flag set: black
+  TaggedNodePointer<Node> left;
+  TaggedNodePointer<Node> right;
+
+  TreeNodeColor get_color() const noexcept {
+    return parent.flag() ? TreeNodeColor::BLACK : TreeNodeColor::RED;
+  }
+  void set_color(TreeNodeColor c) noexcept {
+    parent.set_flag(c == TreeNodeColor::BLACK);
+  }
+};
+
+// Stands in for 'parent' in layouts without one. It converts to nothing,
+// so the TreeNode members that walk up the tree do not compile for them.
+struct NoParentLink {};
+
+template <typename Node>
+struct TreeNodeLinks<Node, PersistentLinks> {
+  [[no_unique_address]] NoParentLink parent;
+  Node* left = nullptr;
+  Node* right = nullptr;
+  TreeNodeColor color = TreeNodeColor::RED;
+  // The parents and versions holding the node; it starts with its creator.
+  mutable std::atomic<std::size_t> refs{1};
+
+  TreeNodeColor get_color() const noexcept { return color; }
+  void set_color(TreeNodeColor c) noexcept { color = c; }
+};
+
+}  // namespace s21
+
+#endif  // S21_TREE_NODE_LINKS_H_
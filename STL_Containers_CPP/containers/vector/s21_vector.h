@@ -4,6 +4,7 @@
 #include <algorithm>  // отсюда берем для move copy методов
 #include <cstddef>    // size_t для member types
 #include <initializer_list>  // initializer_list для конструктора
+#include <iterator>  // input_iterator и forward_iterator для диапазонов
 #include <limits>  // numeric_limits  max() функция для capacity метода max_size
 #include <stdexcept>
 /* stdexcept для обработки исключений:
@@ -13,6 +14,8 @@
 */
 #include <utility>  // std::swap метод
 
+#include "../s21_container_tags.h"  // from_range для конструктора из диапазона
+
 namespace s21 {
 
 template <typename T>
@@ -32,6 +35,10 @@ class vector {
   vector(size_type n);  // конструктор с явным параметром размера n
   vector(std::initializer_list<value_type> const&
              items);  // вектор с классом инит лист (!)
+  template <std::input_iterator InputIt>
+  vector(InputIt first, InputIt last);  // вектор из диапазона итераторов
+  template <container_compatible_range<T> R>
+  vector(from_range_t, R&& rg);  // вектор из любого диапазона (range)
 
   vector(const vector& v);  // конструктор копирования с другого вектора
   vector(vector&& v) noexcept;  // конструктор перемещения с другого вектора и
@@ -39,6 +46,7 @@ class vector {
   ~vector();                    // деструктор
   vector& operator=(
       vector&& v) noexcept;  // оперетор присваивания для перемещения объекта
+  vector& operator=(const vector& v);  // присваивание копированием
 
   // Vector Element access
   reference at(
@@ -49,19 +57,22 @@ class vector {
   const_reference front();  // доступ к первому элементу
   const_reference back();   // к последнему
   value_type* data();  // прямой доступ к базовому массиву
+  const value_type* data() const;
 
   // Vector Iterators
   iterator begin();  // возвращает итератор к началу
   iterator end();    // к концу
+  const_iterator begin() const;  // то же для константного вектора
+  const_iterator end() const;
 
   // Vector Capacity
-  bool empty();  // чек пустого контейнера
-  size_type size();  // возвращает размер кол-ва элементов
-  size_type max_size();  // возвращает максимально возможный размер
+  bool empty() const;  // чек пустого контейнера
+  size_type size() const;  // возвращает размер кол-ва элементов
+  size_type max_size() const;  // возвращает максимально возможный размер
   void reserve(size_type size);  // выделяет хранилище для хранения элементов
                                  // массива к новому массиву
-  size_type capacity();  // возвращает размер кол-ва элементов которые могу
-                         // храниться в выделенном хранилище
+  size_type capacity() const;  // возвращает размер кол-ва элементов которые
+                               // могут храниться в выделенном хранилище
   void shrink_to_fit();  // уменьшает размер выделенной памяти освобождая
                          // неиспользованную
 
@@ -70,15 +81,24 @@ class vector {
   iterator insert(
       iterator pos,
       const_reference value);  // добавляет значение к конкретной позиции
+  iterator insert(iterator pos, value_type&& value);  // то же перемещением
   void erase(iterator pos);  // чистит элемент на определенном индексе
   void push_back(const_reference value);  // добавляет к концу вектора элемент
+  void push_back(value_type&& value);  // то же перемещением
   void pop_back();  // удаляет последний в векторе элемент
   void swap(
       vector& other);  // меняет содержимое вектора с содержимым другого вектора
+  template <std::input_iterator InputIt>
+  void assign(InputIt first,
+              InputIt last);  // заменяет содержимое элементами диапазона
 
   // methods for test
 
  private:
+  // общая часть assign и конструкторов из диапазона
+  template <typename It, typename Sent>
+  void assign_range(It first, Sent last);
+
   T* data_;             // массив данных
   size_type size_;      // размер вложенных элементов
   size_type capacity_;  // размер массива (его максимум)
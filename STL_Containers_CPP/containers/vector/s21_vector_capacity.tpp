@@ -4,18 +4,18 @@
 namespace s21 {
 // проверка на пустоту
 template <typename T>
-bool vector<T>::empty() {
+bool vector<T>::empty() const {
   return size_ == 0;
 }
 // чекинг размера
 template <typename T>
-typename vector<T>::size_type vector<T>::size() {
+typename vector<T>::size_type vector<T>::size() const {
   return size_;
 }
 
 // вызов метода numeric_limits::max() для вывода максимума для вектора
 template <typename T>
-typename vector<T>::size_type vector<T>::max_size() {
+typename vector<T>::size_type vector<T>::max_size() const {
   return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
 }
 
@@ -58,7 +58,7 @@ void vector<T>::reserve(size_type size) {
 
 // размер массива вектора
 template <typename T>
-typename vector<T>::size_type vector<T>::capacity() {
+typename vector<T>::size_type vector<T>::capacity() const {
   return capacity_;
 }
 
@@ -83,6 +83,15 @@ template <typename T>
 typename vector<T>::iterator vector<T>::end() {
   return data_ + size_;
 }
+// то же для константного вектора
+template <typename T>
+typename vector<T>::const_iterator vector<T>::begin() const {
+  return data_;
+}
+template <typename T>
+typename vector<T>::const_iterator vector<T>::end() const {
+  return data_ + size_;
+}
 
 // перенос методов в s21_vector_elem_access.tpp
 }  // namespace s21
@@ -41,6 +41,10 @@ template <typename T>
 typename vector<T>::value_type* vector<T>::data() {
   return data_;
 };
+template <typename T>
+const typename vector<T>::value_type* vector<T>::data() const {
+  return data_;
+};
 
 }  // namespace s21
 
@@ -36,6 +36,21 @@ vector<T>::vector(
   }
 }
 
+// конструктор из диапазона [first, last): для forward-итераторов
+// размер известен заранее, и память выделяется один раз
+template <typename T>
+template <std::input_iterator InputIt>
+vector<T>::vector(InputIt first, InputIt last) : vector() {
+  assign_range(first, last);
+}
+
+// конструктор из диапазона (range), например vector(s21::from_range, list)
+template <typename T>
+template <container_compatible_range<T> R>
+vector<T>::vector(from_range_t, R&& rg) : vector() {
+  assign_range(std::ranges::begin(rg), std::ranges::end(rg));
+}
+
 template <typename T>  // Конструктор копирования
 vector<T>::vector(const vector& v) : size_(v.size_), capacity_(v.capacity_) {
   if (v.size_ == 0 || v.capacity_ == 0) {
@@ -73,6 +88,17 @@ vector<T>& vector<T>::operator=(vector&& v) noexcept {
   return *this;
 }
 
+template <typename T>
+// Оператор присваивания с копированием: через копию и swap, так что при
+// исключении вектор остаётся прежним
+vector<T>& vector<T>::operator=(const vector& v) {
+  if (this != &v) {
+    vector copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
 template <typename T>  // Деструктор вектора
 vector<T>::~vector() {
   delete[] this->data_;
@@ -7,10 +7,17 @@ template <typename T>
 void vector<T>::clear() {
   size_ = 0;
 }
-// вставка value на конкретную позицию
+// вставка value на конкретную позицию: копия делается до расширения
+// памяти, поэтому value может быть и элементом этого же вектора
 template <typename T>
 typename vector<T>::iterator vector<T>::insert(
     vector<T>::iterator pos, vector<T>::const_reference value) {
+  return insert(pos, value_type(value));
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::insert(vector<T>::iterator pos,
+                                               value_type&& value) {
   size_type index = pos - begin();
   // если вышли за пределы
   if (index > size_) {
@@ -28,10 +35,10 @@ typename vector<T>::iterator vector<T>::insert(
   iterator new_pos = begin() + index;
 
   for (iterator i = end(); i != new_pos; --i) {
-    *i = *(i - 1);  // смещение элементов влево от позиции которую будет
-                    // занимать теперь value
+    *i = std::move(*(i - 1));  // смещение элементов вправо от позиции
+                               // которую будет занимать теперь value
   }
-  *new_pos = value;  // значение занимает то самое место по pos
+  *new_pos = std::move(value);  // значение занимает то самое место по pos
   ++size_;  // размер вложенных элементов увеличичается на 1 раз уж добавили
             // один value
 
@@ -47,8 +54,7 @@ void vector<T>::erase(vector<T>::iterator pos) {
   }
   // смещает вправо элементы
   for (iterator i = pos; i != end() - 1; ++i) {
-    *i = *(i + 1);
-    ;
+    *i = std::move(*(i + 1));
   }
   --size_;  // уменьшает размер на 1
 }
@@ -63,6 +69,15 @@ void vector<T>::push_back(const_reference value) {
   ++size_;
 }
 
+template <typename T>
+void vector<T>::push_back(value_type&& value) {
+  if (size_ == capacity_) {
+    reserve(std::max(capacity_ * 2, size_t(1)));
+  }
+  data_[size_] = std::move(value);
+  ++size_;
+}
+
 // удаление последнего элемента
 template <typename T>
 void vector<T>::pop_back() {
@@ -81,6 +96,47 @@ void vector<T>::swap(vector<T>& other) {
   std::swap(capacity_, other.capacity_);
 }
 
+// замена содержимого элементами [first, last)
+template <typename T>
+template <std::input_iterator InputIt>
+void vector<T>::assign(InputIt first, InputIt last) {
+  assign_range(first, last);
+}
+
+template <typename T>
+template <typename It, typename Sent>
+void vector<T>::assign_range(It first, Sent last) {
+  if constexpr (std::forward_iterator<It>) {
+    // размер известен: одно выделение памяти (или ни одного, если
+    // текущей ёмкости хватает) и копирование без проверок на каждом шаге
+    size_type n = static_cast<size_type>(std::ranges::distance(first, last));
+    if (n > capacity_) {
+      if (n > max_size()) {
+        throw std::out_of_range("vector::assign: too many elements");
+      }
+      T* new_data = new T[n];
+      try {
+        std::ranges::copy(first, last, new_data);
+      } catch (...) {
+        delete[] new_data;
+        throw;
+      }
+      delete[] data_;
+      data_ = new_data;
+      capacity_ = n;
+    } else {
+      std::ranges::copy(first, last, data_);
+    }
+    size_ = n;
+  } else {
+    // однопроходный источник: размер заранее неизвестен
+    clear();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+}
+
 }  // namespace s21
 
 #endif
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef S21_CONTAINERSPLUS_H_
+#define S21_CONTAINERSPLUS_H_
+
+#include "containers/list/s21_concurrent_ordered_list.h"
+#include "containers/list/s21_list_parallel.h"
+#include "containers/s21_btree_map.h"
+#include "containers/s21_btree_set.h"
+#include "containers/s21_concurrent_map.h"
+#include "containers/s21_flat_map.h"
+#include "containers/s21_flat_set.h"
+#include "containers/s21_interval_map.h"
+#include "containers/s21_multimap.h"
+#include "containers/s21_multiset.h"
+#include "containers/s21_persistent_map.h"
+#include "containers/s21_radix_map.h"
+#include "containers/s21_unordered_map.h"
+#include "containers/s21_unordered_set.h"
+
+#endif  // S21_CONTAINERSPLUS_H_
@@ -1,9 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
 #include <list>
+#include <random>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "../s21_containers.h"
+#include "../s21_containersplus.h"
 
 class ListTest : public ::testing::Test {
  protected:
@@ -409,4 +417,180 @@ TEST_F(ListTest, SortSorted) {
   EXPECT_EQ(*it, 2);
   ++it;
   EXPECT_EQ(*it, 3);
-}
\ No newline at end of file
+}
+TEST_F(ListTest, CompactKeepsOrder) {
+  s21::list<int> l;
+  for (int i = 0; i < 100; ++i) {
+    l.push_back(i);
+    l.push_front(-i);
+  }
+  std::list<int> expected(l.begin(), l.end());
+  l.compact();
+  EXPECT_EQ(l.size(), expected.size());
+  auto it = l.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(it, l.end());
+}
+
+TEST_F(ListTest, CompactThenEdit) {
+  s21::list<int> l = {1, 2, 3, 4, 5};
+  l.compact();
+  l.erase(l.begin());
+  l.pop_back();
+  l.push_back(10);
+  l.insert(l.begin(), 0);
+  l.compact();
+  l.compact();
+  int expected[] = {0, 2, 3, 4, 10};
+  auto it = l.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  l.compact();
+  EXPECT_TRUE(l.empty());
+}
+
+TEST_F(ListTest, CompactThenSpliceAndMerge) {
+  s21::list<std::string> a = {"b", "d"};
+  s21::list<std::string> b = {"a", "c"};
+  s21::list<std::string> c = {"e"};
+  a.compact();
+  b.compact();
+  c.compact();
+  a.merge(b);
+  a.splice(a.end(), c);
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  std::string joined;
+  for (const auto& item : b) joined += item;
+  EXPECT_EQ(joined, "abcde");
+  b.erase(b.begin());
+  EXPECT_EQ(b.front(), "b");
+}
+
+TEST_F(ListTest, EraseAcrossManyBlocks) {
+  // every bulk append and every adopted list adds blocks
+  s21::list<std::string> l;
+  std::vector<std::string> chunk(8, std::string(32, 'x'));
+  for (int i = 0; i < 200; ++i) {
+    s21::list<std::string> other(chunk.begin(), chunk.end());
+    if (i % 2) {
+      l.splice(l.begin(), other);
+    } else {
+      l.merge(other);
+    }
+    l.push_back("heap");
+  }
+  EXPECT_EQ(l.size(), 200u * 9);
+  std::mt19937 rng(26);
+  while (!l.empty()) {
+    auto it = l.begin();
+    for (auto skip = rng() % l.size(); skip > 0; --skip) ++it;
+    l.erase(it);
+  }
+  l.push_back("again");
+  EXPECT_EQ(l.front(), "again");
+}
+
+TEST_F(ListTest, ForEachPrefetch) {
+  long plain = 0;
+  long prefetched = 0;
+  test_list_filled->for_each([&plain](int value) { plain += value; });
+  test_list_filled->for_each([&prefetched](int& value) { prefetched += value; },
+                             true);
+  EXPECT_EQ(plain, 15);
+  EXPECT_EQ(prefetched, 15);
+  test_list->for_each([](int&) { FAIL(); }, true);
+}
+
+TEST_F(ListTest, SortIsStableAndRelinks) {
+  s21::list<std::pair<int, int>> l;
+  for (int i = 0; i < 50; ++i) l.push_back({(i * 7) % 5, i});
+  auto first = l.begin();
+  const std::pair<int, int>* first_address = &*first;
+  l.sort();
+  int previous_key = -1;
+  int previous_index = -1;
+  bool found_first = false;
+  for (const auto& item : l) {
+    if (item.first == previous_key) {
+      EXPECT_LT(previous_index, item.second);
+    }
+    EXPECT_LE(previous_key, item.first);
+    previous_key = item.first;
+    previous_index = item.second;
+    found_first = found_first || &item == first_address;
+  }
+  EXPECT_TRUE(found_first);
+  EXPECT_EQ(l.size(), size_t(50));
+  EXPECT_EQ(l.back().first, 4);
+  EXPECT_EQ(l.front().first, 0);
+}
+
+TEST_F(ListTest, ParallelSort) {
+  std::mt19937 rng(7);
+  std::vector<int> expected(50000);
+  for (int& value : expected) value = static_cast<int>(rng() % 1000);
+  s21::list<int> l;
+  for (int value : expected) l.push_back(value);
+  s21::parallel::sort(l, 5);
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(l.size(), expected.size());
+  auto it = l.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(it, l.end());
+  auto back = l.end();
+  --back;
+  EXPECT_EQ(*back, expected.back());
+}
+
+TEST_F(ListTest, ParallelSortSmallAndEmpty) {
+  s21::list<int> empty;
+  s21::parallel::sort(empty);
+  EXPECT_TRUE(empty.empty());
+  s21::list<int> l = {3, 1, 2};
+  s21::parallel::sort(l, 8);
+  auto it = l.begin();
+  EXPECT_EQ(*it++, 1);
+  EXPECT_EQ(*it++, 2);
+  EXPECT_EQ(*it++, 3);
+  EXPECT_EQ(it, l.end());
+}
+
+TEST_F(ListTest, IteratorPairConstructor) {
+  std::vector<int> source = {4, 5, 6};
+  s21::list<int> l(source.begin(), source.end());
+  EXPECT_EQ(l.size(), size_t(3));
+  EXPECT_EQ(l.front(), 4);
+  EXPECT_EQ(l.back(), 6);
+  l.erase(l.begin());
+  l.push_front(1);
+  EXPECT_EQ(l.front(), 1);
+}
+
+TEST_F(ListTest, FromRangeConstructorAndAssign) {
+  s21::vector<std::string> source = {"a", "b", "c"};
+  s21::list<std::string> l(s21::from_range, source);
+  EXPECT_EQ(l.size(), size_t(3));
+  EXPECT_EQ(l.back(), "c");
+  std::istringstream input("7 8");
+  s21::list<int> numbers(std::istream_iterator<int>(input),
+                         std::istream_iterator<int>{});
+  EXPECT_EQ(numbers.size(), size_t(2));
+  numbers.assign(test_list_filled->begin(), test_list_filled->end());
+  EXPECT_EQ(numbers.size(), size_t(5));
+  EXPECT_EQ(numbers.back(), 5);
+  s21::list<int> copy(numbers);
+  numbers.clear();
+  EXPECT_EQ(copy.size(), size_t(5));
+  EXPECT_EQ(copy.front(), 1);
+}
@@ -2,6 +2,7 @@
 
 #include <queue>
 #include <stdexcept>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -158,4 +159,22 @@ TEST_F(QueueTest, SwapSelf) {
   EXPECT_EQ(q.size(), size_t(3));
   EXPECT_EQ(q.front(), 1);
   EXPECT_EQ(q.back(), 3);
-}
\ No newline at end of file
+}
+
+TEST_F(QueueTest, IteratorPairConstructorAndAssign) {
+  std::vector<int> source = {7, 8, 9};
+  s21::queue<int> q(source.begin(), source.end());
+  EXPECT_EQ(q.size(), size_t(3));
+  EXPECT_EQ(q.front(), 7);
+  EXPECT_EQ(q.back(), 9);
+  q.push(10);
+  EXPECT_EQ(q.back(), 10);
+  s21::list<int> other = {1, 2};
+  q.assign(other.begin(), other.end());
+  EXPECT_EQ(q.size(), size_t(2));
+  EXPECT_EQ(q.front(), 1);
+  s21::queue<int> ranged(s21::from_range, source);
+  EXPECT_EQ(ranged.size(), size_t(3));
+  ranged.pop();
+  EXPECT_EQ(ranged.front(), 8);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <stack>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -114,4 +115,20 @@ TEST_F(StackTest, SwapSelf) {
   s.swap(s);
   EXPECT_EQ(s.size(), size_t(3));
   EXPECT_EQ(s.top(), 3);
-}
\ No newline at end of file
+}
+
+TEST_F(StackTest, IteratorPairConstructorAndAssign) {
+  std::vector<int> source = {1, 2, 3};
+  s21::stack<int> s(source.begin(), source.end());
+  EXPECT_EQ(s.size(), size_t(3));
+  EXPECT_EQ(s.top(), 3);
+  s.pop();
+  EXPECT_EQ(s.top(), 2);
+  s21::stack<int> ranged(s21::from_range, source);
+  EXPECT_EQ(ranged.top(), 3);
+  ranged.assign(source.begin(), source.begin() + 1);
+  EXPECT_EQ(ranged.size(), size_t(1));
+  EXPECT_EQ(ranged.top(), 1);
+  ranged.pop();
+  EXPECT_TRUE(ranged.empty());
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#define private public
+#include "../containers/btree/s21_btree.h"
+#undef private
+
+template <typename Key>
+struct TestSetTraits {
+  using key_type = Key;
+  using value_type = Key;
+  const key_type& operator()(const value_type& value) const { return value; }
+};
+
+// Large enough that a node holds only three elements, so small inputs
+// already build deep trees and exercise every split and merge path.
+struct WideKey {
+  int key;
+  std::string payload;
+  char padding[64];
+
+  WideKey(int k) : key(k), payload(std::to_string(k)), padding{} {}
+  bool operator<(const WideKey& other) const { return key < other.key; }
+};
+
+template <typename Tree>
+class BTreeTest : public ::testing::Test {
+ protected:
+  using Node = typename Tree::Node;
+
+  // Returns the depth of the leaves below node, -1 if they differ.
+  int validate_node(const Tree& tree, const Node* node, const Node* parent) {
+    if (node->parent != parent) return -1;
+    // biased splits may leave a single element, but never an empty node
+    if (parent && node->count == 0) return -1;
+    if (node->count > Tree::kNodeSlots) return -1;
+    if (node->leaf) return 1;
+    int depth = -1;
+    for (std::size_t i = 0; i <= node->count; ++i) {
+      const Node* child = node->child(i);
+      if (child->position != i) return -1;
+      int child_depth = validate_node(tree, child, node);
+      if (child_depth == -1 || (depth != -1 && child_depth != depth)) {
+        return -1;
+      }
+      depth = child_depth;
+    }
+    return depth + 1;
+  }
+
+  void assert_is_valid_btree(const Tree& tree) {
+    ASSERT_EQ(tree.empty(), tree.size() == 0);
+    if (tree.empty()) {
+      ASSERT_EQ(tree.root_, nullptr);
+      ASSERT_EQ(tree.begin(), tree.end());
+      return;
+    }
+    ASSERT_EQ(validate_node(tree, tree.root_, nullptr),
+              static_cast<int>(tree.height()));
+    const Node* leftmost = tree.root_;
+    while (!leftmost->leaf) leftmost = leftmost->child(0);
+    const Node* rightmost = tree.root_;
+    while (!rightmost->leaf) rightmost = rightmost->child(rightmost->count);
+    ASSERT_EQ(tree.leftmost_, leftmost);
+    ASSERT_EQ(tree.rightmost_, rightmost);
+    ASSERT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+    ASSERT_EQ(static_cast<std::size_t>(std::distance(tree.begin(), tree.end())),
+              tree.size());
+  }
+
+  static int key_of(int value) { return value; }
+  static int key_of(const WideKey& value) { return value.key; }
+};
+
+using BTreeTypes =
+    ::testing::Types<s21::BTree<int, int, TestSetTraits<int>>,
+                     s21::BTree<WideKey, WideKey, TestSetTraits<WideKey>>>;
+TYPED_TEST_SUITE(BTreeTest, BTreeTypes);
+
+TYPED_TEST(BTreeTest, AscendingInsertKeepsLeavesFull) {
+  TypeParam tree;
+  const int n = 5000;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_TRUE(tree.emplace(i).second);
+  }
+  this->assert_is_valid_btree(tree);
+  // appending splits off empty right nodes, so every leaf but the last
+  // keeps all of its slots but the one that moved up
+  std::size_t full_leaves = 0;
+  std::size_t leaves = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it) {
+    if (it.get_node()->leaf && it.get_position() == 0) {
+      ++leaves;
+      if (it.get_node()->count == TypeParam::kNodeSlots - 1) ++full_leaves;
+    }
+  }
+  ASSERT_GE(full_leaves + 1, leaves);
+}
+
+TYPED_TEST(BTreeTest, RandomInsertEraseMatchesStdSet) {
+  TypeParam tree;
+  std::set<int> reference;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> keys(0, 2000);
+  for (int round = 0; round < 20000; ++round) {
+    int key = keys(rng);
+    if (rng() % 3 == 0) {
+      auto it = tree.find(key);
+      bool present = reference.erase(key) == 1;
+      ASSERT_EQ(it != tree.end(), present);
+      if (present) {
+        auto next = tree.erase(it);
+        auto expected = reference.upper_bound(key);
+        if (expected == reference.end()) {
+          ASSERT_EQ(next, tree.end());
+        } else {
+          ASSERT_EQ(this->key_of(*next), *expected);
+        }
+      }
+    } else {
+      ASSERT_EQ(tree.emplace(key).second, reference.insert(key).second);
+    }
+    if (round % 1000 == 0) this->assert_is_valid_btree(tree);
+  }
+  this->assert_is_valid_btree(tree);
+  ASSERT_TRUE(std::equal(
+      tree.begin(), tree.end(), reference.begin(), reference.end(),
+      [this](const auto& a, int b) { return this->key_of(a) == b; }));
+}
+
+TYPED_TEST(BTreeTest, EraseEverythingInBothDirections) {
+  for (bool forward : {true, false}) {
+    TypeParam tree;
+    for (int i = 0; i < 3000; ++i) tree.emplace(i * 7 % 3000);
+    this->assert_is_valid_btree(tree);
+    while (!tree.empty()) {
+      auto it = forward ? tree.begin() : --tree.end();
+      tree.erase(it);
+    }
+    this->assert_is_valid_btree(tree);
+    ASSERT_EQ(tree.height(), 0u);
+  }
+}
+
+TYPED_TEST(BTreeTest, BoundsAndReverseIteration) {
+  TypeParam tree;
+  for (int i = 0; i < 1000; ++i) tree.emplace(2 * i);
+  for (int key = -1; key < 2001; ++key) {
+    auto lower = tree.lower_bound(key);
+    auto upper = tree.upper_bound(key);
+    int expected_lower = key < 0 ? 0 : (key + 1) / 2 * 2;
+    int expected_upper = key < 0 ? 0 : key / 2 * 2 + 2;
+    if (expected_lower >= 2000) {
+      ASSERT_EQ(lower, tree.end());
+    } else {
+      ASSERT_EQ(this->key_of(*lower), expected_lower);
+    }
+    if (expected_upper >= 2000) {
+      ASSERT_EQ(upper, tree.end());
+    } else {
+      ASSERT_EQ(this->key_of(*upper), expected_upper);
+    }
+  }
+  int expected = 1998;
+  for (auto it = tree.end(); it != tree.begin(); expected -= 2) {
+    --it;
+    ASSERT_EQ(this->key_of(*it), expected);
+  }
+  ASSERT_EQ(expected, -2);
+}
+
+TYPED_TEST(BTreeTest, CopyMoveAndMerge) {
+  TypeParam a;
+  TypeParam b;
+  for (int i = 0; i < 2000; ++i) a.emplace(i * 2);
+  for (int i = 0; i < 2000; ++i) b.emplace(i * 3);
+  TypeParam copy(a);
+  this->assert_is_valid_btree(copy);
+  ASSERT_EQ(copy.size(), a.size());
+  a.merge(b);
+  this->assert_is_valid_btree(a);
+  this->assert_is_valid_btree(b);
+  // b keeps the multiples of 6 that a already had
+  ASSERT_EQ(b.size(), 667u);
+  ASSERT_EQ(a.size(), 2000u + 2000u - 667u);
+  TypeParam moved(std::move(a));
+  this->assert_is_valid_btree(moved);
+  this->assert_is_valid_btree(a);
+  ASSERT_EQ(moved.size(), 3333u);
+  copy = moved;
+  ASSERT_EQ(copy.size(), 3333u);
+  this->assert_is_valid_btree(copy);
+}
+
+TEST(BTreeNodeTest, NodesSpanSeveralCacheLines) {
+  using IntNode = s21::BTreeNode<int>;
+  ASSERT_EQ(IntNode::kSlots, 60u);
+  ASSERT_LE(sizeof(IntNode), IntNode::kTargetBytes);
+  ASSERT_GE(s21::BTreeNode<WideKey>::kSlots, 3u);
+}
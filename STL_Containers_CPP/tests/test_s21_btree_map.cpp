@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(BTreeMapTest, InitializerListConstructor) {
+  s21::btree_map<int, std::string> m = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  ASSERT_EQ(m.size(), 3u);
+  std::vector<int> keys;
+  for (const auto& [key, value] : m) keys.push_back(key);
+  ASSERT_EQ(keys, (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(m.at(1), "a");
+}
+
+TEST(BTreeMapTest, AtAndSubscript) {
+  s21::btree_map<std::string, int> m;
+  m["one"] = 1;
+  m["two"] += 2;
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_EQ(m["two"], 2);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  const auto& cm = m;
+  ASSERT_EQ(cm.at("two"), 2);
+  ASSERT_THROW(cm.at("zero"), std::out_of_range);
+}
+
+TEST(BTreeMapTest, InsertVariants) {
+  s21::btree_map<int, std::string> m;
+  ASSERT_TRUE(m.insert({1, "a"}).second);
+  ASSERT_FALSE(m.insert({1, "b"}).second);
+  ASSERT_TRUE(m.insert(2, "b").second);
+  ASSERT_FALSE(m.insert(2, "c").second);
+  ASSERT_EQ(m.at(2), "b");
+  auto [it, inserted] = m.insert_or_assign(2, "c");
+  ASSERT_FALSE(inserted);
+  ASSERT_EQ(it->second, "c");
+  ASSERT_TRUE(m.insert_or_assign(3, "d").second);
+  ASSERT_TRUE(m.try_emplace(4, 3, 'x').second);
+  ASSERT_EQ(m.at(4), "xxx");
+  ASSERT_FALSE(m.emplace(4, "y").second);
+  ASSERT_EQ(m.emplace_hint(m.end(), 5, "e")->first, 5);
+  ASSERT_EQ(m.size(), 5u);
+}
+
+TEST(BTreeMapTest, TryEmplaceLeavesArgumentsAlone) {
+  s21::btree_map<int, std::string> m = {{1, "a"}};
+  std::string value = "moved";
+  ASSERT_FALSE(m.try_emplace(1, std::move(value)).second);
+  ASSERT_EQ(value, "moved");
+}
+
+TEST(BTreeMapTest, EraseReturnsNextAndCounts) {
+  s21::btree_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i * i;
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first % 2) {
+      it = m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_EQ(m.size(), 500u);
+  ASSERT_EQ(m.erase(10), 1u);
+  ASSERT_EQ(m.erase(11), 0u);
+  ASSERT_FALSE(m.contains(10));
+  ASSERT_EQ(m.at(998), 998 * 998);
+}
+
+TEST(BTreeMapTest, LookupsMatchStdMap) {
+  s21::btree_map<int, int> m;
+  std::map<int, int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    int key = (i * 7919) % 10007;
+    m[key] = i;
+    reference[key] = i;
+  }
+  ASSERT_EQ(m.size(), reference.size());
+  for (int key = 0; key < 10010; key += 13) {
+    ASSERT_EQ(m.contains(key), reference.count(key) == 1);
+    ASSERT_EQ(m.count(key), reference.count(key));
+    auto lower = m.lower_bound(key);
+    auto expected = reference.lower_bound(key);
+    ASSERT_EQ(lower == m.end(), expected == reference.end());
+    if (expected != reference.end()) {
+      ASSERT_EQ(*lower, *expected);
+    }
+    auto [first, last] = m.equal_range(key);
+    ASSERT_EQ(std::distance(first, last), reference.count(key) ? 1 : 0);
+  }
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), reference.begin()));
+}
+
+TEST(BTreeMapTest, MergeMovesMissingKeys) {
+  s21::btree_map<int, std::string> a = {{1, "a"}, {3, "c"}};
+  s21::btree_map<int, std::string> b = {{1, "x"}, {2, "b"}, {4, "d"}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.at(1), "a");
+  ASSERT_EQ(a.at(2), "b");
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_EQ(b.at(1), "x");
+}
+
+TEST(BTreeMapTest, CopyMoveAndSwap) {
+  s21::btree_map<std::string, int> a;
+  for (int i = 0; i < 300; ++i) a[std::to_string(i)] = i;
+  s21::btree_map<std::string, int> b(a);
+  ASSERT_EQ(b.size(), 300u);
+  s21::btree_map<std::string, int> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(c.at("42"), 42);
+  a.swap(c);
+  ASSERT_EQ(a.size(), 300u);
+  ASSERT_TRUE(c.empty());
+  c = b;
+  ASSERT_TRUE(std::equal(b.begin(), b.end(), c.begin(), c.end()));
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.begin(), c.end());
+}
+
+TEST(BTreeMapTest, TransparentLookup) {
+  s21::btree_map<std::string, int, std::less<>> m = {{"apple", 1},
+                                                     {"pear", 2}};
+  std::string_view key = "pear";
+  ASSERT_TRUE(m.contains(key));
+  ASSERT_EQ(m.find(key)->second, 2);
+  ASSERT_EQ(m.lower_bound(std::string_view("b"))->first, "pear");
+}
+
+TEST(BTreeMapTest, FromRange) {
+  std::vector<std::pair<int, int>> source = {{2, 4}, {1, 1}, {3, 9}};
+  s21::btree_map<int, int> m(s21::from_range, source);
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.begin()->first, 1);
+  ASSERT_EQ((--m.end())->second, 9);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(BTreeSetTest, InitializerListAndIteration) {
+  s21::btree_set<int> s = {5, 1, 4, 1, 3, 2, 5};
+  ASSERT_EQ(s.size(), 5u);
+  ASSERT_EQ(std::vector<int>(s.begin(), s.end()),
+            (std::vector<int>{1, 2, 3, 4, 5}));
+  ASSERT_EQ(*--s.end(), 5);
+}
+
+TEST(BTreeSetTest, InsertEraseFind) {
+  s21::btree_set<std::string> s;
+  ASSERT_TRUE(s.insert("b").second);
+  ASSERT_FALSE(s.insert("b").second);
+  ASSERT_TRUE(s.emplace(3, 'a').second);
+  ASSERT_TRUE(s.contains("aaa"));
+  ASSERT_EQ(*s.find("b"), "b");
+  ASSERT_EQ(s.find("c"), s.end());
+  auto next = s.erase(s.find("aaa"));
+  ASSERT_EQ(*next, "b");
+  ASSERT_EQ(s.erase("b"), 1u);
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(BTreeSetTest, LargeRandomWorkloadMatchesStdSet) {
+  s21::btree_set<int> s;
+  std::set<int> reference;
+  unsigned state = 7;
+  for (int i = 0; i < 50000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>(state >> 16) % 4096;
+    if (state & 1) {
+      ASSERT_EQ(s.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(s.insert(key).second, reference.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), reference.size());
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), reference.begin(),
+                         reference.end()));
+}
+
+TEST(BTreeSetTest, BoundsAndEqualRange) {
+  s21::btree_set<int> s;
+  for (int i = 0; i < 500; ++i) s.insert(i * 10);
+  ASSERT_EQ(*s.lower_bound(15), 20);
+  ASSERT_EQ(*s.lower_bound(20), 20);
+  ASSERT_EQ(*s.upper_bound(20), 30);
+  ASSERT_EQ(s.lower_bound(4991), s.end());
+  auto [first, last] = s.equal_range(30);
+  ASSERT_EQ(*first, 30);
+  ASSERT_EQ(*last, 40);
+  ASSERT_EQ(s.count(30), 1u);
+  ASSERT_EQ(s.count(31), 0u);
+}
+
+TEST(BTreeSetTest, MergeAndSwap) {
+  s21::btree_set<int> a = {1, 2, 3};
+  s21::btree_set<int> b = {3, 4, 5};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 5u);
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_TRUE(b.contains(3));
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(b.size(), 5u);
+  s21::btree_set<int> c(b);
+  c.merge(c);
+  ASSERT_EQ(c.size(), 5u);
+}
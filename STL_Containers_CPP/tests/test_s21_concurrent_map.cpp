@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+class ConcurrentMapTest : public ::testing::Test {
+ protected:
+  using Map = s21::concurrent_map<int, int, 8>;
+
+  static std::vector<std::pair<int, int>> ordered(const Map& m) {
+    std::vector<std::pair<int, int>> values;
+    m.for_each_ordered([&values](const std::pair<const int, int>& value) {
+      values.emplace_back(value.first, value.second);
+    });
+    return values;
+  }
+};
+
+TEST_F(ConcurrentMapTest, EmptyMap) {
+  Map m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0u);
+  EXPECT_FALSE(m.find(1).has_value());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.erase(1), 0u);
+  EXPECT_TRUE(ordered(m).empty());
+  EXPECT_TRUE(m.snapshot().empty());
+}
+
+TEST_F(ConcurrentMapTest, InsertFindErase) {
+  Map m = {{3, 30}, {1, 10}, {2, 20}, {1, 11}};
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.find(1), 10);
+  EXPECT_FALSE(m.insert(2, 22));
+  EXPECT_TRUE(m.try_emplace(4, 40));
+  EXPECT_FALSE(m.insert_or_assign(4, 44));
+  EXPECT_TRUE(m.insert_or_assign(5, 50));
+  EXPECT_EQ(m.find(4), 44);
+  EXPECT_EQ(m.erase(3), 1u);
+  EXPECT_EQ(m.erase(3), 0u);
+  EXPECT_FALSE(m.contains(3));
+  EXPECT_EQ(ordered(m), (std::vector<std::pair<int, int>>{
+                            {1, 10}, {2, 20}, {4, 44}, {5, 50}}));
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST_F(ConcurrentMapTest, VisitAndUpdate) {
+  s21::concurrent_map<std::string, std::vector<int>> m;
+  m.try_emplace("a", 2, 7);
+  std::size_t seen = 0;
+  EXPECT_TRUE(m.visit("a", [&seen](const auto& value) {
+    seen = value.second.size();
+  }));
+  EXPECT_EQ(seen, 2u);
+  EXPECT_FALSE(m.visit("b", [](const auto&) {}));
+  EXPECT_TRUE(m.update("a", [](auto& value) { value.second.push_back(1); }));
+  EXPECT_FALSE(m.update("b", [](auto&) {}));
+  EXPECT_EQ(m.find("a")->size(), 3u);
+}
+
+TEST_F(ConcurrentMapTest, OrderedIterationMergesShards) {
+  Map m;
+  std::map<int, int> reference;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1000 - 500;
+    m.insert(key, i);
+    reference.emplace(key, i);
+  }
+  std::vector<std::pair<int, int>> expected(reference.begin(),
+                                            reference.end());
+  EXPECT_EQ(ordered(m), expected);
+  auto snapshot = m.snapshot();
+  EXPECT_EQ(snapshot.size(), reference.size());
+  EXPECT_TRUE(std::equal(snapshot.begin(), snapshot.end(), reference.begin()));
+  std::size_t count = 0;
+  m.for_each([&count](const auto&) { ++count; });
+  EXPECT_EQ(count, reference.size());
+}
+
+TEST_F(ConcurrentMapTest, ConcurrentCountersAndReaders) {
+  Map m;
+  const int threads = 8;
+  const int keys = 64;
+  const int rounds = 500;
+  for (int k = 0; k < keys; ++k) m.insert(k, 0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&m, t] {
+      for (int round = 0; round < rounds; ++round) {
+        for (int k = 0; k < keys; ++k) {
+          m.update(k, [](auto& value) { ++value.second; });
+        }
+        // churn keys no other thread counts on
+        int extra = keys + t;
+        if (round % 2 == 0) {
+          m.insert(extra, round);
+        } else {
+          m.erase(extra);
+        }
+        int previous = -1;
+        m.for_each_ordered([&previous](const auto& value) {
+          EXPECT_LT(previous, value.first);
+          previous = value.first;
+        });
+      }
+    });
+  }
+  for (auto& w : workers) w.join();
+  EXPECT_EQ(m.size(), static_cast<std::size_t>(keys));
+  for (int k = 0; k < keys; ++k) EXPECT_EQ(m.find(k), threads * rounds);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+class ConcurrentOrderedListTest : public ::testing::Test {
+ protected:
+  using List = s21::concurrent_ordered_list<int>;
+
+  static std::vector<int> to_vector(const List& list) {
+    return std::vector<int>(list.begin(), list.end());
+  }
+};
+
+TEST_F(ConcurrentOrderedListTest, EmptyList) {
+  List list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0u);
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_FALSE(list.contains(1));
+  EXPECT_FALSE(list.erase(1));
+}
+
+TEST_F(ConcurrentOrderedListTest, InsertKeepsOrderAndUniqueness) {
+  List list;
+  EXPECT_TRUE(list.insert(5));
+  EXPECT_TRUE(list.insert(1));
+  EXPECT_TRUE(list.insert(3));
+  EXPECT_FALSE(list.insert(3));
+  EXPECT_EQ(list.size(), 3u);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{1, 3, 5}));
+  EXPECT_TRUE(list.contains(3));
+  EXPECT_FALSE(list.contains(4));
+}
+
+TEST_F(ConcurrentOrderedListTest, Erase) {
+  List list;
+  for (int i = 0; i < 10; ++i) list.insert(i);
+  EXPECT_TRUE(list.erase(0));
+  EXPECT_TRUE(list.erase(9));
+  EXPECT_TRUE(list.erase(4));
+  EXPECT_FALSE(list.erase(4));
+  EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2, 3, 5, 6, 7, 8}));
+  EXPECT_TRUE(list.insert(4));
+  EXPECT_TRUE(list.contains(4));
+}
+
+TEST_F(ConcurrentOrderedListTest, CustomCompareAndStrings) {
+  s21::concurrent_ordered_list<std::string, std::greater<std::string>> list;
+  list.emplace("b");
+  list.emplace(3, 'a');
+  list.insert(std::string("c"));
+  std::vector<std::string> values(list.begin(), list.end());
+  EXPECT_EQ(values, (std::vector<std::string>{"c", "b", "aaa"}));
+}
+
+TEST_F(ConcurrentOrderedListTest, ConcurrentDisjointInserts) {
+  List list;
+  const int threads = 8;
+  const int per_thread = 500;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&list, t] {
+      for (int i = 0; i < per_thread; ++i) list.insert(i * threads + t);
+    });
+  }
+  for (auto& w : workers) w.join();
+  EXPECT_EQ(list.size(), static_cast<size_t>(threads * per_thread));
+  std::vector<int> values = to_vector(list);
+  ASSERT_EQ(values.size(), static_cast<size_t>(threads * per_thread));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], static_cast<int>(i));
+  }
+}
+
+TEST_F(ConcurrentOrderedListTest, ConcurrentInsertEraseSameKeys) {
+  List list;
+  const int threads = 8;
+  const int keys = 64;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&list, t] {
+      for (int round = 0; round < 200; ++round) {
+        for (int k = t % 2; k < keys; k += 2) {
+          if ((round + t) % 2 == 0) {
+            list.insert(k);
+          } else {
+            list.erase(k);
+          }
+        }
+        int previous = -1;
+        for (int value : list) {
+          EXPECT_LT(previous, value);
+          previous = value;
+        }
+      }
+    });
+  }
+  for (auto& w : workers) w.join();
+  std::vector<int> values = to_vector(list);
+  EXPECT_EQ(values.size(), list.size());
+  for (int k = 0; k < keys; ++k) list.erase(k);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.begin(), list.end());
+}
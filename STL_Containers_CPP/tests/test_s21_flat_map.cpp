@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(FlatMapTest, InitializerListSortsAndKeepsFirstDuplicate) {
+  s21::flat_map<int, std::string> m = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  ASSERT_EQ(m.size(), 3u);
+  std::vector<int> keys;
+  for (const auto& [key, value] : m) keys.push_back(key);
+  ASSERT_EQ(keys, (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(m.at(1), "a");
+  ASSERT_EQ(m.keys().size(), m.values().size());
+}
+
+TEST(FlatMapTest, AtSubscriptAndIteratorWrites) {
+  s21::flat_map<std::string, int> m;
+  m["one"] = 1;
+  m["two"] += 2;
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  for (auto it = m.begin(); it != m.end(); ++it) it->second *= 10;
+  const auto& cm = m;
+  ASSERT_EQ(cm.at("two"), 20);
+  ASSERT_EQ(cm.begin()->first, "one");
+  ASSERT_EQ((*(cm.end() - 1)).second, 20);
+  ASSERT_THROW(cm.at("zero"), std::out_of_range);
+}
+
+TEST(FlatMapTest, InsertVariants) {
+  s21::flat_map<int, std::string> m;
+  ASSERT_TRUE(m.insert({1, "a"}).second);
+  ASSERT_FALSE(m.insert({1, "b"}).second);
+  ASSERT_TRUE(m.insert(2, "b").second);
+  ASSERT_FALSE(m.insert(2, "c").second);
+  auto [it, inserted] = m.insert_or_assign(2, "c");
+  ASSERT_FALSE(inserted);
+  ASSERT_EQ(it->second, "c");
+  ASSERT_TRUE(m.insert_or_assign(3, "d").second);
+  ASSERT_TRUE(m.try_emplace(4, 3, 'x').second);
+  ASSERT_EQ(m.at(4), "xxx");
+  ASSERT_FALSE(m.emplace(4, "y").second);
+  ASSERT_EQ(m.emplace_hint(m.end(), 5, "e")->first, 5);
+  // a wrong hint is only ignored
+  ASSERT_EQ(m.insert(m.begin(), {7, "g"})->first, 7);
+  ASSERT_EQ(m.insert(m.end() - 1, {6, "f"})->first, 6);
+  ASSERT_EQ(m.size(), 7u);
+  int expected = 1;
+  for (const auto& [key, value] : m) ASSERT_EQ(key, expected++);
+}
+
+TEST(FlatMapTest, TryEmplaceLeavesArgumentsAlone) {
+  s21::flat_map<int, std::string> m = {{1, "a"}};
+  std::string value = "moved";
+  ASSERT_FALSE(m.try_emplace(1, std::move(value)).second);
+  ASSERT_EQ(value, "moved");
+}
+
+TEST(FlatMapTest, EraseReturnsNextAndCounts) {
+  s21::flat_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i * i;
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first % 2) {
+      it = m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_EQ(m.size(), 500u);
+  ASSERT_EQ(m.erase(10), 1u);
+  ASSERT_EQ(m.erase(11), 0u);
+  ASSERT_FALSE(m.contains(10));
+  ASSERT_EQ(m.at(998), 998 * 998);
+}
+
+TEST(FlatMapTest, LookupsMatchStdMap) {
+  std::vector<std::pair<int, int>> source;
+  std::map<int, int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    int key = (i * 7919) % 10007;
+    source.emplace_back(key, i);
+    reference.emplace(key, i);
+  }
+  s21::flat_map<int, int> m(source.begin(), source.end());
+  ASSERT_EQ(m.size(), reference.size());
+  for (int key = -1; key < 10010; ++key) {
+    ASSERT_EQ(m.contains(key), reference.count(key) == 1);
+    auto lower = m.lower_bound(key);
+    auto expected = reference.lower_bound(key);
+    ASSERT_EQ(lower == m.end(), expected == reference.end());
+    if (expected != reference.end()) {
+      ASSERT_EQ(lower->first, expected->first);
+    }
+    auto upper = m.upper_bound(key);
+    auto expected_upper = reference.upper_bound(key);
+    ASSERT_EQ(upper - m.begin(),
+              std::distance(reference.begin(), expected_upper));
+    auto [first, last] = m.equal_range(key);
+    ASSERT_EQ(last - first, static_cast<long>(reference.count(key)));
+  }
+  auto it = m.begin();
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(it->first, key);
+    ASSERT_EQ(it->second, value);
+    ++it;
+  }
+}
+
+TEST(FlatMapTest, InsertRangeMergesInOnePass) {
+  s21::flat_map<int, std::string> m = {{2, "b"}, {4, "d"}, {6, "f"}};
+  std::vector<std::pair<int, std::string>> batch = {
+      {5, "e"}, {4, "x"}, {1, "a"}, {5, "y"}, {9, "i"}};
+  m.insert_range(batch);
+  ASSERT_EQ(m.size(), 6u);
+  ASSERT_EQ(m.at(4), "d");
+  ASSERT_EQ(m.at(5), "e");
+  ASSERT_EQ(m.begin()->first, 1);
+  // past the last key the batch is only appended
+  m.insert_range(std::vector<std::pair<int, std::string>>{{11, "k"},
+                                                          {10, "j"}});
+  ASSERT_EQ((m.end() - 1)->first, 11);
+  ASSERT_EQ((m.end() - 2)->second, "j");
+
+  std::map<int, int> reference;
+  s21::flat_map<int, int> random;
+  std::mt19937 rng(7);
+  for (int round = 0; round < 50; ++round) {
+    std::vector<std::pair<int, int>> chunk;
+    for (int i = 0; i < 100; ++i) {
+      int key = static_cast<int>(rng() % 3000);
+      chunk.emplace_back(key, round);
+      reference.emplace(key, round);
+    }
+    random.insert(chunk.begin(), chunk.end());
+  }
+  ASSERT_EQ(random.size(), reference.size());
+  for (const auto& [key, value] : reference) ASSERT_EQ(random.at(key), value);
+}
+
+TEST(FlatMapTest, SortedUniqueConstructors) {
+  std::vector<std::pair<int, int>> sorted = {{1, 1}, {2, 4}, {3, 9}};
+  s21::flat_map<int, int> m(s21::sorted_unique, sorted.begin(), sorted.end());
+  ASSERT_EQ(m.at(3), 9);
+  s21::flat_map<int, int> adopted(s21::sorted_unique, s21::vector<int>{1, 2},
+                                  s21::vector<int>{5, 6});
+  ASSERT_EQ(adopted.at(2), 6);
+  std::vector<std::pair<int, int>> unsorted = {{2, 4}, {1, 1}};
+  ASSERT_THROW((s21::flat_map<int, int>(s21::sorted_unique, unsorted.begin(),
+                                        unsorted.end())),
+               std::invalid_argument);
+  ASSERT_THROW((s21::flat_map<int, int>(s21::sorted_unique,
+                                        s21::vector<int>{1, 2},
+                                        s21::vector<int>{1})),
+               std::invalid_argument);
+}
+
+TEST(FlatMapTest, MergeCopyMoveAndSwap) {
+  s21::flat_map<int, std::string> a = {{1, "a"}, {3, "c"}};
+  s21::flat_map<int, std::string> b = {{1, "x"}, {2, "b"}, {4, "d"}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.at(1), "a");
+  ASSERT_EQ(a.at(2), "b");
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_EQ(b.at(1), "x");
+  s21::flat_map<int, std::string> copy(a);
+  s21::flat_map<int, std::string> moved(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(moved.at(4), "d");
+  a.swap(moved);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_TRUE(moved.empty());
+  moved = copy;
+  ASSERT_EQ(moved.at(3), "c");
+  moved.clear();
+  ASSERT_EQ(moved.begin(), moved.end());
+}
+
+TEST(FlatMapTest, TransparentLookupAndFromRange) {
+  s21::flat_map<std::string, int, std::less<>> m = {{"apple", 1},
+                                                    {"pear", 2}};
+  std::string_view key = "pear";
+  ASSERT_TRUE(m.contains(key));
+  ASSERT_EQ(m.find(key)->second, 2);
+  ASSERT_EQ(m.lower_bound(std::string_view("b"))->first, "pear");
+  std::vector<std::pair<int, int>> source = {{2, 4}, {1, 1}, {3, 9}};
+  s21::flat_map<int, int> r(s21::from_range, source);
+  ASSERT_EQ(r.begin()->first, 1);
+  ASSERT_EQ((--r.end())->second, 9);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(FlatSetTest, ConstructionSortsAndDedupes) {
+  s21::flat_set<int> s = {5, 1, 4, 1, 5, 9, 2, 6};
+  ASSERT_EQ(s.size(), 6u);
+  ASSERT_TRUE(std::is_sorted(s.begin(), s.end()));
+  std::vector<int> source = {3, 3, 2};
+  s21::flat_set<int> r(s21::from_range, source);
+  ASSERT_EQ(r.size(), 2u);
+  s21::flat_set<int> sorted(s21::sorted_unique, s21::vector<int>{1, 2, 3});
+  ASSERT_EQ(*sorted.find(2), 2);
+  ASSERT_THROW((s21::flat_set<int>(s21::sorted_unique, source.begin(),
+                                   source.end())),
+               std::invalid_argument);
+}
+
+TEST(FlatSetTest, InsertEraseMatchStdSet) {
+  s21::flat_set<int> s;
+  std::set<int> reference;
+  std::mt19937 rng(3);
+  for (int round = 0; round < 5000; ++round) {
+    int key = static_cast<int>(rng() % 500);
+    if (rng() % 3 == 0) {
+      std::size_t erased = s.erase(key);
+      ASSERT_EQ(erased, reference.erase(key));
+    } else {
+      auto [it, inserted] = s.insert(key);
+      ASSERT_EQ(inserted, reference.insert(key).second);
+      ASSERT_EQ(*it, key);
+    }
+  }
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), reference.begin(),
+                         reference.end()));
+  for (int key = -1; key < 502; ++key) {
+    ASSERT_EQ(s.contains(key), reference.count(key) == 1);
+    ASSERT_EQ(s.lower_bound(key) - s.begin(),
+              std::distance(reference.begin(), reference.lower_bound(key)));
+    ASSERT_EQ(s.upper_bound(key) - s.begin(),
+              std::distance(reference.begin(), reference.upper_bound(key)));
+    auto [first, last] = s.equal_range(key);
+    ASSERT_EQ(last - first, static_cast<long>(reference.count(key)));
+  }
+}
+
+TEST(FlatSetTest, InsertRangeAndMerge) {
+  s21::flat_set<std::string> s = {"b", "d"};
+  s.insert_range(std::vector<std::string>{"e", "a", "d", "c", "a"});
+  ASSERT_EQ(s.size(), 5u);
+  ASSERT_EQ(*s.begin(), "a");
+  ASSERT_EQ(*(s.end() - 1), "e");
+  s21::flat_set<std::string> other = {"a", "f", "z"};
+  s.merge(other);
+  ASSERT_EQ(s.size(), 7u);
+  ASSERT_EQ(other.size(), 1u);
+  ASSERT_EQ(*other.begin(), "a");
+  auto next = s.erase(s.find("c"));
+  ASSERT_EQ(*next, "d");
+  auto inserted = s.insert(s.find("e"), "dd");
+  ASSERT_EQ(inserted, s.find("dd"));
+}
+
+TEST(FlatSetTest, CopyMoveSwapAndTransparentLookup) {
+  s21::flat_set<std::string, std::less<>> a = {"apple", "pear"};
+  s21::flat_set<std::string, std::less<>> b(a);
+  s21::flat_set<std::string, std::less<>> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(c.contains(std::string_view("pear")));
+  ASSERT_EQ(*c.lower_bound(std::string_view("b")), "pear");
+  a.swap(c);
+  ASSERT_EQ(a.size(), 2u);
+  c = b;
+  ASSERT_TRUE(std::equal(b.begin(), b.end(), c.begin(), c.end()));
+  ASSERT_EQ(*c.emplace(3, 'z').first, "zzz");
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+template <typename Range>
+std::vector<std::string> values_of(Range&& range) {
+  std::vector<std::string> values;
+  for (const auto& item : range) values.push_back(item.second);
+  return values;
+}
+
+}  // namespace
+
+TEST(IntervalMapTest, FindOverlappingIsHalfOpen) {
+  s21::interval_map<int, std::string> m = {
+      {{0, 10}, "a"}, {{5, 7}, "b"}, {{10, 20}, "c"}, {{15, 16}, "d"}};
+  ASSERT_EQ(m.size(), 4u);
+  ASSERT_EQ(values_of(m.find_overlapping(6, 11)),
+            (std::vector<std::string>{"a", "b", "c"}));
+  ASSERT_EQ(values_of(m.find_overlapping(7, 10)),
+            (std::vector<std::string>{"a"}));
+  ASSERT_EQ(values_of(m.find_overlapping(20, 30)), std::vector<std::string>{});
+  ASSERT_EQ(values_of(m.find_overlapping(-5, 0)), std::vector<std::string>{});
+  // an empty query overlaps nothing
+  ASSERT_TRUE(m.find_overlapping(5, 5).empty());
+  ASSERT_TRUE(m.overlaps(19, 25));
+  ASSERT_FALSE(m.overlaps(20, 25));
+}
+
+TEST(IntervalMapTest, StabContainsStartButNotEnd) {
+  s21::interval_map<int, std::string> m;
+  m.insert(0, 10, "a");
+  m.insert(10, 20, "b");
+  m.insert(0, 10, "a2");
+  ASSERT_EQ(values_of(m.stab(0)), (std::vector<std::string>{"a", "a2"}));
+  ASSERT_EQ(values_of(m.stab(10)), (std::vector<std::string>{"b"}));
+  ASSERT_TRUE(m.stab(20).empty());
+  const auto& cm = m;
+  ASSERT_EQ(values_of(cm.stab(9)), (std::vector<std::string>{"a", "a2"}));
+}
+
+TEST(IntervalMapTest, EraseAndWriteThroughOverlaps) {
+  s21::interval_map<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i + 10, i);
+  for (auto& item : m.find_overlapping(50, 51)) item.second = -1;
+  ASSERT_EQ(m.find({41, 51})->second, -1);
+  ASSERT_EQ(m.find({40, 50})->second, 40);
+  auto hits = m.stab(50);
+  ASSERT_EQ(std::ranges::distance(hits), 10);
+  m.erase(hits.begin().base());
+  ASSERT_EQ(std::ranges::distance(m.stab(50)), 9);
+  ASSERT_EQ(m.erase({45, 55}), 1u);
+  ASSERT_EQ(m.erase({45, 55}), 0u);
+  ASSERT_EQ(m.count({46, 56}), 1u);
+  ASSERT_EQ(std::ranges::distance(m.stab(50)), 8);
+  ASSERT_EQ(m.size(), 98u);
+}
+
+TEST(IntervalMapTest, LazyWalkStopsEarly) {
+  s21::interval_map<long, long> m;
+  for (long i = 0; i < 100000; ++i) m.insert(i, i + 1000, i);
+  auto range = m.find_overlapping(50000, 60000);
+  auto it = range.begin();
+  ASSERT_EQ(it->first.lo, 49001);
+  ++it;
+  ASSERT_EQ((it++)->first.lo, 49002);
+  ASSERT_EQ(it->first.lo, 49003);
+  ASSERT_EQ(std::ranges::distance(range), 10999);
+}
+
+TEST(IntervalMapTest, RandomQueriesMatchLinearScan) {
+  std::mt19937 rng(48);
+  s21::interval_map<int, int> m;
+  std::vector<std::pair<s21::interval<int>, int>> all;
+  auto check = [&](int lo, int hi, bool stab) {
+    std::vector<int> expected;
+    for (const auto& [range, id] : all) {
+      bool hit = stab ? range.lo <= lo && lo < range.hi
+                      : range.lo < hi && lo < range.hi && lo < hi;
+      if (hit) expected.push_back(id);
+    }
+    std::vector<int> got;
+    auto found = stab ? m.stab(lo) : m.find_overlapping(lo, hi);
+    for (const auto& item : found) got.push_back(item.second);
+    std::sort(expected.begin(), expected.end());
+    std::sort(got.begin(), got.end());
+    ASSERT_EQ(got, expected);
+  };
+  for (int i = 0; i < 4000; ++i) {
+    int lo = static_cast<int>(rng() % 10000);
+    int hi = lo + static_cast<int>(rng() % (i % 2 ? 50 : 2000));
+    if (rng() % 4 == 0 && !all.empty()) {
+      std::size_t victim = rng() % all.size();
+      auto it = m.find(all[victim].first);
+      while (it->second != all[victim].second) ++it;
+      m.erase(it);
+      all.erase(all.begin() + static_cast<std::ptrdiff_t>(victim));
+    } else {
+      m.insert(lo, hi, i);
+      all.push_back({{lo, hi}, i});
+    }
+    if (i % 50 == 0) {
+      check(lo, lo + static_cast<int>(rng() % 300), false);
+      check(static_cast<int>(rng() % 10000), 0, true);
+    }
+  }
+  ASSERT_EQ(m.size(), all.size());
+  const s21::interval_map<int, int> copy = m;
+  ASSERT_EQ(std::ranges::distance(copy.find_overlapping(0, 20000)),
+            static_cast<std::ptrdiff_t>(all.size()));
+}
+
+namespace {
+
+struct EndByRef {
+  const int& operator()(const std::pair<const s21::interval<int>, int>& value)
+      const {
+    return value.first.hi;
+  }
+};
+
+struct EndByValue {
+  int operator()(const std::pair<const s21::interval<int>, int>& value) const {
+    return value.first.hi;
+  }
+};
+
+template <typename Augment>
+concept updatable = requires(
+    s21::TreeNode<std::pair<const s21::interval<int>, int>, Augment>* node) {
+  Augment::update(node);
+};
+
+}  // namespace
+
+TEST(IntervalMapTest, MaxEndRejectsEndsReturnedByValue) {
+  static_assert(updatable<s21::SubtreeMaxEnd<int, EndByRef, std::less<int>>>);
+  static_assert(
+      !updatable<s21::SubtreeMaxEnd<int, EndByValue, std::less<int>>>);
+}
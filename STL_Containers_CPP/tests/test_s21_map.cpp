@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <map>
+#include <random>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "../containers/tree/s21_tree_node_arena_links.h"
 #include "../s21_containers.h"
 
 // --- CONSTRUCTORS AND ASSIGNMENT ---
@@ -208,4 +215,358 @@ TEST(MapTest, FindAndContains) {
 
   ASSERT_TRUE(m.contains(100));
   ASSERT_FALSE(m.contains(5));
-}
\ No newline at end of file
+}
+
+TEST(MapTest, IteratorPairConstructor) {
+  std::vector<std::pair<int, std::string>> source = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  s21::map<int, std::string> m(source.begin(), source.end());
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.at(1), "one");
+  ASSERT_EQ(m.begin()->first, 1);
+}
+
+TEST(MapTest, FromRangeConstructorAndAssign) {
+  std::map<int, int> source;
+  for (int i = 0; i < 100; ++i) source[i] = i * i;
+  s21::map<int, int> m(s21::from_range, source);
+  ASSERT_EQ(m.size(), 100u);
+  ASSERT_EQ(m.at(9), 81);
+  ASSERT_EQ((--m.end())->first, 99);
+  std::vector<std::pair<int, int>> other = {{5, 1}, {6, 2}};
+  m.assign(other.begin(), other.end());
+  ASSERT_EQ(m.size(), 2u);
+  ASSERT_EQ(m.at(6), 2);
+  ASSERT_FALSE(m.contains(9));
+}
+
+TEST(MapTest, SortedUniqueConstructor) {
+  std::vector<std::pair<int, std::string>> source;
+  for (int i = 0; i < 100; ++i) source.emplace_back(i * 3, std::to_string(i));
+  s21::map<int, std::string> m(s21::sorted_unique, source.begin(),
+                               source.end());
+  ASSERT_EQ(m.size(), 100u);
+  ASSERT_EQ(m.at(99), "33");
+  ASSERT_EQ(m.begin()->first, 0);
+  m.insert(1, "x");
+  ASSERT_EQ(m.size(), 101u);
+}
+
+TEST(MapTest, EmplaceHint) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 50; ++i) {
+    m.emplace_hint(m.end(), i, std::to_string(i));
+  }
+  auto it = m.insert(m.find(10), {5, "dup"});
+  ASSERT_EQ(it->second, "5");
+  it = m.emplace_hint(m.begin(), -1, "neg");
+  ASSERT_EQ(m.begin(), it);
+  ASSERT_EQ(m.size(), 51u);
+  ASSERT_EQ(m.at(49), "49");
+}
+
+TEST(MapTest, BoundsAndRange) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 100; i += 10) m.insert(i, std::to_string(i));
+  ASSERT_EQ(m.lower_bound(25)->first, 30);
+  ASSERT_EQ(m.upper_bound(30)->first, 40);
+  auto [first, last] = m.equal_range(50);
+  ASSERT_EQ(first->second, "50");
+  ASSERT_EQ(last->first, 60);
+  int total = 0;
+  for (auto& [key, value] : m.range(20, 60)) {
+    total += key;
+    value += "!";
+  }
+  ASSERT_EQ(total, 20 + 30 + 40 + 50);
+  ASSERT_EQ(m.at(40), "40!");
+  ASSERT_EQ(m.at(60), "60");
+  const auto& cm = m;
+  ASSERT_EQ(cm.lower_bound(95), cm.end());
+  ASSERT_TRUE(cm.range(61, 69).empty());
+}
+
+TEST(MapTest, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> m;
+  m.insert("alpha", 1);
+  m.insert("beta", 2);
+  m.insert("gamma", 3);
+  std::string_view key = "beta";
+  ASSERT_EQ(m.find(key)->second, 2);
+  ASSERT_TRUE(m.contains("gamma"));
+  ASSERT_FALSE(m.contains(std::string_view("delta")));
+  ASSERT_EQ(m.count("alpha"), 1u);
+  ASSERT_EQ(m.count("omega"), 0u);
+  ASSERT_EQ(m.lower_bound("b")->first, "beta");
+  ASSERT_EQ(m.upper_bound(key)->first, "gamma");
+  auto [first, last] = m.equal_range(std::string_view("gamma"));
+  ASSERT_EQ(first->second, 3);
+  ASSERT_EQ(last, m.end());
+  const auto& cm = m;
+  ASSERT_EQ(cm.find("zzz"), cm.end());
+}
+
+namespace {
+struct CountedValue {
+  static inline int constructed = 0;
+  int value = 0;
+  CountedValue() { ++constructed; }
+  explicit CountedValue(int v) : value(v) { ++constructed; }
+  CountedValue(const CountedValue& other) : value(other.value) {
+    ++constructed;
+  }
+  CountedValue& operator=(const CountedValue&) = default;
+};
+}  // namespace
+
+TEST(MapTest, LookupBeforeAllocate) {
+  s21::map<int, CountedValue> m;
+  m.try_emplace(1, 10);
+  m[2].value = 20;
+  CountedValue::constructed = 0;
+
+  auto [it, inserted] = m.try_emplace(1, 99);
+  ASSERT_FALSE(inserted);
+  ASSERT_EQ(it->second.value, 10);
+  m[2].value += 1;
+  ASSERT_FALSE(m.insert(1, CountedValue(5)).second);
+  ASSERT_EQ(CountedValue::constructed, 1);  // only the argument above
+
+  CountedValue::constructed = 0;
+  auto assigned = m.insert_or_assign(2, CountedValue(7));
+  ASSERT_FALSE(assigned.second);
+  ASSERT_EQ(assigned.first->second.value, 7);
+  ASSERT_EQ(CountedValue::constructed, 1);
+
+  ASSERT_TRUE(m.insert_or_assign(3, CountedValue(3)).second);
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.at(2).value, 7);
+}
+
+TEST(MapTest, TryEmplaceMovesKeyOnlyOnInsert) {
+  s21::map<std::string, std::string> m;
+  std::string key(40, 'k');
+  m.try_emplace(std::move(key), 3, 'v');
+  ASSERT_EQ(m.at(std::string(40, 'k')), "vvv");
+  std::string again(40, 'k');
+  ASSERT_FALSE(m.try_emplace(std::move(again), "other").second);
+  ASSERT_EQ(again, std::string(40, 'k'));
+  std::string fresh = "fresh";
+  m[std::move(fresh)] = "x";
+  ASSERT_EQ(m.at("fresh"), "x");
+}
+
+TEST(MapTest, MergeKeepsExistingValues) {
+  s21::map<int, std::string> a = {{1, "a1"}, {2, "a2"}};
+  s21::map<int, std::string> b = {{2, "b2"}, {3, "b3"}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_EQ(a.at(2), "a2");
+  ASSERT_EQ(a.at(3), "b3");
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_EQ(b.at(2), "b2");
+}
+
+// Merged maps keep separate pools, so each can be used on its own thread
+// (run under -fsanitize=thread to check).
+TEST(MapTest, MergedMapsStayIndependent) {
+  s21::map<int, int> a;
+  s21::map<int, int> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.insert(2 * i, i);
+    b.insert(2 * i + (i % 2), i);
+  }
+  a.merge(b);
+  ASSERT_EQ(a.size(), 1500u);
+  ASSERT_EQ(b.size(), 500u);
+  auto churn = [](s21::map<int, int>& m, int base) {
+    for (int i = 0; i < 20000; ++i) {
+      m.insert(base + i, i);
+      m.erase(m.find(base + i));
+    }
+  };
+  std::thread ta(churn, std::ref(a), 100000);
+  std::thread tb(churn, std::ref(b), 200000);
+  ta.join();
+  tb.join();
+  ASSERT_EQ(a.size(), 1500u);
+  ASSERT_EQ(b.size(), 500u);
+  a.clear();
+  ASSERT_EQ(b.at(0), 0);
+}
+
+TEST(MapTest, SetAlgebraTakesValuesFromFirst) {
+  s21::map<int, std::string> a = {{1, "a1"}, {2, "a2"}, {3, "a3"}};
+  s21::map<int, std::string> b = {{2, "b2"}, {4, "b4"}};
+  auto u = s21::set_union(a, b);
+  ASSERT_EQ(u.size(), 4u);
+  ASSERT_EQ(u.at(2), "a2");
+  ASSERT_EQ(u.at(4), "b4");
+  auto i = s21::set_intersection(b, a);
+  ASSERT_EQ(i.size(), 1u);
+  ASSERT_EQ(i.at(2), "b2");
+  auto d = s21::set_difference(a, b);
+  ASSERT_EQ(d.size(), 2u);
+  ASSERT_FALSE(d.contains(2));
+}
+
+TEST(MapTest, ExtractAndRekey) {
+  s21::map<int, std::string> m = {{1, "one"}, {2, "two"}, {3, "three"}};
+  const std::string* address = &m.at(2);
+  auto handle = m.extract(2);
+  ASSERT_FALSE(handle.empty());
+  ASSERT_EQ(m.size(), 2u);
+  ASSERT_FALSE(m.contains(2));
+  handle.key() = 20;
+  handle.mapped() += "!";
+  auto result = m.insert(std::move(handle));
+  ASSERT_TRUE(result.inserted);
+  ASSERT_TRUE(result.node.empty());
+  ASSERT_EQ(result.position->first, 20);
+  ASSERT_EQ(&m.at(20), address);
+  ASSERT_EQ(m.at(20), "two!");
+  ASSERT_TRUE(m.extract(42).empty());
+}
+
+TEST(MapTest, NodeHandleBetweenMaps) {
+  s21::map<int, std::string> shard_a = {{1, "a"}, {2, "b"}};
+  s21::map<int, std::string> shard_b = {{2, "other"}};
+  auto moved = shard_b.insert(shard_a.extract(shard_a.find(1)));
+  ASSERT_TRUE(moved.inserted);
+  ASSERT_EQ(shard_b.at(1), "a");
+  // duplicate key: the handle comes back and still owns the element
+  auto failed = shard_b.insert(shard_a.extract(2));
+  ASSERT_FALSE(failed.inserted);
+  ASSERT_EQ(failed.position->second, "other");
+  ASSERT_EQ(failed.node.key(), 2);
+  ASSERT_EQ(failed.node.mapped(), "b");
+  shard_a.insert(shard_a.end(), std::move(failed.node));
+  ASSERT_EQ(shard_a.at(2), "b");
+  ASSERT_TRUE(shard_a.insert(s21::map<int, std::string>::node_type())
+                  .position == shard_a.end());
+}
+
+TEST(MapTest, NodeHandleKeepsNodeBetweenDefaultMaps) {
+  s21::map<int, std::string> shard_a = {{5, std::string(64, 'p')}, {6, "q"}};
+  s21::map<int, std::string> shard_b = {{1, "r"}};
+  const std::string* five = &shard_a.at(5);
+  const std::string* six = &shard_a.at(6);
+  ASSERT_TRUE(shard_b.insert(shard_a.extract(5)).inserted);
+  ASSERT_EQ(&shard_b.at(5), five);
+  shard_b.insert(shard_b.end(), shard_a.extract(6));
+  ASSERT_EQ(&shard_b.at(6), six);
+  ASSERT_TRUE(shard_a.empty());
+  ASSERT_EQ(shard_b.size(), 3u);
+}
+
+// Shards on one pool relink nodes; they share that pool, so they must be
+// used under one lock.
+TEST(MapTest, NodeHandleKeepsNodeBetweenShardsSharingAPool) {
+  using Alloc = s21::node_pool_allocator<std::pair<const int, std::string>>;
+  using Map = s21::map<int, std::string, std::less<int>, Alloc>;
+  Alloc pool;
+  Map shard_a(std::less<int>(), pool);
+  Map shard_b(std::less<int>(), pool);
+  shard_a.insert(5, std::string(64, 'p'));
+  const std::string* address = &shard_a.at(5);
+  auto result = shard_b.insert(shard_a.extract(5));
+  ASSERT_TRUE(result.inserted);
+  ASSERT_EQ(&shard_b.at(5), address);
+}
+
+// keys tying on the first 8 or 16 bytes, shorter ones and embedded NULs
+template <typename KeyPrefix>
+void check_key_prefix_against_std_map() {
+  s21::map<std::string, int, std::less<>,
+           s21::node_pool_allocator<std::pair<const std::string, int>>,
+           s21::PointerLinks, KeyPrefix>
+      m;
+  std::map<std::string, int, std::less<>> expected;
+  std::mt19937 rng(50);
+  const std::string stems[] = {"", "https://", "https://example.com/",
+                               std::string("ab\0", 3)};
+  auto random_key = [&] {
+    std::string key = stems[rng() % 4];
+    for (unsigned n = rng() % 24; n > 0; --n) {
+      key += "a\0b\xff"[rng() % 4];
+    }
+    return key;
+  };
+  for (int i = 0; i < 4000; ++i) {
+    std::string key = random_key();
+    if (rng() % 3 == 0) {
+      auto it = m.find(key);
+      ASSERT_EQ(it != m.end(), expected.erase(key) == 1);
+      if (it != m.end()) m.erase(it);
+    } else {
+      ASSERT_EQ(m.insert(key, i).second, expected.insert({key, i}).second);
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end(),
+                         [](const auto& a, const auto& b) {
+                           return a.first == b.first && a.second == b.second;
+                         }));
+  for (int i = 0; i < 2000; ++i) {
+    std::string key = random_key();
+    std::string_view view = key;
+    ASSERT_EQ(m.contains(view), expected.contains(key));
+    auto lower = m.lower_bound(view);
+    auto want = expected.lower_bound(key);
+    ASSERT_EQ(lower == m.end(), want == expected.end());
+    if (want != expected.end()) {
+      ASSERT_EQ(lower->first, want->first);
+    }
+    auto upper = m.upper_bound(key);
+    want = expected.upper_bound(key);
+    ASSERT_EQ(upper == m.end(), want == expected.end());
+    if (want != expected.end()) {
+      ASSERT_EQ(upper->first, want->first);
+    }
+  }
+}
+
+TEST(MapTest, KeyPrefixLookupsMatchStdMap) {
+  check_key_prefix_against_std_map<s21::StringKeyPrefix<8>>();
+  check_key_prefix_against_std_map<s21::StringKeyPrefix<16>>();
+}
+
+TEST(MapTest, KeyPrefixFollowsRekeyedNode) {
+  s21::map<std::string, int, std::less<std::string>,
+           s21::node_pool_allocator<std::pair<const std::string, int>>,
+           s21::PointerLinks, s21::StringKeyPrefix<>>
+      m = {{"apple", 1}, {"banana", 2}, {"cherry", 3}};
+  auto handle = m.extract("banana");
+  handle.key() = "zucchini";
+  ASSERT_TRUE(m.insert(std::move(handle)).inserted);
+  ASSERT_EQ(m.at("zucchini"), 2);
+  ASSERT_FALSE(m.contains("banana"));
+  handle = m.extract("apple");
+  handle.key() = "date";
+  m.insert(m.end(), std::move(handle));
+  ASSERT_EQ(m.lower_bound("d")->first, "date");
+  ASSERT_EQ(m.upper_bound("date")->first, "zucchini");
+}
+
+TEST(MapTest, ArenaIndexLinks) {
+  using Map = s21::map<std::string, int, std::less<std::string>,
+                       std::allocator<std::pair<const std::string, int>>,
+                       s21::ArenaIndexLinks>;
+  Map m;
+  std::map<std::string, int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    std::string key = std::to_string((i * 389) % 700);
+    ASSERT_EQ(m.insert_or_assign(key, i).second,
+              expected.insert_or_assign(key, i).second);
+  }
+  for (int i = 0; i < 700; i += 3) {
+    m.erase(m.find(std::to_string(i)));
+    expected.erase(std::to_string(i));
+  }
+  Map copy(m);
+  ASSERT_EQ(copy.size(), expected.size());
+  ASSERT_TRUE(std::equal(copy.begin(), copy.end(), expected.begin(),
+                         expected.end()));
+  Map diff = s21::set_difference(copy, m);
+  ASSERT_TRUE(diff.empty());
+}
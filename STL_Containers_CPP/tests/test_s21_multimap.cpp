@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(MultimapTest, EqualKeysKeepInsertionOrder) {
+  s21::multimap<int, std::string> m = {
+      {2, "b1"}, {1, "a1"}, {2, "b2"}, {3, "c1"}, {2, "b3"}, {1, "a2"}};
+  ASSERT_EQ(m.size(), 6u);
+  std::vector<std::pair<int, std::string>> got(m.begin(), m.end());
+  ASSERT_EQ(got, (std::vector<std::pair<int, std::string>>{{1, "a1"},
+                                                           {1, "a2"},
+                                                           {2, "b1"},
+                                                           {2, "b2"},
+                                                           {2, "b3"},
+                                                           {3, "c1"}}));
+  ASSERT_EQ(m.find(2)->second, "b1");
+  ASSERT_EQ(m.count(2), 3u);
+  ASSERT_EQ(m.count(4), 0u);
+  ASSERT_FALSE(m.contains(0));
+}
+
+TEST(MultimapTest, InsertVariantsAlwaysInsert) {
+  s21::multimap<int, std::string> m;
+  ASSERT_EQ(m.insert({1, "a"})->second, "a");
+  ASSERT_EQ(m.insert({1, "b"})->second, "b");
+  ASSERT_EQ(m.insert(1, "c")->second, "c");
+  ASSERT_EQ(m.emplace(1, "d")->second, "d");
+  ASSERT_EQ(m.emplace_hint(m.end(), 1, "e")->second, "e");
+  ASSERT_EQ(m.size(), 5u);
+  std::string order;
+  for (const auto& [key, value] : m) order += value;
+  ASSERT_EQ(order, "abcde");
+}
+
+TEST(MultimapTest, HintedInsert) {
+  s21::multimap<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert(m.end(), {i / 10, i});
+  ASSERT_EQ(m.size(), 100u);
+  int expected = 0;
+  for (const auto& [key, value] : m) {
+    ASSERT_EQ(key, expected / 10);
+    ASSERT_EQ(value, expected++);
+  }
+  // a hint right before an equal run places the element at the hint
+  auto it = m.insert(m.find(5), {5, -1});
+  ASSERT_EQ(std::prev(it)->first, 4);
+  ASSERT_EQ(m.find(5)->second, -1);
+  // a wrong hint is only ignored
+  it = m.insert(m.begin(), {7, 1000});
+  ASSERT_EQ(it->second, 1000);
+  ASSERT_EQ(std::prev(it)->second, 79);
+  ASSERT_EQ(m.count(7), 11u);
+}
+
+TEST(MultimapTest, EqualRangeAndEraseByKey) {
+  s21::multimap<int, int> m;
+  for (int i = 0; i < 30; ++i) m.insert(i % 3, i);
+  auto [first, last] = m.equal_range(1);
+  int n = 0;
+  for (; first != last; ++first, ++n) ASSERT_EQ(first->second, 1 + 3 * n);
+  ASSERT_EQ(n, 10);
+  ASSERT_EQ(m.erase(1), 10u);
+  ASSERT_EQ(m.erase(1), 0u);
+  ASSERT_EQ(m.size(), 20u);
+  ASSERT_EQ(m.lower_bound(1)->first, 2);
+  ASSERT_EQ(m.upper_bound(0)->first, 2);
+  ASSERT_EQ(m.erase(m.begin())->second, 3);
+  const auto& cm = m;
+  ASSERT_EQ(cm.equal_range(0).first->second, 3);
+  ASSERT_EQ(std::ranges::distance(cm.range(0, 3)), 19);
+}
+
+TEST(MultimapTest, MergeAppendsOthersAfterOurs) {
+  s21::multimap<int, std::string> a = {{1, "a1"}, {2, "a2"}};
+  s21::multimap<int, std::string> b = {{1, "b1"}, {2, "b2"}, {3, "b3"}};
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  std::string order;
+  for (const auto& [key, value] : a) order += value;
+  ASSERT_EQ(order, "a1b1a2b2b3");
+}
+
+TEST(MultimapTest, NodeHandlesMoveOneElement) {
+  s21::multimap<int, std::string> a = {{1, "x"}, {1, "y"}};
+  s21::multimap<int, std::string> b = {{1, "z"}};
+  auto node = a.extract(1);
+  ASSERT_EQ(node.mapped(), "x");
+  ASSERT_EQ(b.insert(std::move(node))->second, "x");
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(b.count(1), 2u);
+  ASSERT_EQ(b.begin()->second, "z");
+}
+
+TEST(MultimapTest, TransparentLookup) {
+  s21::multimap<std::string, int, std::less<>> m = {
+      {"x", 1}, {"y", 2}, {"x", 3}};
+  ASSERT_EQ(m.count("x"), 2u);
+  ASSERT_TRUE(m.contains("y"));
+  ASSERT_EQ(m.find("x")->second, 1);
+  auto [first, last] = m.equal_range("x");
+  ASSERT_EQ(std::distance(first, last), 2);
+}
+
+TEST(MultimapTest, RandomOperationsMatchStdMultimap) {
+  std::mt19937 rng(47);
+  s21::multimap<int, int> m;
+  std::multimap<int, int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 200);
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        m.insert(key, i);
+        expected.emplace(key, i);
+        break;
+      case 2:
+        m.insert(m.lower_bound(key), {key, i});
+        expected.emplace_hint(expected.lower_bound(key), key, i);
+        break;
+      default:
+        if (rng() % 8 == 0) {
+          ASSERT_EQ(m.erase(key), expected.erase(key));
+        } else if (auto it = m.find(key); it != m.end()) {
+          m.erase(it);
+          expected.erase(expected.find(key));
+        }
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end()));
+}
+
+TEST(MultimapTest, SortedAndUnsortedRangeConstruction) {
+  std::vector<std::pair<int, int>> sorted;
+  for (int i = 0; i < 1000; ++i) sorted.emplace_back(i / 4, i);
+  s21::multimap<int, int> a(sorted.begin(), sorted.end());
+  auto same = [](const auto& x, const auto& y) {
+    return x.first == y.first && x.second == y.second;
+  };
+  ASSERT_TRUE(
+      std::equal(a.begin(), a.end(), sorted.begin(), sorted.end(), same));
+  std::vector<std::pair<int, int>> shuffled = sorted;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1));
+  s21::multimap<int, int> b(shuffled.begin(), shuffled.end());
+  std::multimap<int, int> expected(shuffled.begin(), shuffled.end());
+  ASSERT_TRUE(std::equal(b.begin(), b.end(), expected.begin(), expected.end()));
+  s21::multimap<int, int> c = b;
+  ASSERT_EQ(c.size(), 1000u);
+  ASSERT_TRUE(std::equal(c.begin(), c.end(), b.begin(), b.end()));
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(MultisetTest, KeepsDuplicates) {
+  s21::multiset<int> s = {3, 1, 2, 1, 3, 3};
+  ASSERT_EQ(s.size(), 6u);
+  ASSERT_EQ(std::vector<int>(s.begin(), s.end()),
+            (std::vector<int>{1, 1, 2, 3, 3, 3}));
+  ASSERT_EQ(s.count(3), 3u);
+  ASSERT_EQ(*s.insert(2), 2);
+  ASSERT_EQ(s.count(2), 2u);
+  ASSERT_EQ(s.erase(3), 3u);
+  ASSERT_EQ(s.size(), 4u);
+  ASSERT_FALSE(s.contains(3));
+}
+
+TEST(MultisetTest, MergeAndNodeHandles) {
+  s21::multiset<int> a = {1, 2};
+  s21::multiset<int> b = {2, 3};
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(std::vector<int>(a.begin(), a.end()),
+            (std::vector<int>{1, 2, 2, 3}));
+  auto node = a.extract(2);
+  ASSERT_EQ(node.value(), 2);
+  b.insert(std::move(node));
+  ASSERT_EQ(a.count(2), 1u);
+  ASSERT_EQ(b.count(2), 1u);
+}
+
+TEST(MultisetTest, RandomOperationsMatchStdMultiset) {
+  std::mt19937 rng(48);
+  s21::multiset<int> s;
+  std::multiset<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 300);
+    if (rng() % 3 != 0) {
+      s.insert(key);
+      expected.insert(key);
+    } else if (auto it = s.find(key); it != s.end()) {
+      s.erase(it);
+      expected.erase(expected.find(key));
+    }
+    if (i % 1000 == 0) {
+      ASSERT_EQ(s.count(key), expected.count(key));
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+
+using PoolSet = s21::set<int, std::less<int>, s21::node_pool_allocator<int>>;
+
+}  // namespace
+
+TEST(NodePoolAllocatorTest, ReusesFreedChunks) {
+  s21::node_pool_allocator<long> alloc;
+  long* a = alloc.allocate(1);
+  long* b = alloc.allocate(1);
+  EXPECT_NE(a, b);
+  alloc.deallocate(a, 1);
+  long* c = alloc.allocate(1);
+  EXPECT_EQ(a, c);
+  alloc.deallocate(b, 1);
+  alloc.deallocate(c, 1);
+}
+
+TEST(NodePoolAllocatorTest, ManyAllocationsAreDistinctAndAligned) {
+  struct alignas(16) Wide {
+    char bytes[40];
+  };
+  s21::node_pool_allocator<Wide> alloc;
+  std::vector<Wide*> chunks;
+  for (int i = 0; i < 5000; ++i) {
+    Wide* p = alloc.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(Wide), 0u);
+    p->bytes[0] = static_cast<char>(i);
+    chunks.push_back(p);
+  }
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(chunks[i]->bytes[0], static_cast<char>(i));
+  }
+  for (Wide* p : chunks) alloc.deallocate(p, 1);
+}
+
+TEST(NodePoolAllocatorTest, ArraysBypassThePool) {
+  s21::node_pool_allocator<int> alloc;
+  int* array = alloc.allocate(100);
+  for (int i = 0; i < 100; ++i) array[i] = i;
+  EXPECT_EQ(array[99], 99);
+  alloc.deallocate(array, 100);
+}
+
+TEST(NodePoolAllocatorTest, RebindSharesThePool) {
+  s21::node_pool_allocator<int> ints;
+  s21::node_pool_allocator<double> doubles(ints);
+  s21::node_pool_allocator<int> copy(ints);
+  EXPECT_TRUE(ints == doubles);
+  EXPECT_TRUE(ints == copy);
+  EXPECT_FALSE(ints == s21::node_pool_allocator<int>());
+  EXPECT_FALSE(ints.can_release());
+
+  using traits = std::allocator_traits<s21::node_pool_allocator<int>>;
+  auto selected = traits::select_on_container_copy_construction(ints);
+  EXPECT_FALSE(selected == ints);
+  EXPECT_TRUE(selected.can_release());
+}
+
+TEST(NodePoolAllocatorTest, MovedFromAllocatorGetsNewPool) {
+  s21::node_pool_allocator<int> a;
+  s21::node_pool_allocator<int> b(std::move(a));
+  int* p = a.allocate(1);
+  *p = 7;
+  EXPECT_FALSE(a == b);
+  a.deallocate(p, 1);
+}
+
+TEST(NodePoolAllocatorTest, AbsorbLeavesOtherWithItsOwnEmptyPool) {
+  s21::node_pool_allocator<int> a;
+  s21::node_pool_allocator<int> b;
+  static_assert(noexcept(a.absorb(b)));
+  int* p = b.allocate(1);
+  *p = 7;
+  ASSERT_TRUE(a.absorb(b));
+  EXPECT_FALSE(a == b);
+  EXPECT_TRUE(b.can_release());
+  a.deallocate(p, 1);
+  int* q = b.allocate(1);
+  *q = 8;
+  b.deallocate(q, 1);
+}
+
+TEST(NodePoolAllocatorTest, SetOnPool) {
+  PoolSet s;
+  for (int i = 0; i < 1000; ++i) s.insert(i * 7 % 1000);
+  EXPECT_EQ(s.size(), 1000u);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+  s.insert(5);
+  s.insert(3);
+  EXPECT_EQ(*s.begin(), 3);
+  EXPECT_EQ(s.size(), 2u);
+}
+
+TEST(NodePoolAllocatorTest, ClearReleasesNonTrivialValues) {
+  s21::map<std::string, std::string, std::less<std::string>,
+           s21::node_pool_allocator<std::pair<const std::string, std::string>>>
+      m;
+  for (int i = 0; i < 200; ++i) {
+    m.insert(std::string(30, 'k') + std::to_string(i),
+             std::string(50, 'v') + std::to_string(i));
+  }
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  m.insert("a", "b");
+  EXPECT_EQ(m.at("a"), "b");
+}
+
+TEST(NodePoolAllocatorTest, SharedPoolFallsBackToNodeByNode) {
+  s21::node_pool_allocator<int> shared;
+  PoolSet a(std::less<int>(), shared);
+  PoolSet b(std::less<int>(), shared);
+  for (int i = 0; i < 100; ++i) {
+    a.insert(i);
+    b.insert(-i);
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 100u);
+  EXPECT_EQ(*b.begin(), -99);
+}
+
+TEST(NodePoolAllocatorTest, CopySwapAndMoveKeepContents) {
+  PoolSet a = {1, 2, 3};
+  PoolSet b(a);
+  b.insert(4);
+  PoolSet c = {10};
+  c.swap(b);
+  EXPECT_EQ(c.size(), 4u);
+  EXPECT_EQ(b.size(), 1u);
+  PoolSet d(std::move(c));
+  EXPECT_TRUE(c.empty());
+  c.insert(42);
+  EXPECT_TRUE(c.contains(42));
+  a = std::move(d);
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_TRUE(a.contains(4));
+}
+
+TEST(NodePoolAllocatorTest, PoolIsOptIn) {
+  static_assert(std::is_same_v<
+                s21::set<int>,
+                s21::set<int, std::less<int>, std::allocator<int>>>);
+  s21::map<int, int> m;
+  m.insert(1, 2);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
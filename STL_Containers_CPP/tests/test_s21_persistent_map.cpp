@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "../containers/s21_persistent_map.h"
+#undef private
+
+class PersistentMapTest : public ::testing::Test {
+ protected:
+  using Map = s21::persistent_map<int, std::string>;
+
+  // Ordered keys, no red node with a red child, the same number of black
+  // nodes on every path, a black root; returns the black height.
+  template <typename M>
+  static int assert_is_valid_tree(const typename M::Node* node,
+                                  const typename M::Node* low,
+                                  const typename M::Node* high) {
+    if (!node) return 1;
+    EXPECT_GE(node->refs.load(), 1u);
+    if (low) {
+      EXPECT_LT(low->data.first, node->data.first);
+    }
+    if (high) {
+      EXPECT_LT(node->data.first, high->data.first);
+    }
+    if (node->is_red()) {
+      EXPECT_FALSE(node->left && node->left->is_red());
+      EXPECT_FALSE(node->right && node->right->is_red());
+    }
+    int left = assert_is_valid_tree<M>(node->left, low, node);
+    int right = assert_is_valid_tree<M>(node->right, node, high);
+    EXPECT_EQ(left, right);
+    return left + (node->is_black() ? 1 : 0);
+  }
+
+  template <typename M>
+  static void assert_is_valid(const M& m) {
+    if (m.root_) {
+      EXPECT_TRUE(m.root_->is_black());
+    }
+    assert_is_valid_tree<M>(m.root_, nullptr, nullptr);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(m.begin(), m.end())),
+              m.size());
+  }
+
+  template <typename M, typename Reference>
+  static void assert_equal(const M& m, const Reference& reference) {
+    ASSERT_EQ(m.size(), reference.size());
+    auto it = m.begin();
+    for (const auto& [key, value] : reference) {
+      ASSERT_EQ(it->first, key);
+      ASSERT_EQ(it->second, value);
+      ++it;
+    }
+    ASSERT_EQ(it, m.end());
+  }
+};
+
+TEST_F(PersistentMapTest, EmptyMap) {
+  Map m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.find(1), m.end());
+  EXPECT_THROW(m.at(1), std::out_of_range);
+  EXPECT_TRUE(m.erase(1).empty());
+}
+
+TEST_F(PersistentMapTest, UpdatesLeaveOldVersionsUnchanged) {
+  Map v0 = {{2, "b"}, {1, "a"}, {2, "x"}};
+  Map v1 = v0.insert(3, "c");
+  Map v2 = v1.set(1, "A");
+  Map v3 = v2.erase(2);
+  Map v4 = v3.insert(3, "ignored");
+  assert_equal(v0, std::map<int, std::string>{{1, "a"}, {2, "b"}});
+  assert_equal(v1, std::map<int, std::string>{{1, "a"}, {2, "b"}, {3, "c"}});
+  assert_equal(v2, std::map<int, std::string>{{1, "A"}, {2, "b"}, {3, "c"}});
+  assert_equal(v3, std::map<int, std::string>{{1, "A"}, {3, "c"}});
+  assert_equal(v4, std::map<int, std::string>{{1, "A"}, {3, "c"}});
+  EXPECT_EQ(v4.root_, v3.root_);
+  EXPECT_EQ(v1.at(3), "c");
+  EXPECT_EQ(v2.find(1)->second, "A");
+  EXPECT_EQ(v3.lower_bound(2)->first, 3);
+  EXPECT_EQ(v3.lower_bound(4), v3.end());
+  EXPECT_EQ(v3.count(2), 0u);
+}
+
+TEST_F(PersistentMapTest, RandomUpdatesMatchStdMapInEveryVersion) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> keys(0, 500);
+  std::vector<Map> versions(1);
+  std::vector<std::map<int, std::string>> references(1);
+  for (int round = 0; round < 4000; ++round) {
+    int key = keys(rng);
+    Map next;
+    std::map<int, std::string> reference = references.back();
+    if (rng() % 3 == 0) {
+      next = versions.back().erase(key);
+      reference.erase(key);
+    } else {
+      next = versions.back().set(key, std::to_string(round));
+      reference[key] = std::to_string(round);
+    }
+    if (round % 40 == 0) {
+      assert_is_valid(next);
+      versions.push_back(next);
+      references.push_back(reference);
+    } else {
+      versions.back() = next;
+      references.back() = reference;
+    }
+  }
+  for (std::size_t i = 0; i < versions.size(); ++i) {
+    assert_is_valid(versions[i]);
+    assert_equal(versions[i], references[i]);
+  }
+  // dropping versions in any order frees only the nodes nobody else holds
+  for (std::size_t i = 0; i < versions.size(); i += 2) versions[i] = Map();
+  for (std::size_t i = 1; i < versions.size(); i += 2) {
+    assert_equal(versions[i], references[i]);
+  }
+}
+
+TEST_F(PersistentMapTest, EraseEverythingInEitherOrder) {
+  s21::persistent_map<int, int> m;
+  for (int i = 0; i < 256; ++i) m = m.insert(i, i);
+  auto forward = m;
+  auto backward = m;
+  for (int i = 0; i < 256; ++i) {
+    forward = forward.erase(i);
+    backward = backward.erase(255 - i);
+    assert_is_valid(forward);
+    assert_is_valid(backward);
+  }
+  EXPECT_TRUE(forward.empty());
+  EXPECT_TRUE(backward.empty());
+  EXPECT_EQ(m.size(), 256u);
+  assert_is_valid(m);
+}
+
+TEST_F(PersistentMapTest, ReadersUseSnapshotsWhileWriterPublishes) {
+  using IntMap = s21::persistent_map<int, int>;
+  std::mutex mutex;
+  IntMap published;
+  const int versions = 2000;
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&] {
+      for (int round = 0; round < 500; ++round) {
+        IntMap snapshot;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          snapshot = published;
+        }
+        // version v holds exactly the keys [0, v) with value key * 2
+        int expected = 0;
+        for (const auto& [key, value] : snapshot) {
+          EXPECT_EQ(key, expected++);
+          EXPECT_EQ(value, key * 2);
+        }
+        EXPECT_EQ(static_cast<std::size_t>(expected), snapshot.size());
+      }
+    });
+  }
+  IntMap current;
+  for (int v = 0; v < versions; ++v) {
+    current = current.insert(v, v * 2);
+    std::lock_guard<std::mutex> lock(mutex);
+    published = current;
+  }
+  for (auto& r : readers) r.join();
+  EXPECT_EQ(published.size(), static_cast<std::size_t>(versions));
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(RadixMapTest, IntegerKeysIterateInValueOrder) {
+  s21::radix_map<int, int> m = {{5, 50}, {-3, -30}, {0, 0}, {1 << 20, 1}};
+  ASSERT_EQ(m.size(), 4u);
+  std::vector<int> keys;
+  for (const auto& [key, value] : m) keys.push_back(key);
+  ASSERT_EQ(keys, (std::vector<int>{-3, 0, 5, 1 << 20}));
+  ASSERT_EQ(m.at(-3), -30);
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  m[4] += 40;
+  ASSERT_EQ(m.at(4), 40);
+  ASSERT_FALSE(m.insert(4, 0).second);
+  ASSERT_TRUE(m.insert_or_assign(4, 41).first->second == 41);
+  ASSERT_EQ(m.lower_bound(2)->first, 4);
+  ASSERT_EQ(m.upper_bound(5)->first, 1 << 20);
+  ASSERT_EQ(m.lower_bound((1 << 20) + 1), m.end());
+  ASSERT_EQ(std::prev(m.end())->first, 1 << 20);
+}
+
+TEST(RadixMapTest, StringKeysThatArePrefixesOfEachOther) {
+  s21::radix_map<std::string, int> m;
+  for (const char* key : {"abc", "a", "", "ab", "abcd", "b", "abd"}) {
+    ASSERT_TRUE(m.emplace(key, static_cast<int>(m.size())).second);
+  }
+  ASSERT_FALSE(m.emplace("ab", 0).second);
+  std::vector<std::string> keys;
+  for (const auto& [key, value] : m) keys.push_back(key);
+  ASSERT_EQ(keys, (std::vector<std::string>{"", "a", "ab", "abc", "abcd",
+                                            "abd", "b"}));
+  ASSERT_EQ(m.lower_bound("abca")->first, "abcd");
+  ASSERT_EQ(m.lower_bound("aa")->first, "ab");
+  ASSERT_EQ(m.upper_bound("abd")->first, "b");
+  ASSERT_TRUE(m.contains(""));
+  ASSERT_FALSE(m.contains("abe"));
+  ASSERT_EQ(m.erase("ab"), 1u);
+  ASSERT_EQ(m.erase("ab"), 0u);
+  ASSERT_EQ(m.erase("a"), 1u);
+  ASSERT_EQ(m.at("abcd"), 4);
+  ASSERT_EQ(m.size(), 5u);
+}
+
+TEST(RadixMapTest, PrefixScan) {
+  s21::radix_map<std::string, int> m;
+  std::vector<std::string> urls = {
+      "https://example.com/a",         "https://example.com/a/b",
+      "https://example.com/about",     "https://example.org/",
+      "https://example.com/",          "http://example.com/",
+      "https://example.com/very/long/path/that/exceeds/the/inline/prefix/1",
+      "https://example.com/very/long/path/that/exceeds/the/inline/prefix/2"};
+  for (std::size_t i = 0; i < urls.size(); ++i) {
+    m.insert(urls[i], static_cast<int>(i));
+  }
+  auto keys_of = [](auto range) {
+    std::vector<std::string> keys;
+    for (const auto& item : range) keys.push_back(item.first);
+    return keys;
+  };
+  ASSERT_EQ(keys_of(m.prefix("https://example.com/a")),
+            (std::vector<std::string>{"https://example.com/a",
+                                      "https://example.com/a/b",
+                                      "https://example.com/about"}));
+  ASSERT_EQ(keys_of(m.prefix("https://example.com/very/long/path/")).size(),
+            2u);
+  ASSERT_EQ(keys_of(m.prefix("https://example.o")).size(), 1u);
+  ASSERT_EQ(keys_of(m.prefix("http:")).size(), 1u);
+  ASSERT_TRUE(m.prefix("ftp").empty());
+  ASSERT_TRUE(m.prefix("https://example.com/b").empty());
+  ASSERT_EQ(std::ranges::distance(m.prefix("")),
+            static_cast<std::ptrdiff_t>(urls.size()));
+  const auto& cm = m;
+  ASSERT_EQ(cm.prefix("https://example.com/a/").begin()->second, 1);
+}
+
+TEST(RadixMapTest, NodesGrowAndShrink) {
+  s21::radix_map<std::uint32_t, int> m;
+  for (std::uint32_t i = 0; i < 256; ++i) m.insert(i, 0);
+  ASSERT_EQ(m.node_counts().node256, 1u);
+  for (std::uint32_t i = 0; i < 250; ++i) m.erase(i);
+  auto counts = m.node_counts();
+  ASSERT_EQ(counts.node256 + counts.node48 + counts.node4, 0u);
+  ASSERT_EQ(counts.node16, 1u);
+  for (std::uint32_t i = 250; i < 253; ++i) m.erase(i);
+  ASSERT_EQ(m.node_counts().node16, 0u);
+  ASSERT_EQ(m.node_counts().node4, 1u);
+  for (std::uint32_t i = 253; i < 255; ++i) m.erase(i);
+  ASSERT_EQ(m.node_counts().node4, 0u);
+  ASSERT_EQ(m.begin()->first, 255u);
+  ASSERT_EQ(m.size(), 1u);
+}
+
+namespace {
+
+bool radix_allocations_fail = false;
+
+// Throws while radix_allocations_fail is set, so no node can shrink.
+template <typename T>
+struct FailingAllocator {
+  using value_type = T;
+
+  FailingAllocator() = default;
+  template <typename U>
+  FailingAllocator(const FailingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    if (radix_allocations_fail) throw std::bad_alloc();
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  bool operator==(const FailingAllocator<U>&) const noexcept {
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(RadixMapTest, NodesCollapseWhenTheyCannotShrink) {
+  using Alloc = FailingAllocator<std::pair<const std::string, int>>;
+  s21::radix_map<std::string, int, Alloc> m;
+  m.insert("k", -1);
+  for (int b = 0; b < 256; ++b) m.insert("k" + std::string(1, char(b)), b);
+  m.insert("z", 1000);
+  m.insert("z1", 1001);
+  ASSERT_EQ(m.node_counts().node256, 1u);
+  radix_allocations_fail = true;
+  // the Node256 under "k" is left with only its terminal, "z" with one child
+  for (int b = 0; b < 256; ++b) m.erase("k" + std::string(1, char(b)));
+  m.erase("z");
+  radix_allocations_fail = false;
+  auto counts = m.node_counts();
+  ASSERT_EQ(counts.node256 + counts.node48 + counts.node16, 0u);
+  ASSERT_EQ(m.size(), 2u);
+  ASSERT_EQ(m.at("k"), -1);
+  ASSERT_EQ(m.at("z1"), 1001);
+  ASSERT_EQ(m.begin()->first, "k");
+  ASSERT_EQ(std::next(m.begin())->first, "z1");
+}
+
+TEST(RadixMapTest, IteratorsSurviveOtherInsertsAndErases) {
+  s21::radix_map<std::uint64_t, int> m;
+  auto kept = m.insert(1000, 1).first;
+  for (std::uint64_t i = 0; i < 5000; ++i) m.insert(i * 7, 0);
+  for (std::uint64_t i = 0; i < 5000; i += 2) m.erase(i * 7);
+  ASSERT_EQ(kept->first, 1000u);
+  ASSERT_EQ(kept->second, 1);
+  auto next = m.erase(m.find(7));
+  ASSERT_EQ(next->first, 21u);
+}
+
+TEST(RadixMapTest, CopyMoveAndSwap) {
+  s21::radix_map<std::string, int> a = {{"x", 1}, {"xy", 2}, {"z", 3}};
+  s21::radix_map<std::string, int> b = a;
+  b["x"] = 10;
+  ASSERT_EQ(a.at("x"), 1);
+  ASSERT_EQ(b.at("x"), 10);
+  s21::radix_map<std::string, int> c = std::move(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(c.size(), 3u);
+  ASSERT_EQ(std::prev(c.end())->first, "z");
+  c.swap(b);
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.begin(), c.end());
+  ASSERT_EQ(b.begin()->second, 10);
+  a = b;
+  ASSERT_EQ(a.at("x"), 10);
+  a = s21::radix_map<std::string, int>();
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(RadixMapTest, RandomStringsMatchStdMap) {
+  std::mt19937 rng(49);
+  s21::radix_map<std::string, int> m;
+  std::map<std::string, int> expected;
+  auto random_key = [&rng] {
+    static const char* const kStems[] = {"/usr/", "/usr/local/", "/home/u/",
+                                         "/", "/usr/local/share/very/deep/"};
+    std::string key = kStems[rng() % 5];
+    std::size_t length = rng() % 6;
+    for (std::size_t i = 0; i < length; ++i) {
+      key += static_cast<char>(rng() % 2 ? 'a' + rng() % 3 : 0xe0 + rng() % 3);
+    }
+    return key;
+  };
+  for (int i = 0; i < 30000; ++i) {
+    std::string key = random_key();
+    switch (rng() % 3) {
+      case 0:
+      case 1:
+        ASSERT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+        break;
+      default:
+        ASSERT_EQ(m.erase(key), expected.erase(key));
+    }
+    if (i % 500 == 0) {
+      std::string probe = random_key();
+      auto it = m.lower_bound(probe);
+      auto want = expected.lower_bound(probe);
+      ASSERT_EQ(it == m.end(), want == expected.end());
+      if (want != expected.end()) {
+        ASSERT_EQ(it->first, want->first);
+      }
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end()));
+  std::size_t in_prefix = 0;
+  for (const auto& item : expected) {
+    in_prefix += item.first.starts_with("/usr/local/");
+  }
+  ASSERT_EQ(std::ranges::distance(m.prefix("/usr/local/")),
+            static_cast<std::ptrdiff_t>(in_prefix));
+}
+
+TEST(RadixMapTest, RandomIntegersMatchStdMap) {
+  std::mt19937_64 rng(50);
+  s21::radix_map<std::int64_t, int> m;
+  std::map<std::int64_t, int> expected;
+  for (int i = 0; i < 50000; ++i) {
+    // dense ids with a few far outliers, positive and negative
+    std::int64_t key = static_cast<std::int64_t>(rng() % 4096) - 1024;
+    if (i % 50 == 0) key = static_cast<std::int64_t>(rng());
+    if (rng() % 4 == 0) {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    } else {
+      ASSERT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end()));
+  for (int i = 0; i < 1000; ++i) {
+    std::int64_t probe = static_cast<std::int64_t>(rng() % 5000) - 2000;
+    auto it = m.upper_bound(probe);
+    auto want = expected.upper_bound(probe);
+    ASSERT_EQ(it == m.end(), want == expected.end());
+    if (want != expected.end()) {
+      ASSERT_EQ(it->first, want->first);
+    }
+  }
+  auto counts = m.node_counts();
+  ASSERT_GT(counts.node256 + counts.node48, 0u);
+}
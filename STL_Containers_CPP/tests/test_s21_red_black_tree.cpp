@@ -1,11 +1,18 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #define private public
 #include "../containers/tree/s21_red_black_tree.h"
+#include "../containers/tree/s21_tree_node_arena_links.h"
 #undef private
 
 template <typename Key>
@@ -46,6 +53,12 @@ class RedBlackTreeTest : public ::testing::Test {
     if (!tree.empty()) {
       ASSERT_EQ(*(tree.begin()), tree.header_->left->data);
       ASSERT_EQ(*(--tree.end()), tree.header_->right->data);
+      ASSERT_EQ(tree.header_->left, root->minimum());
+      ASSERT_EQ(tree.header_->right, root->maximum());
+      ASSERT_EQ(root->parent, tree.header_);
+      ASSERT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+      ASSERT_EQ(static_cast<size_t>(std::distance(tree.begin(), tree.end())),
+                tree.size());
     } else {
       ASSERT_EQ(tree.begin(), tree.end());
       ASSERT_EQ(tree.header_->left, tree.header_);
@@ -212,4 +225,587 @@ TEST_F(RedBlackTreeTest, Iteration) {
     actual.push_back(val);
   }
   ASSERT_EQ(expected, actual);
-}
\ No newline at end of file
+}
+
+TEST_F(RedBlackTreeTest, SortedRangeBuildsValidTree) {
+  for (int n = 0; n <= 130; ++n) {
+    std::vector<int> source(n);
+    for (int i = 0; i < n; ++i) source[i] = i * 2;
+    Tree tree(source.begin(), source.end());
+    ASSERT_EQ(tree.size(), static_cast<size_t>(n));
+    assert_is_valid_rb_tree(tree);
+    ASSERT_TRUE(std::equal(tree.begin(), tree.end(), source.begin()));
+    if (n > 0) {
+      tree.insert(-1);
+      tree.insert(n * 2 + 1);
+      tree.erase(tree.find(n));
+      assert_is_valid_rb_tree(tree);
+    }
+  }
+}
+
+TEST_F(RedBlackTreeTest, SortedUniqueBuildsValidTree) {
+  for (int n = 0; n <= 70; ++n) {
+    std::vector<int> source(n);
+    for (int i = 0; i < n; ++i) source[i] = i;
+    Tree tree(s21::sorted_unique, source.begin(), source.end());
+    ASSERT_EQ(tree.size(), static_cast<size_t>(n));
+    assert_is_valid_rb_tree(tree);
+    ASSERT_TRUE(std::equal(tree.begin(), tree.end(), source.begin()));
+  }
+}
+
+#ifndef NDEBUG
+TEST_F(RedBlackTreeTest, SortedUniqueRejectsUnsortedInput) {
+  std::vector<int> duplicates = {1, 2, 2, 3};
+  std::vector<int> descending = {3, 2, 1};
+  ASSERT_THROW(Tree(s21::sorted_unique, duplicates.begin(), duplicates.end()),
+               std::invalid_argument);
+  ASSERT_THROW(Tree(s21::sorted_unique, descending.begin(), descending.end()),
+               std::invalid_argument);
+}
+#endif
+
+TEST_F(RedBlackTreeTest, HintedInsertAscendingAndDescending) {
+  Tree ascending;
+  for (int i = 0; i < 500; ++i) ascending.emplace_hint(ascending.end(), i);
+  ASSERT_EQ(ascending.size(), 500u);
+  assert_is_valid_rb_tree(ascending);
+  ASSERT_EQ(*ascending.begin(), 0);
+
+  Tree descending;
+  for (int i = 500; i > 0; --i) {
+    descending.insert(descending.begin(), i);
+  }
+  ASSERT_EQ(descending.size(), 500u);
+  assert_is_valid_rb_tree(descending);
+  int expected = 1;
+  for (int value : descending) ASSERT_EQ(value, expected++);
+}
+
+TEST_F(RedBlackTreeTest, HintedInsertWithAnyHint) {
+  Tree tree;
+  for (int i = 0; i < 200; i += 2) tree.insert(i);
+  // right hints (the successor), wrong hints and duplicates
+  for (int i = 1; i < 200; i += 2) {
+    auto next = tree.find(i + 1);
+    auto it = tree.emplace_hint(next, i);
+    ASSERT_EQ(*it, i);
+    it = tree.emplace_hint(tree.begin(), i + 1000);
+    ASSERT_EQ(*it, i + 1000);
+    it = tree.insert(tree.end(), i);
+    ASSERT_EQ(*it, i);
+    assert_is_valid_rb_tree(tree);
+  }
+  ASSERT_EQ(tree.size(), 300u);
+  ASSERT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+  ASSERT_EQ(*std::prev(tree.end()), 1199);
+}
+
+TEST_F(RedBlackTreeTest, LowerAndUpperBound) {
+  // filled_tree_: 5 8 15 17 18 25 40 80
+  ASSERT_EQ(*filled_tree_.lower_bound(15), 15);
+  ASSERT_EQ(*filled_tree_.upper_bound(15), 17);
+  ASSERT_EQ(*filled_tree_.lower_bound(16), 17);
+  ASSERT_EQ(*filled_tree_.upper_bound(16), 17);
+  ASSERT_EQ(*filled_tree_.lower_bound(-100), 5);
+  ASSERT_EQ(filled_tree_.lower_bound(81), filled_tree_.end());
+  ASSERT_EQ(filled_tree_.upper_bound(80), filled_tree_.end());
+  ASSERT_EQ(empty_tree_.lower_bound(1), empty_tree_.end());
+
+  const Tree& const_tree = filled_tree_;
+  auto [first, last] = const_tree.equal_range(25);
+  ASSERT_EQ(*first, 25);
+  ASSERT_EQ(*last, 40);
+  auto missing = const_tree.equal_range(30);
+  ASSERT_EQ(missing.first, missing.second);
+  ASSERT_EQ(*missing.first, 40);
+}
+
+TEST_F(RedBlackTreeTest, RangeView) {
+  std::vector<int> inside;
+  for (int value : filled_tree_.range(8, 25)) inside.push_back(value);
+  ASSERT_EQ(inside, (std::vector<int>{8, 15, 17, 18}));
+  ASSERT_TRUE(filled_tree_.range(25, 8).empty());
+  ASSERT_TRUE(filled_tree_.range(19, 24).empty());
+  ASSERT_EQ(std::ranges::distance(filled_tree_.range(0, 1000)), 8);
+
+  const Tree& const_tree = filled_tree_;
+  auto view = const_tree.range(16, 41);
+  ASSERT_EQ(std::ranges::count_if(view, [](int v) { return v % 2 == 1; }),
+            2);
+  ASSERT_EQ(*std::ranges::prev(view.end()), 40);
+}
+
+TEST_F(RedBlackTreeTest, ReverseIterationPassesTheRoot) {
+  for (int n = 1; n <= 40; ++n) {
+    Tree tree;
+    for (int i = 0; i < n; ++i) tree.insert(i);
+    std::vector<int> reversed;
+    auto it = tree.end();
+    while (it != tree.begin()) reversed.push_back(*--it);
+    ASSERT_EQ(reversed.size(), static_cast<size_t>(n));
+    ASSERT_TRUE(std::is_sorted(reversed.rbegin(), reversed.rend()));
+  }
+}
+
+TEST_F(RedBlackTreeTest, EraseKeepsMinimumAndMaximum) {
+  Tree tree;
+  for (int i = 0; i < 64; ++i) tree.insert(i * 37 % 64);
+  for (int round = 0; round < 32; ++round) {
+    tree.erase(round % 2 ? tree.begin() : std::prev(tree.end()));
+    assert_is_valid_rb_tree(tree);
+  }
+  ASSERT_EQ(*tree.begin(), 16);
+  ASSERT_EQ(*std::prev(tree.end()), 47);
+  // root that is also the maximum
+  Tree small;
+  small.insert(2);
+  small.insert(1);
+  small.erase(small.find(2));
+  assert_is_valid_rb_tree(small);
+  small.erase(small.begin());
+  assert_is_valid_rb_tree(small);
+}
+
+TEST_F(RedBlackTreeTest, MergeKeepsTreesValid) {
+  for (int m : {1, 3, 50, 400}) {
+    Tree target;
+    Tree source;
+    for (int i = 0; i < 400; i += 2) target.insert(i);
+    for (int i = 0; i < m; ++i) source.insert(i * 3);
+    size_t both = 0;
+    for (int value : source) both += target.contains(value) ? 1 : 0;
+    size_t total = target.size() + source.size();
+    target.merge(source);
+    assert_is_valid_rb_tree(target);
+    assert_is_valid_rb_tree(source);
+    ASSERT_EQ(source.size(), both);
+    ASSERT_EQ(target.size() + source.size(), total);
+  }
+}
+
+TEST_F(RedBlackTreeTest, SetOperationsBuildValidTrees) {
+  Tree a;
+  Tree b;
+  for (int i = 0; i < 300; ++i) a.insert(i * 2);
+  for (int i = 0; i < 300; ++i) b.insert(i * 3);
+  using Op = Tree::SetOperation;
+  Tree u = Tree::set_operation(Op::kUnion, a, b);
+  Tree i = Tree::set_operation(Op::kIntersection, a, b);
+  Tree d = Tree::set_operation(Op::kDifference, a, b);
+  assert_is_valid_rb_tree(u);
+  assert_is_valid_rb_tree(i);
+  assert_is_valid_rb_tree(d);
+  ASSERT_EQ(i.size(), 100u);
+  ASSERT_EQ(u.size(), 500u);
+  ASSERT_EQ(d.size(), 200u);
+}
+
+TEST_F(RedBlackTreeTest, ExtractAndReinsertRebalances) {
+  Tree tree;
+  for (int i = 0; i < 200; ++i) tree.insert(i);
+  std::vector<Tree::node_type> handles;
+  for (int i = 0; i < 200; i += 3) {
+    handles.push_back(tree.extract(i));
+    assert_is_valid_rb_tree(tree);
+  }
+  ASSERT_EQ(tree.size(), 133u);
+  for (auto& handle : handles) {
+    ASSERT_TRUE(tree.insert(std::move(handle)).inserted);
+  }
+  assert_is_valid_rb_tree(tree);
+  ASSERT_EQ(tree.size(), 200u);
+}
+
+TEST_F(RedBlackTreeTest, UnsortedRangeWithDuplicates) {
+  std::vector<int> source = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+  Tree tree(source.begin(), source.end());
+  ASSERT_EQ(tree.size(), 7u);
+  assert_is_valid_rb_tree(tree);
+  std::vector<int> expected = {1, 2, 3, 4, 5, 6, 9};
+  ASSERT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin()));
+  std::vector<int> with_equal = {1, 2, 2, 3};
+  tree.assign(with_equal.begin(), with_equal.end());
+  ASSERT_EQ(tree.size(), 3u);
+  assert_is_valid_rb_tree(tree);
+}
+
+TEST_F(RedBlackTreeTest, FromRange) {
+  Tree tree(s21::from_range, std::vector<int>{3, 2, 1});
+  ASSERT_EQ(tree.size(), 3u);
+  ASSERT_EQ(*tree.begin(), 1);
+  assert_is_valid_rb_tree(tree);
+}
+
+// Concatenates keys in order; not commutative, so aggregate() must keep
+// the key order.
+struct ConcatKeys {
+  using result_type = std::string;
+  static result_type identity() { return {}; }
+  static result_type combine(const result_type& a, const result_type& b) {
+    return a + b;
+  }
+  static result_type lift(int key) { return std::to_string(key) + ","; }
+};
+
+class AugmentedTreeTest : public ::testing::Test {
+ protected:
+  using Tree =
+      s21::RedBlackTree<int, int, TestSetTraits<int>, std::less<int>,
+                        std::allocator<int>, s21::SubtreeAggregate<ConcatKeys>>;
+  using Node = typename Tree::Node;
+
+  // Recomputes every subtree from scratch and compares with the stored data.
+  std::size_t check_subtree(const Node* node, std::string& keys) {
+    if (!node) return 0;
+    std::string left_keys;
+    std::string right_keys;
+    std::size_t size = 1 + check_subtree(node->left, left_keys) +
+                       check_subtree(node->right, right_keys);
+    keys = left_keys + ConcatKeys::lift(node->data) + right_keys;
+    EXPECT_EQ(node->augment.size, size);
+    EXPECT_EQ(node->augment.value, keys);
+    return size;
+  }
+
+  void assert_augment_valid(const Tree& tree) {
+    std::string keys;
+    ASSERT_EQ(check_subtree(tree.get_root(), keys), tree.size());
+  }
+
+  std::string brute_aggregate(const Tree& tree, int lo, int hi) {
+    std::string result;
+    for (int key : tree) {
+      if (lo <= key && key < hi) result += ConcatKeys::lift(key);
+    }
+    return result;
+  }
+};
+
+TEST(TreeNodeLayout, NoAugmentationAddsNoSpace) {
+  static_assert(sizeof(s21::TreeNode<int>) ==
+                sizeof(s21::TreeNode<int, s21::SubtreeSize>) -
+                    sizeof(s21::SubtreeSize::node_data));
+  static_assert(sizeof(s21::TreeNode<long>) == 4 * sizeof(void*) + 8 ||
+                sizeof(void*) != 8);
+}
+
+TEST_F(AugmentedTreeTest, InsertAndEraseKeepSubtreeData) {
+  Tree tree;
+  std::vector<int> keys(200);
+  for (int i = 0; i < 200; ++i) keys[i] = (i * 37) % 200;
+  for (int key : keys) tree.insert(key);
+  assert_augment_valid(tree);
+  for (int i = 0; i < 200; i += 3) tree.erase(tree.find(keys[i]));
+  assert_augment_valid(tree);
+  tree.insert(tree.end(), 1000);
+  tree.insert(tree.begin(), -1);
+  assert_augment_valid(tree);
+}
+
+TEST_F(AugmentedTreeTest, RankSelectNth) {
+  Tree tree;
+  for (int i = 0; i < 100; ++i) tree.insert((i * 61) % 100 * 2);
+  std::size_t k = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it, ++k) {
+    EXPECT_EQ(tree.rank(*it), k);
+    EXPECT_EQ(tree.rank(*it + 1), k + 1);  // absent key between neighbours
+    EXPECT_EQ(tree.select(k), *it);
+    EXPECT_EQ(tree.nth(k), it);
+  }
+  EXPECT_EQ(tree.rank(-5), 0u);
+  EXPECT_EQ(tree.rank(1000), tree.size());
+  EXPECT_EQ(tree.nth(tree.size()), tree.end());
+  EXPECT_THROW(tree.select(tree.size()), std::out_of_range);
+  const Tree& ctree = tree;
+  EXPECT_EQ(*ctree.nth(3), 6);
+}
+
+TEST_F(AugmentedTreeTest, AggregateMatchesBruteForce) {
+  Tree tree;
+  for (int i = 0; i < 64; ++i) tree.insert((i * 23) % 64 * 3);
+  for (int lo = -3; lo < 200; lo += 7) {
+    for (int hi = lo - 5; hi < 200; hi += 11) {
+      EXPECT_EQ(tree.aggregate(lo, hi), brute_aggregate(tree, lo, hi))
+          << lo << " " << hi;
+    }
+  }
+  EXPECT_EQ(Tree().aggregate(0, 10), "");
+}
+
+TEST_F(AugmentedTreeTest, BulkOperationsKeepSubtreeData) {
+  std::vector<int> sorted(50);
+  for (int i = 0; i < 50; ++i) sorted[i] = i * 2;
+  Tree a(s21::sorted_unique, sorted.begin(), sorted.end());
+  assert_augment_valid(a);
+
+  Tree copy(a);
+  assert_augment_valid(copy);
+
+  Tree b = {1, 3, 5, 7, 9, 4};
+  Tree c = Tree::set_operation(Tree::SetOperation::kUnion, a, b);
+  assert_augment_valid(c);
+  EXPECT_EQ(c.aggregate(0, 6), "0,1,2,3,4,5,");
+
+  a.merge(b);  // small into large: node by node
+  assert_augment_valid(a);
+  assert_augment_valid(b);
+  Tree d = {1, 2, 3};
+  Tree e = {2, 3, 4, 5, 6};
+  d.merge(e);  // comparable sizes: flatten and rebuild
+  assert_augment_valid(d);
+  assert_augment_valid(e);
+  EXPECT_EQ(d.aggregate(0, 100), "1,2,3,4,5,6,");
+
+  auto handle = a.extract(10);
+  assert_augment_valid(a);
+  handle.value() = 1001;
+  a.insert(std::move(handle));
+  assert_augment_valid(a);
+  EXPECT_EQ(a.select(a.size() - 1), 1001);
+}
+
+TEST_F(RedBlackTreeTest, CopyAndDestroyDegenerateTree) {
+  // a 200000-node chain: deep enough to overflow a recursive walk
+  const int n = 200000;
+  Tree chain;
+  Node* tail = chain.header_;
+  for (int i = 0; i < n; ++i) {
+    Node* node = chain.create_node(i);
+    node->parent = tail;
+    if (tail == chain.header_) {
+      chain.set_root(node);
+    } else {
+      tail->right = node;
+    }
+    tail = node;
+  }
+  Node* copy = Tree::copy_tree(chain.node_allocator_, chain.get_root(),
+                               chain.header_);
+  int expected = 0;
+  for (Node* node = copy; node; node = node->right) {
+    ASSERT_EQ(node->data, expected++);
+    ASSERT_EQ(node->left, nullptr);
+  }
+  ASSERT_EQ(expected, n);
+  Tree::destroy_tree(chain.node_allocator_, copy);
+  Tree::destroy_tree(chain.node_allocator_, chain.get_root());
+  chain.set_root(nullptr);
+}
+
+TEST_F(RedBlackTreeTest, ParallelCopyBuildsValidTree) {
+  Tree big;
+  for (int i = 0; i < 70000; ++i) big.insert((i * 7919) % 70000);
+  for (unsigned threads : {0u, 1u, 2u, 5u}) {
+    Tree copy(big, threads);
+    assert_is_valid_rb_tree(copy);
+    ASSERT_EQ(copy.size(), big.size());
+    ASSERT_TRUE(std::equal(copy.begin(), copy.end(), big.begin()));
+  }
+}
+
+TEST_F(RedBlackTreeTest, ClearDeferredLeavesUsableTree) {
+  filled_tree_.clear_deferred();
+  assert_is_valid_rb_tree(filled_tree_);
+  filled_tree_.insert(3);
+  assert_is_valid_rb_tree(filled_tree_);
+  s21::background_reclaimer::instance().drain();
+}
+
+TEST(OrderStatisticTree, ParallelCopyKeepsSubtreeSizes) {
+  using Tree = s21::RedBlackTree<int, int, TestSetTraits<int>, std::less<int>,
+                                 std::allocator<int>, s21::SubtreeSize>;
+  std::vector<int> keys(40000);
+  for (int i = 0; i < 40000; ++i) keys[i] = i;
+  Tree big(s21::sorted_unique, keys.begin(), keys.end());
+  Tree copy(big, 2);
+  for (int k = 0; k < 40000; k += 97) {
+    ASSERT_EQ(copy.select(k), k);
+    ASSERT_EQ(copy.rank(k), static_cast<std::size_t>(k));
+  }
+}
+
+namespace {
+
+/*
+ * Allocator that remembers what it handed out, so a node freed through an
+ * allocator that does not own it is caught. absorb() takes over the other
+ * ledger, except that the absorb_fails-th call refuses; from then on every
+ * allocation throws.
+ */
+struct LedgerState {
+  int absorbs = 0;
+  int absorb_fails = 0;
+  bool throwing = false;
+  std::atomic<int> live{0};
+  std::atomic<int> foreign_frees{0};
+};
+
+template <typename T>
+class LedgerAllocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::false_type;
+
+  explicit LedgerAllocator(LedgerState* state)
+      : state_(state),
+        owned_(std::make_shared<std::unordered_set<const void*>>()) {}
+  template <typename U>
+  LedgerAllocator(const LedgerAllocator<U>& other) noexcept
+      : state_(other.state_), owned_(other.owned_) {}
+
+  T* allocate(std::size_t n) {
+    if (state_->throwing) throw std::bad_alloc();
+    T* p = std::allocator<T>().allocate(n);
+    owned_->insert(p);
+    ++state_->live;
+    return p;
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (owned_->erase(p) == 0) ++state_->foreign_frees;
+    --state_->live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  LedgerAllocator select_on_container_copy_construction() const {
+    return LedgerAllocator(state_);
+  }
+  bool absorb(LedgerAllocator& other) {
+    if (++state_->absorbs == state_->absorb_fails) {
+      state_->throwing = true;
+      return false;
+    }
+    owned_->insert(other.owned_->begin(), other.owned_->end());
+    other.owned_->clear();
+    return true;
+  }
+
+  template <typename U>
+  bool operator==(const LedgerAllocator<U>& other) const noexcept {
+    return owned_ == other.owned_;
+  }
+
+ private:
+  template <typename U>
+  friend class LedgerAllocator;
+
+  LedgerState* state_;
+  std::shared_ptr<std::unordered_set<const void*>> owned_;
+};
+
+}  // namespace
+
+TEST(ParallelCopyTest, FailedRecopyFreesAbsorbedNodesThroughTheirOwner) {
+  using Tree = s21::RedBlackTree<int, int, TestSetTraits<int>, std::less<int>,
+                                 LedgerAllocator<int>>;
+  LedgerState state;
+  {
+    Tree big{LedgerAllocator<int>(&state)};
+    for (int i = 0; i < 70000; ++i) big.insert(i);
+    // three workers' shares: the first absorb succeeds, the second fails
+    // and copying its share again throws
+    state.absorb_fails = 2;
+    ASSERT_THROW(Tree copy(big, 3), std::bad_alloc);
+    ASSERT_EQ(state.absorbs, 2);
+    state.throwing = false;
+  }
+  ASSERT_EQ(state.foreign_frees, 0);
+  ASSERT_EQ(state.live, 0);
+}
+
+template <typename Links>
+class PackedLayoutTreeTest : public ::testing::Test {
+ protected:
+  using Alloc =
+      std::conditional_t<std::is_same_v<Links, s21::ArenaIndexLinks>,
+                         s21::node_arena_allocator<int>, std::allocator<int>>;
+  using Tree = s21::RedBlackTree<int, int, TestSetTraits<int>, std::less<int>,
+                                 Alloc, s21::NoAugmentation, Links>;
+  using Node = typename Tree::Node;
+
+  // Black height of the subtree, -1 on a red-red edge or unequal heights.
+  int black_height(const Node* node) {
+    if (!node) return 1;
+    if (node->is_red() && ((node->left && node->left->is_red()) ||
+                           (node->right && node->right->is_red()))) {
+      return -1;
+    }
+    if (node->left && node->left->parent != node) return -1;
+    if (node->right && node->right->parent != node) return -1;
+    int left = black_height(node->left);
+    int right = black_height(node->right);
+    if (left == -1 || left != right) return -1;
+    return left + (node->is_black() ? 1 : 0);
+  }
+};
+
+using PackedLayouts =
+    ::testing::Types<s21::TaggedPointerLinks, s21::ArenaIndexLinks>;
+TYPED_TEST_SUITE(PackedLayoutTreeTest, PackedLayouts);
+
+TYPED_TEST(PackedLayoutTreeTest, InsertEraseCopyMerge) {
+  using Tree = typename TestFixture::Tree;
+  Tree tree;
+  for (int i = 0; i < 3000; ++i) tree.insert((i * 1543) % 3000);
+  for (int i = 0; i < 3000; i += 3) tree.erase(tree.find(i));
+  ASSERT_EQ(tree.size(), 2000u);
+  ASSERT_TRUE(tree.get_root()->is_black());
+  ASSERT_NE(this->black_height(tree.get_root()), -1);
+  ASSERT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+  ASSERT_EQ(*tree.begin(), 1);
+  ASSERT_EQ(*--tree.end(), 2999);
+
+  Tree copy(tree);
+  ASSERT_NE(this->black_height(copy.get_root()), -1);
+  ASSERT_TRUE(std::equal(copy.begin(), copy.end(), tree.begin()));
+
+  Tree other = {0, 3, 6, 3001};
+  tree.merge(other);
+  ASSERT_EQ(tree.size(), 2004u);
+  ASSERT_TRUE(other.empty());
+  ASSERT_NE(this->black_height(tree.get_root()), -1);
+  tree.clear();
+  ASSERT_EQ(tree.begin(), tree.end());
+}
+
+namespace {
+
+// A key type of its own, so no other test uses the same node arena.
+struct TeardownKey {
+  int value;
+  auto operator<=>(const TeardownKey&) const = default;
+};
+
+using TeardownTree =
+    s21::RedBlackTree<TeardownKey, TeardownKey, TestSetTraits<TeardownKey>,
+                      std::less<TeardownKey>,
+                      s21::node_arena_allocator<TeardownKey>,
+                      s21::NoAugmentation, s21::ArenaIndexLinks>;
+using TeardownArena = s21::node_arena<TeardownTree::Node>;
+
+// Runs after the static tree is gone: every slot handed out must be back.
+void check_arena_after_teardown() {
+  std::uint32_t free_slots = 0;
+  for (std::uint32_t slot = TeardownArena::state().free_head; slot;
+       slot = TeardownArena::next_free(slot)) {
+    ++free_slots;
+  }
+  std::_Exit(free_slots + 1 == TeardownArena::state().next ? 0 : 1);
+}
+
+}  // namespace
+
+TEST(ArenaTeardownDeathTest, StaticTreeFreesAfterThreadCacheIsGone) {
+  // The main thread's thread_locals, the arena's cache among them, are
+  // destroyed before objects with static storage.
+  ASSERT_EXIT(
+      {
+        TeardownArena::state();  // outlives the check below
+        std::atexit(check_arena_after_teardown);
+        static TeardownTree tree;
+        for (int i = 0; i < 1000; ++i) tree.insert(TeardownKey{i});
+        std::exit(2);
+      },
+      ::testing::ExitedWithCode(0), "");
+}
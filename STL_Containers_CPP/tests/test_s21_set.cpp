@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "../containers/tree/s21_tree_node_arena_links.h"
 #include "../s21_containers.h"
 
 TEST(SetTest, DefaultConstructor) {
@@ -151,4 +155,339 @@ TEST(SetTest, FindAndContains) {
   ASSERT_EQ(s.find(40), s.end());
   ASSERT_TRUE(s.contains(30));
   ASSERT_FALSE(s.contains(50));
-}
\ No newline at end of file
+}
+
+TEST(SetTest, IteratorPairConstructor) {
+  std::vector<int> source = {5, 3, 5, 1};
+  s21::set<int> s(source.begin(), source.end());
+  ASSERT_EQ(s.size(), 3u);
+  std::vector<int> expected = {1, 3, 5};
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+}
+
+TEST(SetTest, FromRangeConstructorAndAssign) {
+  s21::set<int> s(s21::from_range, std::vector<int>{1, 2, 3, 4});
+  ASSERT_EQ(s.size(), 4u);
+  s.insert(0);
+  ASSERT_EQ(*s.begin(), 0);
+  s21::list<int> other = {9, 8};
+  s.assign(other.begin(), other.end());
+  ASSERT_EQ(s.size(), 2u);
+  ASSERT_EQ(*s.begin(), 8);
+}
+
+TEST(SetTest, SortedUniqueConstructor) {
+  std::vector<int> source = {-5, 0, 3, 8, 13};
+  s21::set<int> s(s21::sorted_unique, source.begin(), source.end());
+  ASSERT_EQ(s.size(), 5u);
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), source.begin()));
+  ASSERT_TRUE(s.contains(8));
+  ASSERT_FALSE(s.contains(7));
+}
+
+TEST(SetTest, InsertWithHint) {
+  s21::set<int> s;
+  auto hint = s.end();
+  for (int i = 100; i > 0; --i) hint = s.insert(hint, i);
+  ASSERT_EQ(s.size(), 100u);
+  ASSERT_EQ(*s.begin(), 1);
+  ASSERT_EQ(*s.emplace_hint(s.end(), 50), 50);
+  ASSERT_EQ(s.size(), 100u);
+}
+
+TEST(SetTest, BoundsAndRange) {
+  s21::set<int> s = {1, 3, 5, 7, 9};
+  ASSERT_EQ(*s.lower_bound(4), 5);
+  ASSERT_EQ(*s.upper_bound(5), 7);
+  ASSERT_EQ(s.upper_bound(9), s.end());
+  auto eq = s.equal_range(4);
+  ASSERT_EQ(eq.first, eq.second);
+  std::vector<int> window(s.range(3, 9).begin(), s.range(3, 9).end());
+  ASSERT_EQ(window, (std::vector<int>{3, 5, 7}));
+}
+
+TEST(SetTest, TransparentLookup) {
+  struct ByLength {
+    using is_transparent = void;
+    bool operator()(const std::string& a, const std::string& b) const {
+      return a.size() < b.size();
+    }
+    bool operator()(const std::string& a, std::size_t n) const {
+      return a.size() < n;
+    }
+    bool operator()(std::size_t n, const std::string& b) const {
+      return n < b.size();
+    }
+  };
+  s21::set<std::string, ByLength> s;
+  s.insert("a");
+  s.insert("abc");
+  s.insert("abcde");
+  ASSERT_EQ(*s.find(std::size_t(3)), "abc");
+  ASSERT_EQ(s.count(std::size_t(2)), 0u);
+  ASSERT_EQ(*s.lower_bound(std::size_t(2)), "abc");
+  ASSERT_EQ(s.upper_bound(std::size_t(5)), s.end());
+  ASSERT_TRUE(s.contains(std::size_t(1)));
+  ASSERT_EQ(s.count("xyz"), 1u);
+}
+
+TEST(SetTest, MergeRelinksNodes) {
+  s21::set<int> a = {1, 3, 5, 7};
+  s21::set<int> b = {2, 3, 4, 7, 8};
+  const int* three_in_b = &*b.find(3);
+  const int* four_in_b = &*b.find(4);
+  a.merge(b);
+  ASSERT_EQ(a.size(), 7u);
+  std::vector<int> merged(a.begin(), a.end());
+  ASSERT_EQ(merged, (std::vector<int>{1, 2, 3, 4, 5, 7, 8}));
+  std::vector<int> left(b.begin(), b.end());
+  ASSERT_EQ(left, (std::vector<int>{3, 7}));
+  ASSERT_EQ(&*a.find(4), four_in_b);  // same node, now in a
+  ASSERT_EQ(&*b.find(3), three_in_b);
+  // the donor keeps working
+  b.insert(100);
+  b.clear();
+  a.insert(6);
+  ASSERT_EQ(a.size(), 8u);
+}
+
+TEST(SetTest, MergeWithOwnPoolsMovesValues) {
+  using Set = s21::set<int, std::less<int>, s21::node_pool_allocator<int>>;
+  Set a = {1, 3, 5, 7};
+  Set b = {2, 3, 4, 7, 8};
+  const int* four_in_b = &*b.find(4);
+  const int* three_in_b = &*b.find(3);
+  a.merge(b);
+  ASSERT_EQ(std::vector<int>(a.begin(), a.end()),
+            (std::vector<int>{1, 2, 3, 4, 5, 7, 8}));
+  ASSERT_EQ(std::vector<int>(b.begin(), b.end()), (std::vector<int>{3, 7}));
+  ASSERT_NE(&*a.find(4), four_in_b);   // a's pool cannot free b's node
+  ASSERT_EQ(&*b.find(3), three_in_b);  // what stays is not touched
+}
+
+TEST(SetTest, MergeSkewedAndLarge) {
+  s21::set<int> big;
+  for (int i = 0; i < 5000; i += 2) big.insert(i);
+  s21::set<int> small = {1, 2, 4999, 10001};
+  big.merge(small);
+  ASSERT_EQ(big.size(), 2503u);
+  ASSERT_EQ(small.size(), 1u);
+  ASSERT_TRUE(big.contains(10001));
+
+  s21::set<int> odd;
+  for (int i = 1; i < 5000; i += 2) odd.insert(i);
+  big.merge(odd);
+  ASSERT_EQ(big.size(), 5001u);
+  ASSERT_EQ(odd.size(), 2u);  // 1 and 4999 were already there
+  ASSERT_TRUE(std::is_sorted(big.begin(), big.end()));
+}
+
+TEST(SetTest, MergeWithForeignAllocatorCopies) {
+  s21::node_pool_allocator<int> shared;
+  using Set = s21::set<int, std::less<int>, s21::node_pool_allocator<int>>;
+  Set a(std::less<int>(), shared);
+  Set b;
+  Set c(std::less<int>(), shared);
+  a.insert(1);
+  b.insert(2);
+  c.insert(3);
+  b.merge(c);  // c's pool is shared with a: values are moved, not relinked
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(b.size(), 2u);
+  ASSERT_EQ(*b.begin(), 2);
+}
+
+TEST(SetTest, SetAlgebra) {
+  s21::set<int> a = {1, 2, 3, 4, 5, 6};
+  s21::set<int> b = {4, 5, 6, 7, 8};
+  auto to_vector = [](const s21::set<int>& s) {
+    return std::vector<int>(s.begin(), s.end());
+  };
+  ASSERT_EQ(to_vector(s21::set_union(a, b)),
+            (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+  ASSERT_EQ(to_vector(s21::set_intersection(a, b)),
+            (std::vector<int>{4, 5, 6}));
+  ASSERT_EQ(to_vector(s21::set_difference(a, b)),
+            (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(to_vector(s21::set_difference(b, a)), (std::vector<int>{7, 8}));
+  s21::set<int> empty;
+  ASSERT_TRUE(s21::set_intersection(a, empty).empty());
+  ASSERT_EQ(s21::set_union(empty, b).size(), 5u);
+  ASSERT_EQ(a.size(), 6u);
+}
+
+TEST(SetTest, NodeHandles) {
+  s21::set<std::string> a = {"x", "y"};
+  s21::set<std::string> b;
+  auto handle = a.extract("x");
+  ASSERT_EQ(handle.value(), "x");
+  handle.value() = "z";
+  ASSERT_TRUE(b.insert(std::move(handle)).inserted);
+  ASSERT_TRUE(b.contains("z"));
+  ASSERT_EQ(a.size(), 1u);
+  {
+    // the handle outlives its tree and frees the node on its own
+    auto orphan = b.extract(b.begin());
+    b.clear();
+  }
+  std::vector<std::string> left(a.begin(), a.end());
+  ASSERT_EQ(left, (std::vector<std::string>{"y"}));
+}
+
+TEST(SetTest, NodeHandleWithForeignAllocator) {
+  s21::node_pool_allocator<int> shared;
+  using Set = s21::set<int, std::less<int>, s21::node_pool_allocator<int>>;
+  Set a(std::less<int>(), shared);
+  Set b;
+  a.insert(7);
+  auto result = b.insert(a.extract(7));  // pool shared with 'shared'
+  ASSERT_TRUE(result.inserted);
+  ASSERT_EQ(*b.begin(), 7);
+  ASSERT_TRUE(a.empty());
+}
+
+namespace {
+
+int g_live_blocks = 0;
+
+// std::allocator that counts the blocks it has handed out and not freed.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+  T* allocate(std::size_t n) {
+    T* p = std::allocator<T>().allocate(n);
+    ++g_live_blocks;
+    return p;
+  }
+  void deallocate(T* p, std::size_t n) {
+    --g_live_blocks;
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const {
+    return true;
+  }
+};
+
+// Copies throw once 'copies_left' runs out.
+struct FragileCopy {
+  static inline int copies_left = 0;
+  int value = 0;
+  FragileCopy() = default;
+  explicit FragileCopy(int v) : value(v) {}
+  FragileCopy(const FragileCopy& other) : value(other.value) {
+    if (copies_left-- <= 0) throw std::runtime_error("copy failed");
+  }
+  bool operator<(const FragileCopy& other) const {
+    return value < other.value;
+  }
+};
+
+}  // namespace
+
+TEST(SetTest, FailedCopyFreesEverything) {
+  using Set = s21::set<FragileCopy, std::less<FragileCopy>,
+                       CountingAllocator<FragileCopy>>;
+  {
+    Set original;
+    for (int i = 0; i < 100; ++i) original.emplace(i);
+    FragileCopy::copies_left = 50;
+    ASSERT_THROW(Set copy(original), std::runtime_error);
+    FragileCopy::copies_left = 50;
+    ASSERT_THROW(Set copy(original, 2), std::runtime_error);
+  }
+  ASSERT_EQ(g_live_blocks, 0);
+}
+
+TEST(SetTest, ParallelCopy) {
+  std::vector<int> keys(100000);
+  for (int i = 0; i < 100000; ++i) keys[i] = (i * 7919) % 100000;
+  s21::set<int> original(keys.begin(), keys.end());
+  s21::set<int> copy(original, 4);
+  ASSERT_EQ(copy.size(), original.size());
+  ASSERT_TRUE(std::equal(copy.begin(), copy.end(), original.begin()));
+  // the workers' pools now belong to the copy
+  copy.erase(copy.find(500));
+  copy.insert(100000);
+  copy.clear();
+
+  s21::set<std::string, std::less<std::string>, std::allocator<std::string>>
+      strings;
+  for (int i = 0; i < 40000; ++i) strings.insert(std::to_string(i));
+  decltype(strings) string_copy(strings, 3);
+  ASSERT_TRUE(std::equal(string_copy.begin(), string_copy.end(),
+                         strings.begin(), strings.end()));
+}
+
+TEST(SetTest, ClearDeferred) {
+  s21::set<std::string> pooled;
+  s21::set<std::string, std::less<std::string>, std::allocator<std::string>>
+      plain;
+  for (int i = 0; i < 1000; ++i) {
+    pooled.insert(std::to_string(i));
+    plain.insert(std::to_string(i));
+  }
+  pooled.clear_deferred();
+  plain.clear_deferred();
+  ASSERT_TRUE(pooled.empty());
+  ASSERT_TRUE(plain.empty());
+  ASSERT_EQ(pooled.begin(), pooled.end());
+  pooled.insert("again");
+  plain.insert("again");
+  ASSERT_EQ(*pooled.begin(), "again");
+  ASSERT_EQ(*plain.begin(), "again");
+
+  // a node handle shares the pool, so the clear happens right here
+  pooled.insert("kept");
+  auto handle = pooled.extract("kept");
+  pooled.clear_deferred();
+  ASSERT_TRUE(pooled.empty());
+  ASSERT_EQ(handle.value(), "kept");
+  s21::background_reclaimer::instance().drain();
+}
+
+TEST(SetTest, PackedLayouts) {
+  using Arena =
+      s21::set<int, std::less<int>, std::allocator<int>, s21::ArenaIndexLinks>;
+  using Tagged = s21::set<int, std::less<int>, std::allocator<int>,
+                          s21::TaggedPointerLinks>;
+  // the arena layout brings its own allocator in place of std::allocator
+  static_assert(std::is_same_v<Arena::allocator_type,
+                               s21::node_arena_allocator<int>>);
+  static_assert(
+      std::is_same_v<Tagged::allocator_type, std::allocator<int>>);
+  static_assert(
+      sizeof(s21::TreeNode<int, s21::NoAugmentation, s21::ArenaIndexLinks>) ==
+      16);
+
+  Arena arena;
+  Tagged tagged;
+  std::set<int> expected;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 769) % 1500;
+    arena.insert(key);
+    tagged.insert(key);
+    expected.insert(key);
+  }
+  for (int i = 0; i < 1500; i += 4) {
+    arena.erase(arena.find(i));
+    tagged.erase(tagged.find(i));
+    expected.erase(i);
+  }
+  ASSERT_TRUE(std::equal(arena.begin(), arena.end(), expected.begin(),
+                         expected.end()));
+  ASSERT_TRUE(std::equal(tagged.begin(), tagged.end(), expected.begin(),
+                         expected.end()));
+
+  Arena copy(arena);
+  Arena other = {0, 4, 1501};
+  copy.merge(other);
+  ASSERT_EQ(copy.size(), arena.size() + 3);
+  ASSERT_TRUE(other.empty());
+  Arena both = s21::set_intersection(copy, arena);
+  ASSERT_TRUE(std::equal(both.begin(), both.end(), arena.begin(),
+                         arena.end()));
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#define private public
+#include "../containers/hash/s21_swiss_table.h"
+#undef private
+
+template <typename Key>
+struct TestSetTraits {
+  using key_type = Key;
+  using value_type = Key;
+  const key_type& operator()(const value_type& value) const { return value; }
+};
+
+// Sends every key to one of a handful of home slots, so clusters run into
+// the overflow tail and force the table to grow.
+struct FewHashes {
+  std::size_t operator()(int key) const {
+    return static_cast<std::size_t>(key % 3);
+  }
+};
+
+template <typename Table>
+class SwissTableTest : public ::testing::Test {
+ protected:
+  // Every element lies between its home and the first free slot after it,
+  // which is what lookups and backward-shift deletion rely on.
+  void assert_is_valid_table(const Table& table) {
+    ASSERT_EQ(table.empty(), table.size() == 0);
+    if (table.capacity_ == 0) {
+      ASSERT_EQ(table.begin(), table.end());
+      return;
+    }
+    ASSERT_EQ(table.slots_count_,
+              table.capacity_ + Table::tail_for(table.capacity_));
+    ASSERT_EQ(table.ctrl_[table.slots_count_], s21::kSentinel);
+    ASSERT_LE(table.size(), table.growth_limit_);
+    std::size_t full = 0;
+    for (std::size_t i = 0; i < table.slots_count_; ++i) {
+      if (table.ctrl_[i] < 0) {
+        ASSERT_EQ(table.ctrl_[i], s21::kEmpty);
+        continue;
+      }
+      ++full;
+      std::size_t mixed = table.mixed_hash(table.get_key(i));
+      ASSERT_EQ(table.ctrl_[i], s21::hash_h2(mixed));
+      std::size_t home = table.home_of(mixed);
+      ASSERT_LE(home, i);
+      for (std::size_t j = home; j < i; ++j) ASSERT_GE(table.ctrl_[j], 0);
+    }
+    ASSERT_EQ(full, table.size());
+    ASSERT_EQ(static_cast<std::size_t>(
+                  std::distance(table.begin(), table.end())),
+              table.size());
+  }
+};
+
+using SwissTableTypes = ::testing::Types<
+    s21::SwissTable<int, int, TestSetTraits<int>>,
+    s21::SwissTable<int, int, TestSetTraits<int>, FewHashes>,
+    s21::SwissTable<std::string, std::string, TestSetTraits<std::string>>>;
+TYPED_TEST_SUITE(SwissTableTest, SwissTableTypes);
+
+template <typename Key>
+Key make_key(int value) {
+  if constexpr (std::is_same_v<Key, std::string>) {
+    return "key-" + std::to_string(value);
+  } else {
+    return value;
+  }
+}
+
+TYPED_TEST(SwissTableTest, RandomInsertEraseMatchesStdSet) {
+  using Key = typename TypeParam::key_type;
+  TypeParam table;
+  std::unordered_set<Key> reference;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> keys(0, 3000);
+  for (int round = 0; round < 20000; ++round) {
+    Key key = make_key<Key>(keys(rng));
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(table.erase_key(key), reference.erase(key));
+    } else {
+      auto [it, inserted] = table.emplace(key);
+      ASSERT_EQ(inserted, reference.insert(key).second);
+      ASSERT_EQ(*it, key);
+    }
+    if (round % 2000 == 0) this->assert_is_valid_table(table);
+  }
+  this->assert_is_valid_table(table);
+  for (int i = 0; i <= 3000; ++i) {
+    Key key = make_key<Key>(i);
+    ASSERT_EQ(table.find(key) != table.end(), reference.count(key) == 1);
+  }
+}
+
+TYPED_TEST(SwissTableTest, EraseWhileIteratingVisitsEveryElementOnce) {
+  using Key = typename TypeParam::key_type;
+  TypeParam table;
+  for (int i = 0; i < 2000; ++i) table.emplace(make_key<Key>(i));
+  std::unordered_set<Key> seen;
+  for (auto it = table.begin(); it != table.end();) {
+    ASSERT_TRUE(seen.insert(*it).second);
+    if (seen.size() % 2) {
+      it = table.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_EQ(seen.size(), 2000u);
+  ASSERT_EQ(table.size(), 1000u);
+  this->assert_is_valid_table(table);
+}
+
+TYPED_TEST(SwissTableTest, RehashReserveAndLoadFactor) {
+  using Key = typename TypeParam::key_type;
+  TypeParam table;
+  table.reserve(1000);
+  std::size_t buckets = table.bucket_count();
+  ASSERT_GE(static_cast<float>(buckets) * table.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) table.emplace(make_key<Key>(i));
+  if (!std::is_same_v<typename TypeParam::hasher, FewHashes>) {
+    ASSERT_EQ(table.bucket_count(), buckets);
+  }
+  ASSERT_LE(table.load_factor(), table.max_load_factor());
+  table.max_load_factor(0.5f);
+  ASSERT_LE(table.load_factor(), 0.5f);
+  this->assert_is_valid_table(table);
+  ASSERT_THROW(table.max_load_factor(0.0f), std::invalid_argument);
+  ASSERT_THROW(table.max_load_factor(1.5f), std::invalid_argument);
+  table.rehash(0);
+  this->assert_is_valid_table(table);
+  ASSERT_EQ(table.size(), 1000u);
+  TypeParam copy(table);
+  this->assert_is_valid_table(copy);
+  table.clear();
+  this->assert_is_valid_table(table);
+  table.rehash(0);
+  ASSERT_EQ(table.bucket_count(), 0u);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_NE(copy.find(make_key<Key>(i)), copy.end());
+  }
+}
+
+TEST(HashGroupTest, MatchesAndLeadingEmpties) {
+  std::vector<s21::ctrl_t> ctrl(2 * s21::HashGroup::kWidth, s21::kEmpty);
+  ctrl[3] = 5;
+  ctrl[7] = 5;
+  ctrl[6] = 9;
+  ctrl[8] = s21::kSentinel;
+  s21::HashGroup group(ctrl.data());
+  auto match = group.match(5);
+  ASSERT_TRUE(match);
+  ASSERT_EQ(match.lowest(), 3u);
+  match.clear_lowest();
+  ASSERT_EQ(match.lowest(), 7u);
+  ASSERT_EQ(group.count_leading_empty(), 3u);
+  ASSERT_EQ(group.match_non_full().lowest(), 0u);
+  ASSERT_FALSE(group.match(11));
+  ASSERT_EQ(s21::HashGroup(ctrl.data() + 8).count_leading_empty(), 0u);
+}
@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "../containers/tree/s21_tree_node_arena_links.h"
 #include "../s21_containers.h"
 
 class TreeNodeTest : public ::testing::Test {
@@ -97,4 +101,90 @@ TEST_F(TreeNodeTest, Predecessor) {
   ASSERT_EQ(root_->left->right->predecessor()->data, 5);  // 7 -> 5
   ASSERT_EQ(root_->left->predecessor()->data, 3);         // 5 -> 3
   ASSERT_EQ(root_->left->left->predecessor(), nullptr);   // 3 -> rend
-}
\ No newline at end of file
+}
+TEST(TreeNodeLayoutTest, PackedLayoutSizes) {
+  using Tagged =
+      s21::TreeNode<long, s21::NoAugmentation, s21::TaggedPointerLinks>;
+  using Indexed = s21::TreeNode<int, s21::NoAugmentation, s21::ArenaIndexLinks>;
+  static_assert(sizeof(Tagged) == 3 * sizeof(void*) + sizeof(long));
+  static_assert(sizeof(Indexed) == 16);
+}
+
+TEST(TreeNodeLayoutTest, TaggedParentKeepsColorApart) {
+  using Node = s21::TreeNode<int, s21::NoAugmentation, s21::TaggedPointerLinks>;
+  Node parent(1);
+  Node child(2);
+  ASSERT_TRUE(child.is_red());
+  ASSERT_EQ(static_cast<Node*>(child.parent), nullptr);
+  child.parent = &parent;
+  child.set_black();
+  ASSERT_EQ(child.parent, &parent);
+  ASSERT_TRUE(child.is_black());
+  child.parent = nullptr;  // relinking keeps the color
+  ASSERT_TRUE(child.is_black());
+  parent.left = &child;
+  child.parent = &parent;
+  ASSERT_TRUE(child.is_left_child());
+  Node copy(child);  // copies color and data, not links
+  ASSERT_TRUE(copy.is_black());
+  ASSERT_EQ(copy.parent, nullptr);
+}
+
+TEST(TreeNodeLayoutTest, ArenaIndexLinks) {
+  using Node = s21::TreeNode<int, s21::NoAugmentation, s21::ArenaIndexLinks>;
+  s21::node_arena_allocator<Node> alloc;
+  Node* a = alloc.allocate(1);
+  Node* b = alloc.allocate(1);
+  std::construct_at(a, 1);
+  std::construct_at(b, 2);
+  a->right = b;
+  b->parent = a;
+  b->set_black();
+  ASSERT_EQ(a->right, b);
+  ASSERT_EQ(b->parent, a);
+  ASSERT_TRUE(b->is_black());
+  ASSERT_TRUE(a->is_red());
+  ASSERT_EQ(a->successor(), b);
+  std::destroy_at(a);
+  std::destroy_at(b);
+  alloc.deallocate(b, 1);
+  alloc.deallocate(a, 1);
+  ASSERT_EQ(alloc.allocate(1), a);  // freed slots are reused first
+  alloc.deallocate(a, 1);
+}
+
+TEST(TreeNodeLayoutTest, ArenaServesManyThreads) {
+  using Node = s21::TreeNode<int, s21::NoAugmentation, s21::ArenaIndexLinks>;
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 1000;
+  std::vector<std::vector<Node*>> taken(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&taken, t] {
+      s21::node_arena_allocator<Node> alloc;
+      for (int i = 0; i < kPerThread; ++i) {
+        Node* node = alloc.allocate(1);
+        std::construct_at(node, t * kPerThread + i);
+        taken[t].push_back(node);
+        if (i % 3 == 0) {  // churn the thread's own free list
+          std::destroy_at(node);
+          alloc.deallocate(node, 1);
+          taken[t].pop_back();
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  std::set<Node*> distinct;
+  s21::node_arena_allocator<Node> alloc;
+  for (const std::vector<Node*>& nodes : taken) {
+    for (Node* node : nodes) {
+      ASSERT_TRUE(distinct.insert(node).second);
+      ASSERT_EQ(s21::node_arena<Node>::pointer(
+                    s21::node_arena<Node>::index(node)),
+                node);
+      std::destroy_at(node);
+      alloc.deallocate(node, 1);  // freed on another thread
+    }
+  }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(UnorderedMapTest, InitializerListKeepsFirstDuplicate) {
+  s21::unordered_map<int, std::string> m = {
+      {3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.at(1), "a");
+  std::map<int, std::string> sorted(m.begin(), m.end());
+  ASSERT_EQ(sorted.size(), 3u);
+  ASSERT_EQ(sorted.begin()->second, "a");
+}
+
+TEST(UnorderedMapTest, AtAndSubscript) {
+  s21::unordered_map<std::string, int> m;
+  m["one"] = 1;
+  m["two"] += 2;
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_EQ(m["two"], 2);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  const auto& cm = m;
+  ASSERT_EQ(cm.at("two"), 2);
+  ASSERT_THROW(cm.at("zero"), std::out_of_range);
+}
+
+TEST(UnorderedMapTest, InsertVariants) {
+  s21::unordered_map<int, std::string> m;
+  ASSERT_TRUE(m.insert({1, "a"}).second);
+  ASSERT_FALSE(m.insert({1, "b"}).second);
+  ASSERT_TRUE(m.insert(2, "b").second);
+  ASSERT_FALSE(m.insert(2, "c").second);
+  auto [it, inserted] = m.insert_or_assign(2, "c");
+  ASSERT_FALSE(inserted);
+  ASSERT_EQ(it->second, "c");
+  ASSERT_TRUE(m.try_emplace(4, 3, 'x').second);
+  ASSERT_EQ(m.at(4), "xxx");
+  ASSERT_FALSE(m.emplace(4, "y").second);
+  ASSERT_EQ(m.emplace_hint(m.end(), 5, "e")->first, 5);
+  std::string value = "moved";
+  ASSERT_FALSE(m.try_emplace(1, std::move(value)).second);
+  ASSERT_EQ(value, "moved");
+  ASSERT_EQ(m.size(), 4u);
+}
+
+TEST(UnorderedMapTest, MatchesStdUnorderedMap) {
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> reference;
+  for (int i = 0; i < 20000; ++i) {
+    int key = (i * 7919) % 10007;
+    if (i % 5 == 0) {
+      ASSERT_EQ(m.erase(key), reference.erase(key));
+    } else {
+      m[key] = i;
+      reference[key] = i;
+    }
+  }
+  ASSERT_EQ(m.size(), reference.size());
+  for (const auto& [key, value] : reference) ASSERT_EQ(m.at(key), value);
+  for (int key = 10007; key < 10100; ++key) {
+    ASSERT_FALSE(m.contains(key));
+    auto [first, last] = m.equal_range(key);
+    ASSERT_EQ(first, last);
+  }
+  auto [first, last] = m.equal_range(0);
+  ASSERT_EQ(std::distance(first, last), 1);
+}
+
+TEST(UnorderedMapTest, EraseWhileIterating) {
+  s21::unordered_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i;
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first % 2) {
+      it = m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_EQ(m.size(), 500u);
+  for (const auto& [key, value] : m) ASSERT_EQ(key % 2, 0);
+}
+
+TEST(UnorderedMapTest, MergeCopyMoveAndSwap) {
+  s21::unordered_map<int, std::string> a = {{1, "a"}, {3, "c"}};
+  s21::unordered_map<int, std::string> b = {{1, "x"}, {2, "b"}, {4, "d"}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.at(1), "a");
+  ASSERT_EQ(a.at(2), "b");
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_EQ(b.at(1), "x");
+  s21::unordered_map<int, std::string> copy(a);
+  s21::unordered_map<int, std::string> moved(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.begin(), a.end());
+  a.swap(moved);
+  ASSERT_EQ(a.size(), 4u);
+  moved = copy;
+  ASSERT_EQ(moved.at(4), "d");
+  moved.clear();
+  ASSERT_EQ(moved.begin(), moved.end());
+  ASSERT_FALSE(moved.contains(4));
+}
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+TEST(UnorderedMapTest, HeterogeneousLookup) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> m = {
+      {"apple", 1}, {"pear", 2}};
+  std::string_view key = "pear";
+  ASSERT_TRUE(m.contains(key));
+  ASSERT_EQ(m.find(key)->second, 2);
+  ASSERT_EQ(m.count("apple"), 1u);
+  ASSERT_FALSE(m.contains(std::string_view("plum")));
+}
+
+TEST(UnorderedMapTest, HashPolicyAndRanges) {
+  std::vector<std::pair<int, int>> source;
+  for (int i = 0; i < 500; ++i) source.emplace_back(i, i * i);
+  s21::unordered_map<int, int> m(s21::from_range, source);
+  ASSERT_EQ(m.size(), 500u);
+  ASSERT_LE(m.load_factor(), m.max_load_factor());
+  m.reserve(5000);
+  std::size_t buckets = m.bucket_count();
+  for (int i = 500; i < 5000; ++i) m[i] = i;
+  ASSERT_EQ(m.bucket_count(), buckets);
+  m.max_load_factor(0.5f);
+  ASSERT_LE(m.load_factor(), 0.5f);
+  ASSERT_THROW(m.max_load_factor(2.0f), std::invalid_argument);
+  m.insert_range(std::vector<std::pair<int, int>>{{-1, 1}, {0, 7}});
+  ASSERT_EQ(m.at(-1), 1);
+  ASSERT_EQ(m.at(0), 0);
+}
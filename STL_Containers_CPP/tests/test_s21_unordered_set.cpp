@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(UnorderedSetTest, ConstructionAndLookup) {
+  s21::unordered_set<int> s = {5, 1, 4, 1, 5, 9, 2, 6};
+  ASSERT_EQ(s.size(), 6u);
+  std::set<int> sorted(s.begin(), s.end());
+  ASSERT_EQ(sorted, (std::set<int>{1, 2, 4, 5, 6, 9}));
+  ASSERT_TRUE(s.contains(9));
+  ASSERT_FALSE(s.contains(3));
+  ASSERT_EQ(s.count(4), 1u);
+  std::vector<int> source = {3, 3, 2};
+  s21::unordered_set<int> r(s21::from_range, source);
+  ASSERT_EQ(r.size(), 2u);
+}
+
+TEST(UnorderedSetTest, InsertEraseMatchStdUnorderedSet) {
+  s21::unordered_set<std::string> s;
+  std::unordered_set<std::string> reference;
+  for (int round = 0; round < 10000; ++round) {
+    std::string key = std::to_string(round * 31 % 1500);
+    if (round % 4 == 0) {
+      ASSERT_EQ(s.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(s.insert(key).second, reference.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), reference.size());
+  for (const auto& key : reference) ASSERT_TRUE(s.contains(key));
+  for (const auto& key : s) ASSERT_EQ(reference.count(key), 1u);
+}
+
+TEST(UnorderedSetTest, MergeCopyMoveAndSwap) {
+  s21::unordered_set<int> a = {1, 3};
+  s21::unordered_set<int> b = {1, 2, 4};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_TRUE(b.contains(1));
+  s21::unordered_set<int> copy(a);
+  s21::unordered_set<int> moved(std::move(a));
+  ASSERT_TRUE(a.empty());
+  a.swap(moved);
+  ASSERT_EQ(a.size(), 4u);
+  moved = copy;
+  ASSERT_TRUE(moved.contains(4));
+  auto next = moved.erase(moved.find(4));
+  ASSERT_TRUE(next == moved.end() || *next != 4);
+  ASSERT_EQ(moved.size(), 3u);
+  moved.rehash(1000);
+  ASSERT_GE(moved.bucket_count(), 1000u);
+  ASSERT_TRUE(moved.contains(3));
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <limits>
+#include <list>
+#include <sstream>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -848,4 +852,65 @@ TEST(VectorModifiersTest, ComplexOperationsSequence) {
   v.push_back(100);
   EXPECT_EQ(v.size(), 1u);
   EXPECT_EQ(v[0], 100);
-}
\ No newline at end of file
+}
+
+TEST(VectorConstructorsTest, IteratorPairConstructor) {
+  std::list<int> source = {1, 2, 3, 4};
+  s21::vector<int> v(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 4u);
+  EXPECT_EQ(v.capacity(), 4u);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(VectorConstructorsTest, InputIteratorConstructor) {
+  std::istringstream input("5 6 7");
+  s21::vector<int> v{std::istream_iterator<int>(input),
+                     std::istream_iterator<int>()};
+  EXPECT_EQ(v.size(), 3u);
+  EXPECT_EQ(v.back(), 7);
+}
+
+TEST(VectorConstructorsTest, FromRangeConstructor) {
+  s21::list<double> source = {1.5, 2.5};
+  s21::vector<double> v(s21::from_range, source);
+  EXPECT_EQ(v.size(), 2u);
+  EXPECT_DOUBLE_EQ(v[1], 2.5);
+  s21::vector<int> empty(s21::from_range, std::vector<int>());
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(VectorModifiersTest, AssignReusesCapacity) {
+  s21::vector<int> v = {1, 2, 3, 4, 5};
+  int* data = v.data();
+  std::vector<int> shorter = {9, 8};
+  v.assign(shorter.begin(), shorter.end());
+  EXPECT_EQ(v.size(), 2u);
+  EXPECT_EQ(v.capacity(), 5u);
+  EXPECT_EQ(v.data(), data);
+  EXPECT_EQ(v[0], 9);
+  std::vector<int> longer(10, 3);
+  v.assign(longer.begin(), longer.end());
+  EXPECT_EQ(v.size(), 10u);
+  EXPECT_EQ(v.capacity(), 10u);
+  EXPECT_EQ(v[9], 3);
+}
+
+TEST(VectorModifiersTest, CopyAssignAndMoveInsert) {
+  s21::vector<std::string> v = {"a", "b"};
+  s21::vector<std::string> copy;
+  copy = v;
+  EXPECT_EQ(copy.size(), 2u);
+  EXPECT_EQ(copy[1], "b");
+  std::string value = "long enough to live on the heap";
+  v.insert(v.begin(), std::move(value));
+  v.push_back(std::string("z"));
+  EXPECT_EQ(v.size(), 4u);
+  EXPECT_EQ(v[0], "long enough to live on the heap");
+  EXPECT_EQ(v[3], "z");
+  // the inserted element may come from the same vector
+  v.insert(v.begin(), v[3]);
+  EXPECT_EQ(v[0], "z");
+  const s21::vector<std::string>& cv = v;
+  EXPECT_EQ(cv.end() - cv.begin(), 5);
+  EXPECT_EQ(cv.data()[2], "a");
+}